@@ -33,6 +33,7 @@
 #include "container_type_validate.h"
 #include "core/hashfuncs.h"
 #include "core/object.h"
+#include "core/paged_allocator.h"
 #include "core/script_language.h"
 #include "core/variant.h"
 #include "core/vector.h"
@@ -45,6 +46,8 @@ public:
 	ContainerTypeValidate typed;
 };
 
+static PagedAllocator<ArrayPrivate, true> array_pool;
+
 void Array::_ref(const Array &p_from) const {
 	ArrayPrivate *_fp = p_from._p;
 
@@ -69,7 +72,7 @@ void Array::_unref() const {
 	}
 
 	if (_p->refcount.unref()) {
-		memdelete(_p);
+		array_pool.free(_p);
 	}
 	_p = nullptr;
 }
@@ -493,7 +496,7 @@ const void *Array::id() const {
 }
 
 Array::Array(const Array &p_from, uint32_t p_type, const StringName &p_class_name, const Variant &p_script) {
-	_p = memnew(ArrayPrivate);
+	_p = array_pool.alloc();
 	_p->refcount.init();
 	set_typed(p_type, p_class_name, p_script);
 	_assign(p_from);
@@ -519,7 +522,7 @@ Array::Array(const Array &p_from) {
 }
 
 Array::Array() {
-	_p = memnew(ArrayPrivate);
+	_p = array_pool.alloc();
 	_p->refcount.init();
 }
 
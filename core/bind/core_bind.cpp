@@ -129,6 +129,22 @@ bool _ResourceLoader::exists(const String &p_path, const String &p_type_hint) {
 	return ResourceLoader::exists(p_path, p_type_hint);
 }
 
+void _ResourceLoader::set_share_identical_content(bool p_share) {
+	ResourceLoader::set_share_identical_content(p_share);
+}
+
+bool _ResourceLoader::is_sharing_identical_content() const {
+	return ResourceLoader::is_sharing_identical_content();
+}
+
+uint64_t _ResourceLoader::get_shared_content_count() const {
+	return ResourceCache::get_shared_content_count();
+}
+
+uint64_t _ResourceLoader::get_shared_content_bytes() const {
+	return ResourceCache::get_shared_content_bytes();
+}
+
 void _ResourceLoader::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("load_threaded_request", "path", "type_hint", "use_sub_threads"), &_ResourceLoader::load_threaded_request, DEFVAL(""), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("load_threaded_get_status", "path", "progress"), &_ResourceLoader::load_threaded_get_status, DEFVAL(Array()));
@@ -140,6 +156,10 @@ void _ResourceLoader::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_dependencies", "path"), &_ResourceLoader::get_dependencies);
 	ClassDB::bind_method(D_METHOD("has_cached", "path"), &_ResourceLoader::has_cached);
 	ClassDB::bind_method(D_METHOD("exists", "path", "type_hint"), &_ResourceLoader::exists, DEFVAL(""));
+	ClassDB::bind_method(D_METHOD("set_share_identical_content", "enable"), &_ResourceLoader::set_share_identical_content);
+	ClassDB::bind_method(D_METHOD("is_sharing_identical_content"), &_ResourceLoader::is_sharing_identical_content);
+	ClassDB::bind_method(D_METHOD("get_shared_content_count"), &_ResourceLoader::get_shared_content_count);
+	ClassDB::bind_method(D_METHOD("get_shared_content_bytes"), &_ResourceLoader::get_shared_content_bytes);
 
 	BIND_ENUM_CONSTANT(THREAD_LOAD_INVALID_RESOURCE);
 	BIND_ENUM_CONSTANT(THREAD_LOAD_IN_PROGRESS);
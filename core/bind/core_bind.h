@@ -69,6 +69,11 @@ public:
 	bool has_cached(const String &p_path);
 	bool exists(const String &p_path, const String &p_type_hint = "");
 
+	void set_share_identical_content(bool p_share);
+	bool is_sharing_identical_content() const;
+	uint64_t get_shared_content_count() const;
+	uint64_t get_shared_content_bytes() const;
+
 	_ResourceLoader() { singleton = this; }
 };
 
@@ -115,10 +115,10 @@ public:
 		ClassInfo *inherits_ptr = nullptr;
 		void *class_ptr = nullptr;
 
-		HashMap<StringName, MethodBind *> method_map;
-		HashMap<StringName, int> constant_map;
+		DenseHashMap<StringName, MethodBind *> method_map;
+		DenseHashMap<StringName, int> constant_map;
 		HashMap<StringName, List<StringName>> enum_map;
-		HashMap<StringName, MethodInfo> signal_map;
+		DenseHashMap<StringName, MethodInfo> signal_map;
 		List<PropertyInfo> property_list;
 		HashMap<StringName, PropertyInfo> property_map;
 #ifdef DEBUG_METHODS_ENABLED
@@ -129,7 +129,7 @@ public:
 		Map<StringName, MethodInfo> virtual_methods_map;
 		StringName category;
 #endif
-		HashMap<StringName, PropertySetGet> property_setget;
+		DenseHashMap<StringName, PropertySetGet> property_setget;
 
 		StringName inherits;
 		StringName name;
@@ -105,3 +105,133 @@ CommandQueueMT::~CommandQueueMT() {
 	}
 	memfree(command_mem);
 }
+
+CommandQueueSPSC::Block *CommandQueueSPSC::_alloc_block(uint32_t p_size) {
+	const uint32_t header_size = (sizeof(Block) + 8 - 1) & ~(8 - 1);
+	uint8_t *mem = (uint8_t *)memalloc(header_size + p_size);
+	ERR_FAIL_COND_V(!mem, nullptr);
+	Block *block = memnew_placement(mem, Block);
+	block->size = p_size;
+	block->data = mem + header_size;
+	return block;
+}
+
+void CommandQueueSPSC::_next_write_block(uint32_t p_needed) {
+	Block *block = spare_block.exchange(nullptr, std::memory_order_acquire);
+	if (!block || block->size < p_needed) {
+		// The consumer still holds the spare; grow rather than wait for it.
+		// Other producers would spin while this one is in the allocator, so
+		// the lock is released meanwhile.
+		const uint32_t size = MAX(write_block->size * 2, p_needed);
+		if (multiple_producers) {
+			producer_lock.unlock();
+		}
+		if (block) {
+			memfree(block);
+		}
+		block = _alloc_block(size);
+		CRASH_COND(!block);
+		if (multiple_producers) {
+			producer_lock.lock();
+			if (write_pos + p_needed <= write_block->size) {
+				// Another producer moved on meanwhile. Keep the block as the
+				// spare, or free it outside the lock if there already is one.
+				Block *expected = nullptr;
+				if (!spare_block.compare_exchange_strong(expected, block, std::memory_order_acq_rel)) {
+					producer_lock.unlock();
+					memfree(block);
+					producer_lock.lock();
+				}
+				return;
+			}
+		}
+	} else {
+		block->committed.store(0, std::memory_order_relaxed);
+		block->next.store(nullptr, std::memory_order_relaxed);
+		block->read = 0;
+	}
+
+	// Publishing the link tells the consumer that this block is final.
+	write_block->next.store(block, std::memory_order_release);
+	write_block = block;
+	write_pos = 0;
+}
+
+void CommandQueueSPSC::_release_block(Block *p_block) {
+	Block *old = spare_block.exchange(p_block, std::memory_order_acq_rel);
+	if (old) {
+		memfree(old);
+	}
+}
+
+bool CommandQueueSPSC::_is_empty() const {
+	return read_block->read == read_block->committed.load() && read_block->next.load() == nullptr;
+}
+
+int CommandQueueSPSC::flush_all() {
+	int flushed = 0;
+	while (true) {
+		Block *block = read_block;
+		const uint32_t committed = block->committed.load(std::memory_order_acquire);
+		while (block->read < committed) {
+			uint8_t *mem = &block->data[block->read];
+			block->read += COMMAND_HEADER_SIZE + *(uint32_t *)mem;
+
+			CommandBase *cmd = reinterpret_cast<CommandBase *>(mem + COMMAND_HEADER_SIZE);
+			cmd->call();
+			cmd->post();
+			cmd->~CommandBase();
+			flushed++;
+		}
+
+		Block *next = block->next.load(std::memory_order_acquire);
+		if (!next) {
+			break;
+		}
+		if (block->read < block->committed.load(std::memory_order_acquire)) {
+			continue; // Published right before the producer moved on.
+		}
+		read_block = next;
+		_release_block(block);
+	}
+	return flushed;
+}
+
+void CommandQueueSPSC::wait_and_flush() {
+	ERR_FAIL_COND(!sync);
+	if (flush_all() > 0) {
+		return;
+	}
+
+	sync->waiting.store(true);
+	if (_is_empty()) {
+		sync->sem.wait();
+	}
+	sync->waiting.store(false);
+	flush_all();
+}
+
+CommandQueueSPSC::CommandQueueSPSC(bool p_sync, bool p_multiple_producers) {
+	multiple_producers = p_multiple_producers;
+	write_block = _alloc_block(BLOCK_SIZE);
+	read_block = write_block;
+	if (p_sync) {
+		sync = memnew(Wakeup);
+	}
+}
+
+CommandQueueSPSC::~CommandQueueSPSC() {
+	if (sync) {
+		memdelete(sync);
+	}
+	Block *block = read_block;
+	while (block) {
+		Block *next = block->next.load();
+		memfree(block);
+		block = next;
+	}
+	Block *spare = spare_block.load();
+	if (spare) {
+		memfree(spare);
+	}
+}
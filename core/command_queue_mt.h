@@ -35,8 +35,11 @@
 #include "core/os/mutex.h"
 #include "core/os/semaphore.h"
 #include "core/simple_type.h"
+#include "core/spin_lock.h"
 #include "core/typedefs.h"
 
+#include <atomic>
+
 #define COMMA(N) _COMMA_##N
 #define _COMMA_0
 #define _COMMA_1 ,
@@ -496,6 +499,135 @@ public:
 	~CommandQueueMT();
 };
 
+// Lock-free variant of CommandQueueMT for a single consumer thread.
+//
+// Commands are written to a chain of blocks. When the current block is full,
+// the producer moves on to a recycled block, or to a new one twice as large if
+// the consumer is still behind, instead of waiting for room. The consumer never
+// locks, and it is only woken up when it is actually asleep, so it drains every
+// published command per wakeup. If several threads can push, pass
+// p_multiple_producers so that pushes serialize among themselves.
+class CommandQueueSPSC {
+	struct SyncSemaphore {
+		Semaphore sem;
+		bool in_use = false;
+	};
+
+	struct CommandBase {
+		virtual void call() = 0;
+		virtual void post() {}
+		virtual ~CommandBase() {}
+	};
+
+	struct SyncCommand : public CommandBase {
+		SyncSemaphore *sync_sem;
+
+		virtual void post() {
+			sync_sem->sem.post();
+		}
+	};
+
+	DECL_CMD(0)
+	SPACE_SEP_LIST(DECL_CMD, 15)
+
+	DECL_CMD_RET(0)
+	SPACE_SEP_LIST(DECL_CMD_RET, 15)
+
+	DECL_CMD_SYNC(0)
+	SPACE_SEP_LIST(DECL_CMD_SYNC, 15)
+
+	struct Wakeup {
+		Semaphore sem;
+		std::atomic<bool> waiting = { false };
+
+		_FORCE_INLINE_ void post() {
+			if (waiting.load() && waiting.exchange(false)) {
+				sem.post();
+			}
+		}
+	};
+
+	struct Block {
+		std::atomic<uint32_t> committed = { 0 }; // Bytes published to the consumer.
+		std::atomic<Block *> next = { nullptr }; // Set once the producer moved past this block.
+		uint32_t size = 0;
+		uint32_t read = 0; // Consumer only.
+		uint8_t *data = nullptr;
+	};
+
+	enum {
+		BLOCK_SIZE_KB = 256,
+		BLOCK_SIZE = BLOCK_SIZE_KB * 1024,
+		COMMAND_HEADER_SIZE = 8
+	};
+
+	Block *write_block = nullptr;
+	uint32_t write_pos = 0;
+	Block *read_block = nullptr;
+	std::atomic<Block *> spare_block = { nullptr };
+
+	bool multiple_producers = false;
+	SpinLock producer_lock;
+	Wakeup *sync = nullptr;
+
+	static Block *_alloc_block(uint32_t p_size);
+	void _next_write_block(uint32_t p_needed);
+	void _release_block(Block *p_block);
+	bool _is_empty() const;
+
+	template <class T>
+	T *allocate_and_lock() {
+		if (multiple_producers) {
+			producer_lock.lock();
+		}
+		const uint32_t size = (sizeof(T) + 8 - 1) & ~(8 - 1);
+		// The lock may be released while a block is allocated, so check again.
+		while (write_pos + COMMAND_HEADER_SIZE + size > write_block->size) {
+			_next_write_block(COMMAND_HEADER_SIZE + size);
+		}
+		uint8_t *mem = &write_block->data[write_pos];
+		*(uint32_t *)mem = size;
+		T *cmd = memnew_placement(mem + COMMAND_HEADER_SIZE, T);
+		write_pos += COMMAND_HEADER_SIZE + size;
+		return cmd;
+	}
+
+	_FORCE_INLINE_ void unlock() {
+		// Sequentially consistent so Wakeup::post() can't miss a consumer
+		// that is about to sleep (see wait_and_flush()).
+		write_block->committed.store(write_pos);
+		if (multiple_producers) {
+			producer_lock.unlock();
+		}
+	}
+
+	// Each producer waits for its own command to finish before pushing
+	// another, so one semaphore per thread is enough.
+	_FORCE_INLINE_ SyncSemaphore *_alloc_sync_sem() {
+		static thread_local SyncSemaphore sync_sem;
+		return &sync_sem;
+	}
+
+public:
+	DECL_PUSH(0)
+	SPACE_SEP_LIST(DECL_PUSH, 15)
+
+	DECL_PUSH_AND_RET(0)
+	SPACE_SEP_LIST(DECL_PUSH_AND_RET, 15)
+
+	DECL_PUSH_AND_SYNC(0)
+	SPACE_SEP_LIST(DECL_PUSH_AND_SYNC, 15)
+
+	// Runs every command published so far and returns how many ran.
+	// Must only be called from the consumer thread.
+	int flush_all();
+	// Sleeps until something is pushed, then flushes everything available.
+	void wait_and_flush();
+
+	CommandQueueSPSC(bool p_sync, bool p_multiple_producers = false);
+	~CommandQueueSPSC();
+};
+
 #undef ARG
 #undef PARAM
 #undef TYPE_PARAM
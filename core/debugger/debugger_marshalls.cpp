@@ -66,6 +66,53 @@ bool DebuggerMarshalls::ResourceUsage::deserialize(const Array &p_arr) {
 	return true;
 }
 
+Array DebuggerMarshalls::MemoryTagUsage::serialize() {
+	Array arr;
+	arr.push_back(tags.size() * 3);
+	for (int i = 0; i < tags.size(); i++) {
+		arr.push_back(tags[i].name);
+		arr.push_back(tags[i].bytes);
+		arr.push_back(tags[i].allocs);
+	}
+	arr.push_back(samples.size() * 4);
+	for (int i = 0; i < samples.size(); i++) {
+		arr.push_back(samples[i].site);
+		arr.push_back(samples[i].tag);
+		arr.push_back(samples[i].count);
+		arr.push_back(samples[i].bytes);
+	}
+	return arr;
+}
+
+bool DebuggerMarshalls::MemoryTagUsage::deserialize(const Array &p_arr) {
+	CHECK_SIZE(p_arr, 1, "MemoryTagUsage");
+	uint32_t tag_size = p_arr[0];
+	CHECK_SIZE(p_arr, tag_size + 2, "MemoryTagUsage");
+	int idx = 1;
+	for (uint32_t i = 0; i < tag_size / 3; i++) {
+		MemoryTagInfo info;
+		info.name = p_arr[idx];
+		info.bytes = p_arr[idx + 1];
+		info.allocs = p_arr[idx + 2];
+		tags.push_back(info);
+		idx += 3;
+	}
+	uint32_t sample_size = p_arr[idx];
+	idx++;
+	CHECK_SIZE(p_arr, idx + sample_size, "MemoryTagUsage");
+	for (uint32_t i = 0; i < sample_size / 4; i++) {
+		MemorySampleInfo info;
+		info.site = p_arr[idx];
+		info.tag = p_arr[idx + 1];
+		info.count = p_arr[idx + 2];
+		info.bytes = p_arr[idx + 3];
+		samples.push_back(info);
+		idx += 4;
+	}
+	CHECK_END(p_arr, idx, "MemoryTagUsage");
+	return true;
+}
+
 Array DebuggerMarshalls::ScriptFunctionSignature::serialize() {
 	Array arr;
 	arr.push_back(name);
@@ -52,6 +52,28 @@ struct DebuggerMarshalls {
 		bool deserialize(const Array &p_arr);
 	};
 
+	// Per subsystem memory accounting (see Memory::Tag).
+	struct MemoryTagInfo {
+		String name;
+		uint64_t bytes = 0;
+		uint64_t allocs = 0;
+	};
+
+	struct MemorySampleInfo {
+		String site;
+		String tag;
+		uint64_t count = 0;
+		uint64_t bytes = 0;
+	};
+
+	struct MemoryTagUsage {
+		Vector<MemoryTagInfo> tags;
+		Vector<MemorySampleInfo> samples;
+
+		Array serialize();
+		bool deserialize(const Array &p_arr);
+	};
+
 	// Network profiler
 	struct MultiplayerNodeInfo {
 		ObjectID node;
@@ -443,6 +443,31 @@ void RemoteDebugger::_send_resource_usage() {
 	EngineDebugger::get_singleton()->send_message("memory:usage", usage.serialize());
 }
 
+void RemoteDebugger::_send_memory_tag_usage() {
+	DebuggerMarshalls::MemoryTagUsage usage;
+
+	for (int i = 0; i < Memory::TAG_MAX; i++) {
+		DebuggerMarshalls::MemoryTagInfo info;
+		info.name = Memory::get_tag_name(Memory::Tag(i));
+		info.bytes = Memory::get_tag_usage(Memory::Tag(i));
+		info.allocs = Memory::get_tag_alloc_count(Memory::Tag(i));
+		usage.tags.push_back(info);
+	}
+
+	Memory::AllocSample samples[Memory::MAX_ALLOC_SAMPLES];
+	int sample_count = Memory::get_alloc_samples(samples, Memory::MAX_ALLOC_SAMPLES);
+	for (int i = 0; i < sample_count; i++) {
+		DebuggerMarshalls::MemorySampleInfo info;
+		info.site = samples[i].site ? samples[i].site : "";
+		info.tag = Memory::get_tag_name(samples[i].tag);
+		info.count = samples[i].count;
+		info.bytes = samples[i].bytes;
+		usage.samples.push_back(info);
+	}
+
+	EngineDebugger::get_singleton()->send_message("memory:tags", usage.serialize());
+}
+
 Error RemoteDebugger::_put_msg(String p_message, Array p_data) {
 	Array msg;
 	msg.push_back(p_message);
@@ -895,6 +920,12 @@ Error RemoteDebugger::_core_capture(const String &p_cmd, const Array &p_data, bo
 		script_debugger->set_skip_breakpoints(p_data[0]);
 	} else if (p_cmd == "memory") {
 		_send_resource_usage();
+	} else if (p_cmd == "memory_tags") {
+		_send_memory_tag_usage();
+	} else if (p_cmd == "memory_sample_rate") {
+		ERR_FAIL_COND_V(p_data.size() < 1, ERR_INVALID_DATA);
+		Memory::set_alloc_sample_rate(int(p_data[0]));
+		Memory::clear_alloc_samples();
 	} else if (p_cmd == "break") {
 		script_debugger->debug(script_debugger->get_break_language());
 	} else {
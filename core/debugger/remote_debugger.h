@@ -98,6 +98,7 @@ private:
 	void flush_output();
 
 	void _send_resource_usage();
+	void _send_memory_tag_usage();
 	void _send_stack_vars(List<String> &p_names, List<Variant> &p_vals, int p_type);
 
 	Error _profiler_capture(const String &p_cmd, const Array &p_data, bool &r_captured);
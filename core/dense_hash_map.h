@@ -0,0 +1,652 @@
+/*************************************************************************/
+/*  dense_hash_map.h                                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef DENSE_HASH_MAP_H
+#define DENSE_HASH_MAP_H
+
+#include "core/error_macros.h"
+#include "core/hashfuncs.h"
+#include "core/list.h"
+#include "core/os/copymem.h"
+#include "core/os/memory.h"
+
+/**
+ * An insertion ordered HashMap that keeps its entries in a dense array.
+ *
+ * Key/value pairs are appended to a contiguous entry array, so iterating the
+ * map walks memory linearly and visits the pairs in the order they were
+ * inserted. Lookups go through a separate open addressing index (Robin Hood
+ * hashing with backward shift deletion, like OAHashMap) that only stores the
+ * hash and the position of each entry, keeping probes within a few cache lines.
+ *
+ * Erasing leaves a hole in the entry array, holes are skipped when iterating
+ * and only squeezed out when an insertion finds the array full. A third array
+ * lists the positions of the live entries in order, so access by index stays a
+ * plain array read with holes around.
+ *
+ * WARNING: Inserting may move the entries, pointers returned by getptr(),
+ * next() or operator[] are only valid until the next insertion. Erasing never
+ * moves the remaining entries.
+ */
+template <class TKey, class TValue,
+		class Hasher = HashMapHasherDefault,
+		class Comparator = HashMapComparatorDefault<TKey>>
+class DenseHashMap {
+public:
+	struct Entry {
+		TKey key;
+		TValue value;
+
+		Entry(const TKey &p_key, const TValue &p_value) :
+				key(p_key),
+				value(p_value) {}
+	};
+
+private:
+	Entry *entries = nullptr;
+	uint32_t *entry_hashes = nullptr; // EMPTY_HASH marks an erased entry.
+	uint32_t entry_count = 0; // Used entries, including erased ones.
+	uint32_t first_entry = 0; // Entries before this one are all erased.
+	uint32_t entry_capacity = 0;
+
+	// Positions of the live entries in insertion order, starting at order_first.
+	uint32_t *entry_order = nullptr;
+	uint32_t order_first = 0;
+
+	uint32_t *index_hashes = nullptr;
+	uint32_t *index_entries = nullptr;
+	uint32_t index_capacity = 0; // Always a power of two.
+
+	uint32_t num_elements = 0;
+
+	static const uint32_t EMPTY_HASH = 0;
+	static const uint32_t MIN_CAPACITY = 8;
+
+	_FORCE_INLINE_ uint32_t _hash(const TKey &p_key) const {
+		uint32_t hash = Hasher::hash(p_key);
+
+		if (hash == EMPTY_HASH) {
+			hash = EMPTY_HASH + 1;
+		}
+
+		return hash;
+	}
+
+	_FORCE_INLINE_ uint32_t _get_probe_length(uint32_t p_pos, uint32_t p_hash) const {
+		return (p_pos - p_hash) & (index_capacity - 1);
+	}
+
+	_FORCE_INLINE_ bool _lookup_pos(const TKey &p_key, uint32_t p_hash, uint32_t &r_pos) const {
+		if (unlikely(!index_capacity)) {
+			return false;
+		}
+
+		uint32_t mask = index_capacity - 1;
+		uint32_t pos = p_hash & mask;
+		uint32_t distance = 0;
+
+		while (true) {
+			uint32_t hash = index_hashes[pos];
+			if (hash == EMPTY_HASH) {
+				return false;
+			}
+
+			if (distance > _get_probe_length(pos, hash)) {
+				return false;
+			}
+
+			if (hash == p_hash && Comparator::compare(entries[index_entries[pos]].key, p_key)) {
+				r_pos = pos;
+				return true;
+			}
+
+			pos = (pos + 1) & mask;
+			distance++;
+		}
+	}
+
+	void _index_insert(uint32_t p_hash, uint32_t p_entry) {
+		uint32_t mask = index_capacity - 1;
+		uint32_t hash = p_hash;
+		uint32_t entry = p_entry;
+		uint32_t pos = hash & mask;
+		uint32_t distance = 0;
+
+		while (true) {
+			if (index_hashes[pos] == EMPTY_HASH) {
+				index_hashes[pos] = hash;
+				index_entries[pos] = entry;
+				return;
+			}
+
+			// Not an empty slot, let's check the probing length of the existing one.
+			uint32_t existing_probe_len = _get_probe_length(pos, index_hashes[pos]);
+			if (existing_probe_len < distance) {
+				SWAP(hash, index_hashes[pos]);
+				SWAP(entry, index_entries[pos]);
+				distance = existing_probe_len;
+			}
+
+			pos = (pos + 1) & mask;
+			distance++;
+		}
+	}
+
+	void _index_remove(uint32_t p_pos) {
+		uint32_t mask = index_capacity - 1;
+		uint32_t pos = p_pos;
+		uint32_t next_pos = (pos + 1) & mask;
+
+		while (index_hashes[next_pos] != EMPTY_HASH &&
+				_get_probe_length(next_pos, index_hashes[next_pos]) != 0) {
+			index_hashes[pos] = index_hashes[next_pos];
+			index_entries[pos] = index_entries[next_pos];
+			pos = next_pos;
+			next_pos = (pos + 1) & mask;
+		}
+
+		index_hashes[pos] = EMPTY_HASH;
+	}
+
+	void _rebuild_index(uint32_t p_capacity) {
+		if (p_capacity != index_capacity) {
+			if (index_capacity) {
+				Memory::free_static(index_hashes);
+				Memory::free_static(index_entries);
+			}
+			index_capacity = p_capacity;
+			index_hashes = static_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * index_capacity));
+			index_entries = static_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * index_capacity));
+		}
+
+		for (uint32_t i = 0; i < index_capacity; i++) {
+			index_hashes[i] = EMPTY_HASH;
+		}
+
+		for (uint32_t i = 0; i < entry_count; i++) {
+			if (entry_hashes[i] != EMPTY_HASH) {
+				_index_insert(entry_hashes[i], i);
+			}
+		}
+	}
+
+	void _reset_order() {
+		// Only called with the entries compacted, so live entries are the first ones.
+		for (uint32_t i = 0; i < entry_count; i++) {
+			entry_order[i] = i;
+		}
+		order_first = 0;
+	}
+
+	void _resize_entries(uint32_t p_capacity) {
+		Entry *new_entries = static_cast<Entry *>(Memory::alloc_static(sizeof(Entry) * p_capacity));
+		uint32_t *new_hashes = static_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * p_capacity));
+		uint32_t *new_order = static_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * p_capacity));
+
+		// Entries are relocated in order, erased ones are dropped on the way.
+		uint32_t count = 0;
+		for (uint32_t i = 0; i < entry_count; i++) {
+			if (entry_hashes[i] == EMPTY_HASH) {
+				continue;
+			}
+			memnew_placement(&new_entries[count], Entry(entries[i]));
+			new_hashes[count] = entry_hashes[i];
+			entries[i].~Entry();
+			count++;
+		}
+
+		if (entry_capacity) {
+			Memory::free_static(entries);
+			Memory::free_static(entry_hashes);
+			Memory::free_static(entry_order);
+		}
+
+		bool compacted = count != entry_count;
+
+		entries = new_entries;
+		entry_hashes = new_hashes;
+		entry_order = new_order;
+		entry_capacity = p_capacity;
+		entry_count = count;
+		first_entry = 0;
+		_reset_order();
+
+		if (compacted) {
+			_rebuild_index(index_capacity);
+		}
+	}
+
+	void _compact() {
+		uint32_t count = 0;
+		for (uint32_t i = 0; i < entry_count; i++) {
+			if (entry_hashes[i] == EMPTY_HASH) {
+				continue;
+			}
+			if (count != i) {
+				memnew_placement(&entries[count], Entry(entries[i]));
+				entries[i].~Entry();
+				entry_hashes[count] = entry_hashes[i];
+			}
+			count++;
+		}
+
+		entry_count = count;
+		first_entry = 0;
+		_reset_order();
+		_rebuild_index(index_capacity);
+	}
+
+	uint32_t _insert(uint32_t p_hash, const TKey &p_key, const TValue &p_value) {
+		if (num_elements + 1 > (index_capacity >> 1) + (index_capacity >> 2)) {
+			// Keep the index at most 75% full.
+			_rebuild_index(index_capacity ? index_capacity << 1 : MIN_CAPACITY);
+		}
+
+		uint32_t entry = entry_count;
+
+		if (entry_count == entry_capacity) {
+			// The pair may be read from the entries about to move, copy it first.
+			Entry pair(p_key, p_value);
+
+			if (entry_count - num_elements > (entry_count >> 1)) {
+				_compact();
+			} else {
+				_resize_entries(entry_capacity ? entry_capacity << 1 : MIN_CAPACITY);
+			}
+
+			entry = entry_count;
+			memnew_placement(&entries[entry], Entry(pair));
+		} else {
+			memnew_placement(&entries[entry], Entry(p_key, p_value));
+		}
+
+		if (order_first + num_elements == entry_capacity) {
+			// Erasing from the front moved the order to the end of its array.
+			movemem(entry_order, entry_order + order_first, sizeof(uint32_t) * num_elements);
+			order_first = 0;
+		}
+		entry_order[order_first + num_elements] = entry;
+
+		entry_count++;
+		entry_hashes[entry] = p_hash;
+		_index_insert(p_hash, entry);
+		num_elements++;
+
+		return entry;
+	}
+
+	_FORCE_INLINE_ uint32_t _entry_index(const TKey *p_key) const {
+		// Keys handed out by this map point into the entry array, which
+		// spares hashing the key again when iterating with next().
+		if (entry_count && p_key >= &entries[0].key && p_key <= &entries[entry_count - 1].key) {
+			return (reinterpret_cast<const uint8_t *>(p_key) - reinterpret_cast<const uint8_t *>(&entries[0].key)) / sizeof(Entry);
+		}
+
+		uint32_t pos = 0;
+		if (!_lookup_pos(*p_key, _hash(*p_key), pos)) {
+			return entry_count;
+		}
+		return index_entries[pos];
+	}
+
+	_FORCE_INLINE_ uint32_t _entry_at_index(uint32_t p_index) const {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, num_elements);
+		return entry_order[order_first + p_index];
+	}
+
+	void _order_remove(uint32_t p_entry) {
+		// Entries are never reordered, so the order is sorted by position.
+		uint32_t *order = entry_order + order_first;
+		uint32_t low = 0;
+		uint32_t high = num_elements;
+		while (low < high) {
+			uint32_t middle = (low + high) >> 1;
+			if (order[middle] < p_entry) {
+				low = middle + 1;
+			} else {
+				high = middle;
+			}
+		}
+
+		// Close the gap from whichever side is shorter.
+		if (low < num_elements - 1 - low) {
+			movemem(order + 1, order, sizeof(uint32_t) * low);
+			order_first++;
+		} else {
+			movemem(order + low, order + low + 1, sizeof(uint32_t) * (num_elements - 1 - low));
+		}
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+	_FORCE_INLINE_ bool empty() const { return num_elements == 0; }
+
+	void clear() {
+		for (uint32_t i = 0; i < entry_count; i++) {
+			if (entry_hashes[i] != EMPTY_HASH) {
+				entries[i].~Entry();
+			}
+		}
+
+		for (uint32_t i = 0; i < index_capacity; i++) {
+			index_hashes[i] = EMPTY_HASH;
+		}
+
+		entry_count = 0;
+		first_entry = 0;
+		order_first = 0;
+		num_elements = 0;
+	}
+
+	/**
+	 * Inserts the pair, or replaces the value if the key is already in the map.
+	 * Replacing keeps the original position in the insertion order.
+	 */
+	TValue *set(const TKey &p_key, const TValue &p_value) {
+		uint32_t hash = _hash(p_key);
+		uint32_t pos = 0;
+
+		if (_lookup_pos(p_key, hash, pos)) {
+			Entry &e = entries[index_entries[pos]];
+			e.value = p_value;
+			return &e.value;
+		}
+
+		uint32_t entry = _insert(hash, p_key, p_value);
+		return &entries[entry].value;
+	}
+
+	bool has(const TKey &p_key) const {
+		uint32_t pos = 0;
+		return _lookup_pos(p_key, _hash(p_key), pos);
+	}
+
+	/**
+	 * Get a value from the map, crashes if the key is not there.
+	 * Use getptr() and check for nullptr, or check with has() first.
+	 */
+	const TValue &get(const TKey &p_key) const {
+		const TValue *res = getptr(p_key);
+		CRASH_COND_MSG(!res, "Map key not found.");
+		return *res;
+	}
+
+	TValue &get(const TKey &p_key) {
+		TValue *res = getptr(p_key);
+		CRASH_COND_MSG(!res, "Map key not found.");
+		return *res;
+	}
+
+	_FORCE_INLINE_ TValue *getptr(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, _hash(p_key), pos)) {
+			return nullptr;
+		}
+		return &entries[index_entries[pos]].value;
+	}
+
+	_FORCE_INLINE_ const TValue *getptr(const TKey &p_key) const {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, _hash(p_key), pos)) {
+			return nullptr;
+		}
+		return &entries[index_entries[pos]].value;
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, _hash(p_key), pos)) {
+			return false;
+		}
+
+		// p_key may live in the entry being erased, so it's not touched past this point.
+		uint32_t entry = index_entries[pos];
+		_index_remove(pos);
+		_order_remove(entry);
+		entries[entry].~Entry();
+		entry_hashes[entry] = EMPTY_HASH;
+		num_elements--;
+
+		// Holes at either end are skipped right away, the ones in between stay
+		// until the next insertion that needs room. Not moving entries here lets
+		// a cursor walk survive erasing the key it is on.
+		while (entry_count && entry_hashes[entry_count - 1] == EMPTY_HASH) {
+			entry_count--;
+		}
+		while (first_entry < entry_count && entry_hashes[first_entry] == EMPTY_HASH) {
+			first_entry++;
+		}
+		if (first_entry > entry_count) {
+			first_entry = entry_count;
+		}
+
+		return true;
+	}
+
+	/**
+	 * Reserves space for a number of elements, useful to avoid many resizes
+	 * and rehashes when adding a known (possibly large) number of elements.
+	 */
+	void reserve(uint32_t p_elements) {
+		uint32_t capacity = next_power_of_2(MAX(p_elements, MIN_CAPACITY));
+		if (capacity > entry_capacity) {
+			_resize_entries(capacity);
+		}
+
+		// The index is kept at most 75% full.
+		uint32_t new_index_capacity = next_power_of_2(MAX(p_elements + (p_elements / 3) + 1, MIN_CAPACITY));
+		if (new_index_capacity > index_capacity) {
+			_rebuild_index(new_index_capacity);
+		}
+	}
+
+	/**
+	 * Returns the key following p_key in insertion order, or the first one if
+	 * p_key is nullptr. Returns nullptr past the last key.
+	 */
+	const TKey *next(const TKey *p_key) const {
+		uint32_t from = first_entry;
+		if (p_key) {
+			from = _entry_index(p_key) + 1;
+		}
+
+		for (uint32_t i = from; i < entry_count; i++) {
+			if (entry_hashes[i] != EMPTY_HASH) {
+				return &entries[i].key;
+			}
+		}
+
+		return nullptr;
+	}
+
+	/**
+	 * Cursors address the entry array directly, so stepping through the map
+	 * with them never hashes a key. Pass -1 to get the first cursor, -1 is
+	 * returned past the last entry. Erased entries are skipped. Cursors stay
+	 * valid when erasing, including the entry under the cursor, but like
+	 * pointers not across insertions.
+	 */
+	int next_cursor(int p_cursor) const {
+		for (uint32_t i = MAX((uint32_t)(p_cursor + 1), first_entry); i < entry_count; i++) {
+			if (entry_hashes[i] != EMPTY_HASH) {
+				return i;
+			}
+		}
+
+		return -1;
+	}
+
+	_FORCE_INLINE_ bool is_cursor_valid(int p_cursor) const {
+		return p_cursor >= 0 && (uint32_t)p_cursor < entry_count && entry_hashes[p_cursor] != EMPTY_HASH;
+	}
+
+	_FORCE_INLINE_ const TKey &get_key_at_cursor(int p_cursor) const {
+		CRASH_COND(!is_cursor_valid(p_cursor));
+		return entries[p_cursor].key;
+	}
+
+	_FORCE_INLINE_ TValue &get_value_at_cursor(int p_cursor) {
+		CRASH_COND(!is_cursor_valid(p_cursor));
+		return entries[p_cursor].value;
+	}
+
+	_FORCE_INLINE_ const TValue &get_value_at_cursor(int p_cursor) const {
+		CRASH_COND(!is_cursor_valid(p_cursor));
+		return entries[p_cursor].value;
+	}
+
+	/**
+	 * Access by position in insertion order, a plain array read.
+	 */
+	const TKey &get_key_at_index(uint32_t p_index) const {
+		return entries[_entry_at_index(p_index)].key;
+	}
+
+	TValue &get_value_at_index(uint32_t p_index) {
+		return entries[_entry_at_index(p_index)].value;
+	}
+
+	const TValue &get_value_at_index(uint32_t p_index) const {
+		return entries[_entry_at_index(p_index)].value;
+	}
+
+	void get_key_list(List<TKey> *p_keys) const {
+		for (uint32_t i = 0; i < entry_count; i++) {
+			if (entry_hashes[i] != EMPTY_HASH) {
+				p_keys->push_back(entries[i].key);
+			}
+		}
+	}
+
+	struct Iterator {
+		bool valid;
+
+		const TKey *key;
+		TValue *value;
+
+	private:
+		uint32_t pos;
+		friend class DenseHashMap;
+	};
+
+	Iterator iter() const {
+		Iterator it;
+
+		it.valid = true;
+		it.pos = first_entry;
+
+		return next_iter(it);
+	}
+
+	Iterator next_iter(const Iterator &p_iter) const {
+		if (!p_iter.valid) {
+			return p_iter;
+		}
+
+		Iterator it;
+		it.valid = false;
+		it.pos = p_iter.pos;
+		it.key = nullptr;
+		it.value = nullptr;
+
+		for (uint32_t i = it.pos; i < entry_count; i++) {
+			it.pos = i + 1;
+
+			if (entry_hashes[i] == EMPTY_HASH) {
+				continue;
+			}
+
+			it.valid = true;
+			it.key = &entries[i].key;
+			it.value = &entries[i].value;
+			return it;
+		}
+
+		return it;
+	}
+
+	inline const TValue &operator[](const TKey &p_key) const {
+		return get(p_key);
+	}
+
+	inline TValue &operator[](const TKey &p_key) {
+		uint32_t hash = _hash(p_key);
+		uint32_t pos = 0;
+
+		if (_lookup_pos(p_key, hash, pos)) {
+			return entries[index_entries[pos]].value;
+		}
+
+		uint32_t entry = _insert(hash, p_key, TValue());
+		return entries[entry].value;
+	}
+
+	DenseHashMap &operator=(const DenseHashMap &p_other) {
+		if (this == &p_other) {
+			return *this;
+		}
+
+		clear();
+		if (p_other.empty()) {
+			return *this;
+		}
+
+		reserve(p_other.num_elements);
+		for (uint32_t i = 0; i < p_other.entry_count; i++) {
+			if (p_other.entry_hashes[i] != EMPTY_HASH) {
+				_insert(p_other.entry_hashes[i], p_other.entries[i].key, p_other.entries[i].value);
+			}
+		}
+
+		return *this;
+	}
+
+	DenseHashMap(const DenseHashMap &p_other) {
+		(*this) = p_other;
+	}
+
+	DenseHashMap() {}
+
+	~DenseHashMap() {
+		clear();
+
+		if (entry_capacity) {
+			Memory::free_static(entries);
+			Memory::free_static(entry_hashes);
+			Memory::free_static(entry_order);
+		}
+		if (index_capacity) {
+			Memory::free_static(index_hashes);
+			Memory::free_static(index_entries);
+		}
+	}
+};
+
+#endif // DENSE_HASH_MAP_H
@@ -30,47 +30,42 @@
 
 #include "dictionary.h"
 
-#include "core/ordered_hash_map.h"
+#include "core/dense_hash_map.h"
+#include "core/paged_allocator.h"
 #include "core/safe_refcount.h"
 #include "core/variant.h"
 
 struct DictionaryPrivate {
 	SafeRefCount refcount;
-	OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator> variant_map;
+	DenseHashMap<Variant, Variant, VariantHasher, VariantComparator> variant_map;
 };
 
+static PagedAllocator<DictionaryPrivate, true> dictionary_pool;
+
 void Dictionary::get_key_list(List<Variant> *p_keys) const {
 	if (_p->variant_map.empty()) {
 		return;
 	}
 
-	for (OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::Element E = _p->variant_map.front(); E; E = E.next()) {
-		p_keys->push_back(E.key());
+	for (DenseHashMap<Variant, Variant, VariantHasher, VariantComparator>::Iterator E = _p->variant_map.iter(); E.valid; E = _p->variant_map.next_iter(E)) {
+		p_keys->push_back(*E.key);
 	}
 }
 
 Variant Dictionary::get_key_at_index(int p_index) const {
-	int index = 0;
-	for (OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::Element E = _p->variant_map.front(); E; E = E.next()) {
-		if (index == p_index) {
-			return E.key();
-		}
-		index++;
+	if (p_index < 0 || p_index >= size()) {
+		return Variant();
 	}
 
-	return Variant();
+	return _p->variant_map.get_key_at_index(p_index);
 }
 
 Variant Dictionary::get_value_at_index(int p_index) const {
-	int index = 0;
-	for (OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::Element E = _p->variant_map.front(); E; E = E.next()) {
-		if (index == p_index) {
-			return E.value();
-		}
-		index++;
+	if (p_index < 0 || p_index >= size()) {
+		return Variant();
 	}
 
-	return Variant();
+	return _p->variant_map.get_value_at_index(p_index);
 }
 
 Variant &Dictionary::operator[](const Variant &p_key) {
@@ -82,30 +77,19 @@ const Variant &Dictionary::operator[](const Variant &p_key) const {
 }
 
 const Variant *Dictionary::getptr(const Variant &p_key) const {
-	OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::ConstElement E = ((const OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator> *)&_p->variant_map)->find(p_key);
-
-	if (!E) {
-		return nullptr;
-	}
-	return &E.get();
+	return ((const DenseHashMap<Variant, Variant, VariantHasher, VariantComparator> *)&_p->variant_map)->getptr(p_key);
 }
 
 Variant *Dictionary::getptr(const Variant &p_key) {
-	OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::Element E = _p->variant_map.find(p_key);
-
-	if (!E) {
-		return nullptr;
-	}
-	return &E.get();
+	return _p->variant_map.getptr(p_key);
 }
 
 Variant Dictionary::get_valid(const Variant &p_key) const {
-	OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::ConstElement E = ((const OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator> *)&_p->variant_map)->find(p_key);
-
-	if (!E) {
+	const Variant *result = getptr(p_key);
+	if (!result) {
 		return Variant();
 	}
-	return E.get();
+	return *result;
 }
 
 Variant Dictionary::get(const Variant &p_key, const Variant &p_default) const {
@@ -174,7 +158,7 @@ void Dictionary::clear() {
 void Dictionary::_unref() const {
 	ERR_FAIL_COND(!_p);
 	if (_p->refcount.unref()) {
-		memdelete(_p);
+		dictionary_pool.free(_p);
 	}
 	_p = nullptr;
 }
@@ -182,9 +166,9 @@ void Dictionary::_unref() const {
 uint32_t Dictionary::hash() const {
 	uint32_t h = hash_djb2_one_32(Variant::DICTIONARY);
 
-	for (OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::Element E = _p->variant_map.front(); E; E = E.next()) {
-		h = hash_djb2_one_32(E.key().hash(), h);
-		h = hash_djb2_one_32(E.value().hash(), h);
+	for (DenseHashMap<Variant, Variant, VariantHasher, VariantComparator>::Iterator E = _p->variant_map.iter(); E.valid; E = _p->variant_map.next_iter(E)) {
+		h = hash_djb2_one_32(E.key->hash(), h);
+		h = hash_djb2_one_32(E.value->hash(), h);
 	}
 
 	return h;
@@ -199,8 +183,8 @@ Array Dictionary::keys() const {
 	varr.resize(size());
 
 	int i = 0;
-	for (OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::Element E = _p->variant_map.front(); E; E = E.next()) {
-		varr[i] = E.key();
+	for (DenseHashMap<Variant, Variant, VariantHasher, VariantComparator>::Iterator E = _p->variant_map.iter(); E.valid; E = _p->variant_map.next_iter(E)) {
+		varr[i] = *E.key;
 		i++;
 	}
 
@@ -216,8 +200,8 @@ Array Dictionary::values() const {
 	varr.resize(size());
 
 	int i = 0;
-	for (OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::Element E = _p->variant_map.front(); E; E = E.next()) {
-		varr[i] = E.get();
+	for (DenseHashMap<Variant, Variant, VariantHasher, VariantComparator>::Iterator E = _p->variant_map.iter(); E.valid; E = _p->variant_map.next_iter(E)) {
+		varr[i] = *E.value;
 		i++;
 	}
 
@@ -225,26 +209,25 @@ Array Dictionary::values() const {
 }
 
 const Variant *Dictionary::next(const Variant *p_key) const {
-	if (p_key == nullptr) {
-		// caller wants to get the first element
-		if (_p->variant_map.front()) {
-			return &_p->variant_map.front().key();
-		}
-		return nullptr;
-	}
-	OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::Element E = _p->variant_map.find(*p_key);
+	return _p->variant_map.next(p_key);
+}
 
-	if (E && E.next()) {
-		return &E.next().key();
+int Dictionary::next_cursor(int p_cursor) const {
+	return _p->variant_map.next_cursor(p_cursor);
+}
+
+const Variant *Dictionary::get_key_at_cursor(int p_cursor) const {
+	if (!_p->variant_map.is_cursor_valid(p_cursor)) {
+		return nullptr;
 	}
-	return nullptr;
+	return &_p->variant_map.get_key_at_cursor(p_cursor);
 }
 
 Dictionary Dictionary::duplicate(bool p_deep) const {
 	Dictionary n;
 
-	for (OrderedHashMap<Variant, Variant, VariantHasher, VariantComparator>::Element E = _p->variant_map.front(); E; E = E.next()) {
-		n[E.key()] = p_deep ? E.value().duplicate(true) : E.value();
+	for (DenseHashMap<Variant, Variant, VariantHasher, VariantComparator>::Iterator E = _p->variant_map.iter(); E.valid; E = _p->variant_map.next_iter(E)) {
+		n[*E.key] = p_deep ? E.value->duplicate(true) : *E.value;
 	}
 
 	return n;
@@ -255,7 +238,7 @@ void Dictionary::operator=(const Dictionary &p_dictionary) {
 }
 
 const void *Dictionary::id() const {
-	return _p->variant_map.id();
+	return &_p->variant_map;
 }
 
 Dictionary::Dictionary(const Dictionary &p_from) {
@@ -264,7 +247,7 @@ Dictionary::Dictionary(const Dictionary &p_from) {
 }
 
 Dictionary::Dictionary() {
-	_p = memnew(DictionaryPrivate);
+	_p = dictionary_pool.alloc();
 	_p->refcount.init();
 }
 
@@ -76,6 +76,10 @@ public:
 
 	const Variant *next(const Variant *p_key = nullptr) const;
 
+	// Cursors step through the entries without hashing keys, see DenseHashMap.
+	int next_cursor(int p_cursor = -1) const;
+	const Variant *get_key_at_cursor(int p_cursor) const;
+
 	Array keys() const;
 	Array values() const;
 
@@ -36,6 +36,8 @@
 #include "core/io/resource_loader.h"
 #include "core/math/math_funcs.h"
 #include "core/os/copymem.h"
+#include "core/os/os.h"
+#include "core/os/threaded_array_processor.h"
 #include "core/print_string.h"
 
 #include <stdio.h>
@@ -88,6 +90,8 @@ SaveEXRFunc Image::save_exr_func = nullptr;
 
 SavePNGBufferFunc Image::save_png_buffer_func = nullptr;
 
+uint32_t Image::processing_thread_count = 0;
+
 void Image::_put_pixelb(int p_x, int p_y, uint32_t p_pixelsize, uint8_t *p_data, const uint8_t *p_pixel) {
 	uint32_t ofs = (p_y * width + p_x) * p_pixelsize;
 
@@ -387,6 +391,98 @@ int Image::get_mipmap_count() const {
 	}
 }
 
+// Images with fewer pixels than this are processed on the calling thread,
+// as starting the worker threads would take longer than the work itself.
+#define IMAGE_THREADED_MIN_PIXELS (256 * 256)
+
+// Splits a per-row operation into bands of rows processed by worker threads.
+// Every row is written by exactly one band, so the result does not depend on the thread count.
+struct _ImageRowBands {
+	uint32_t rows = 0;
+	uint32_t band_rows = 0;
+
+	virtual void process_rows(uint32_t p_from, uint32_t p_to) = 0;
+
+	void process_band(uint32_t p_band, void *p_userdata) {
+		uint32_t from = p_band * band_rows;
+		process_rows(from, MIN(from + band_rows, rows));
+	}
+
+	void run(uint32_t p_rows, uint32_t p_row_pixels) {
+		rows = p_rows;
+
+		uint32_t thread_count = Image::processing_thread_count;
+		if (thread_count == 0) {
+			thread_count = thread_process_get_thread_count();
+		}
+		if (thread_count < 2 || p_rows < 2 || uint64_t(p_rows) * p_row_pixels < IMAGE_THREADED_MIN_PIXELS) {
+			process_rows(0, p_rows);
+			return;
+		}
+
+		// A few bands per thread keeps them busy when some rows are more expensive than others.
+		uint32_t bands = MIN(p_rows, thread_count * 4);
+		band_rows = (p_rows + bands - 1) / bands;
+		bands = (p_rows + band_rows - 1) / band_rows;
+
+		thread_process_array(bands, this, &_ImageRowBands::process_band, (void *)nullptr);
+	}
+
+	virtual ~_ImageRowBands() {}
+};
+
+typedef void (*_ImageScaleFunc)(const uint8_t *p_src, uint8_t *p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_row_from, uint32_t p_dst_row_to);
+
+struct _ImageScaleRows : public _ImageRowBands {
+	_ImageScaleFunc func;
+	const uint8_t *src;
+	uint8_t *dst;
+	uint32_t src_width;
+	uint32_t src_height;
+	uint32_t dst_width;
+	uint32_t dst_height;
+
+	virtual void process_rows(uint32_t p_from, uint32_t p_to) {
+		func(src, dst, src_width, src_height, dst_width, dst_height, p_from, p_to);
+	}
+};
+
+static void _scale_threaded(_ImageScaleFunc p_func, const uint8_t *p_src, uint8_t *p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	_ImageScaleRows scale;
+	scale.func = p_func;
+	scale.src = p_src;
+	scale.dst = p_dst;
+	scale.src_width = p_src_width;
+	scale.src_height = p_src_height;
+	scale.dst_width = p_dst_width;
+	scale.dst_height = p_dst_height;
+	scale.run(p_dst_height, p_dst_width);
+}
+
+template <class Component>
+struct _ImageMipmapRows : public _ImageRowBands {
+	void (*func)(const Component *, Component *, uint32_t, uint32_t, uint32_t, uint32_t);
+	const Component *src;
+	Component *dst;
+	uint32_t width;
+	uint32_t height;
+
+	virtual void process_rows(uint32_t p_from, uint32_t p_to) {
+		func(src, dst, width, height, p_from, p_to);
+	}
+};
+
+template <class Component>
+static void _generate_po2_mipmap_threaded(void (*p_func)(const Component *, Component *, uint32_t, uint32_t, uint32_t, uint32_t), const Component *p_src, Component *p_dst, uint32_t p_width, uint32_t p_height) {
+	_ImageMipmapRows<Component> mipmap;
+	mipmap.func = p_func;
+	mipmap.src = p_src;
+	mipmap.dst = p_dst;
+	mipmap.width = p_width;
+	mipmap.height = p_height;
+	mipmap.run(MAX(p_height >> 1, 1), MAX(p_width >> 1, 1));
+}
+
 //using template generates perfectly optimized code due to constant expression reduction and unused variable removal present in all compilers
 template <uint32_t read_bytes, bool read_alpha, uint32_t write_bytes, bool write_alpha, bool read_gray, bool write_gray>
 static void _convert(int p_width, int p_height, const uint8_t *p_src, uint8_t *p_dst) {
@@ -429,6 +525,33 @@ static void _convert(int p_width, int p_height, const uint8_t *p_src, uint8_t *p
 	}
 }
 
+struct _ImageConvertRows : public _ImageRowBands {
+	void (*func)(int, int, const uint8_t *, uint8_t *);
+	int width;
+	const uint8_t *src;
+	uint8_t *dst;
+	int src_pixel_size;
+	int dst_pixel_size;
+
+	virtual void process_rows(uint32_t p_from, uint32_t p_to) {
+		func(width, p_to - p_from, src + p_from * width * src_pixel_size, dst + p_from * width * dst_pixel_size);
+	}
+};
+
+struct _ImageConvertPixelRows : public _ImageRowBands {
+	const Image *src;
+	Image *dst;
+
+	virtual void process_rows(uint32_t p_from, uint32_t p_to) {
+		int w = src->get_width();
+		for (uint32_t j = p_from; j < p_to; j++) {
+			for (int i = 0; i < w; i++) {
+				dst->set_pixel(i, j, src->get_pixel(i, j));
+			}
+		}
+	}
+};
+
 void Image::convert(Format p_new_format) {
 	if (data.size() == 0) {
 		return;
@@ -445,11 +568,10 @@ void Image::convert(Format p_new_format) {
 		//use put/set pixel which is slower but works with non byte formats
 		Image new_img(width, height, false, p_new_format);
 
-		for (int i = 0; i < width; i++) {
-			for (int j = 0; j < height; j++) {
-				new_img.set_pixel(i, j, get_pixel(i, j));
-			}
-		}
+		_ImageConvertPixelRows conv;
+		conv.src = this;
+		conv.dst = &new_img;
+		conv.run(height, width);
 
 		if (has_mipmaps()) {
 			new_img.generate_mipmaps();
@@ -465,101 +587,114 @@ void Image::convert(Format p_new_format) {
 	const uint8_t *rptr = data.ptr();
 	uint8_t *wptr = new_img.data.ptrw();
 
+	void (*convert_func)(int, int, const uint8_t *, uint8_t *) = nullptr;
+
 	int conversion_type = format | p_new_format << 8;
 
 	switch (conversion_type) {
 		case FORMAT_L8 | (FORMAT_LA8 << 8):
-			_convert<1, false, 1, true, true, true>(width, height, rptr, wptr);
+			convert_func = _convert<1, false, 1, true, true, true>;
 			break;
 		case FORMAT_L8 | (FORMAT_R8 << 8):
-			_convert<1, false, 1, false, true, false>(width, height, rptr, wptr);
+			convert_func = _convert<1, false, 1, false, true, false>;
 			break;
 		case FORMAT_L8 | (FORMAT_RG8 << 8):
-			_convert<1, false, 2, false, true, false>(width, height, rptr, wptr);
+			convert_func = _convert<1, false, 2, false, true, false>;
 			break;
 		case FORMAT_L8 | (FORMAT_RGB8 << 8):
-			_convert<1, false, 3, false, true, false>(width, height, rptr, wptr);
+			convert_func = _convert<1, false, 3, false, true, false>;
 			break;
 		case FORMAT_L8 | (FORMAT_RGBA8 << 8):
-			_convert<1, false, 3, true, true, false>(width, height, rptr, wptr);
+			convert_func = _convert<1, false, 3, true, true, false>;
 			break;
 		case FORMAT_LA8 | (FORMAT_L8 << 8):
-			_convert<1, true, 1, false, true, true>(width, height, rptr, wptr);
+			convert_func = _convert<1, true, 1, false, true, true>;
 			break;
 		case FORMAT_LA8 | (FORMAT_R8 << 8):
-			_convert<1, true, 1, false, true, false>(width, height, rptr, wptr);
+			convert_func = _convert<1, true, 1, false, true, false>;
 			break;
 		case FORMAT_LA8 | (FORMAT_RG8 << 8):
-			_convert<1, true, 2, false, true, false>(width, height, rptr, wptr);
+			convert_func = _convert<1, true, 2, false, true, false>;
 			break;
 		case FORMAT_LA8 | (FORMAT_RGB8 << 8):
-			_convert<1, true, 3, false, true, false>(width, height, rptr, wptr);
+			convert_func = _convert<1, true, 3, false, true, false>;
 			break;
 		case FORMAT_LA8 | (FORMAT_RGBA8 << 8):
-			_convert<1, true, 3, true, true, false>(width, height, rptr, wptr);
+			convert_func = _convert<1, true, 3, true, true, false>;
 			break;
 		case FORMAT_R8 | (FORMAT_L8 << 8):
-			_convert<1, false, 1, false, false, true>(width, height, rptr, wptr);
+			convert_func = _convert<1, false, 1, false, false, true>;
 			break;
 		case FORMAT_R8 | (FORMAT_LA8 << 8):
-			_convert<1, false, 1, true, false, true>(width, height, rptr, wptr);
+			convert_func = _convert<1, false, 1, true, false, true>;
 			break;
 		case FORMAT_R8 | (FORMAT_RG8 << 8):
-			_convert<1, false, 2, false, false, false>(width, height, rptr, wptr);
+			convert_func = _convert<1, false, 2, false, false, false>;
 			break;
 		case FORMAT_R8 | (FORMAT_RGB8 << 8):
-			_convert<1, false, 3, false, false, false>(width, height, rptr, wptr);
+			convert_func = _convert<1, false, 3, false, false, false>;
 			break;
 		case FORMAT_R8 | (FORMAT_RGBA8 << 8):
-			_convert<1, false, 3, true, false, false>(width, height, rptr, wptr);
+			convert_func = _convert<1, false, 3, true, false, false>;
 			break;
 		case FORMAT_RG8 | (FORMAT_L8 << 8):
-			_convert<2, false, 1, false, false, true>(width, height, rptr, wptr);
+			convert_func = _convert<2, false, 1, false, false, true>;
 			break;
 		case FORMAT_RG8 | (FORMAT_LA8 << 8):
-			_convert<2, false, 1, true, false, true>(width, height, rptr, wptr);
+			convert_func = _convert<2, false, 1, true, false, true>;
 			break;
 		case FORMAT_RG8 | (FORMAT_R8 << 8):
-			_convert<2, false, 1, false, false, false>(width, height, rptr, wptr);
+			convert_func = _convert<2, false, 1, false, false, false>;
 			break;
 		case FORMAT_RG8 | (FORMAT_RGB8 << 8):
-			_convert<2, false, 3, false, false, false>(width, height, rptr, wptr);
+			convert_func = _convert<2, false, 3, false, false, false>;
 			break;
 		case FORMAT_RG8 | (FORMAT_RGBA8 << 8):
-			_convert<2, false, 3, true, false, false>(width, height, rptr, wptr);
+			convert_func = _convert<2, false, 3, true, false, false>;
 			break;
 		case FORMAT_RGB8 | (FORMAT_L8 << 8):
-			_convert<3, false, 1, false, false, true>(width, height, rptr, wptr);
+			convert_func = _convert<3, false, 1, false, false, true>;
 			break;
 		case FORMAT_RGB8 | (FORMAT_LA8 << 8):
-			_convert<3, false, 1, true, false, true>(width, height, rptr, wptr);
+			convert_func = _convert<3, false, 1, true, false, true>;
 			break;
 		case FORMAT_RGB8 | (FORMAT_R8 << 8):
-			_convert<3, false, 1, false, false, false>(width, height, rptr, wptr);
+			convert_func = _convert<3, false, 1, false, false, false>;
 			break;
 		case FORMAT_RGB8 | (FORMAT_RG8 << 8):
-			_convert<3, false, 2, false, false, false>(width, height, rptr, wptr);
+			convert_func = _convert<3, false, 2, false, false, false>;
 			break;
 		case FORMAT_RGB8 | (FORMAT_RGBA8 << 8):
-			_convert<3, false, 3, true, false, false>(width, height, rptr, wptr);
+			convert_func = _convert<3, false, 3, true, false, false>;
 			break;
 		case FORMAT_RGBA8 | (FORMAT_L8 << 8):
-			_convert<3, true, 1, false, false, true>(width, height, rptr, wptr);
+			convert_func = _convert<3, true, 1, false, false, true>;
 			break;
 		case FORMAT_RGBA8 | (FORMAT_LA8 << 8):
-			_convert<3, true, 1, true, false, true>(width, height, rptr, wptr);
+			convert_func = _convert<3, true, 1, true, false, true>;
 			break;
 		case FORMAT_RGBA8 | (FORMAT_R8 << 8):
-			_convert<3, true, 1, false, false, false>(width, height, rptr, wptr);
+			convert_func = _convert<3, true, 1, false, false, false>;
 			break;
 		case FORMAT_RGBA8 | (FORMAT_RG8 << 8):
-			_convert<3, true, 2, false, false, false>(width, height, rptr, wptr);
+			convert_func = _convert<3, true, 2, false, false, false>;
 			break;
 		case FORMAT_RGBA8 | (FORMAT_RGB8 << 8):
-			_convert<3, true, 3, false, false, false>(width, height, rptr, wptr);
+			convert_func = _convert<3, true, 3, false, false, false>;
 			break;
 	}
 
+	if (convert_func) {
+		_ImageConvertRows conv;
+		conv.func = convert_func;
+		conv.width = width;
+		conv.src = rptr;
+		conv.dst = wptr;
+		conv.src_pixel_size = get_format_pixel_size(format);
+		conv.dst_pixel_size = get_format_pixel_size(p_new_format);
+		conv.run(height, width);
+	}
+
 	bool gen_mipmaps = mipmaps;
 
 	_copy_internals_from(new_img);
@@ -588,7 +723,7 @@ static double _bicubic_interp_kernel(double x) {
 }
 
 template <int CC, class T>
-static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_row_from, uint32_t p_dst_row_to) {
 	// get source image size
 	int width = p_src_width;
 	int height = p_src_height;
@@ -603,7 +738,7 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 	int xmax = width - 1;
 	// temporary pointer
 
-	for (uint32_t y = 0; y < p_dst_height; y++) {
+	for (uint32_t y = p_dst_row_from; y < p_dst_row_to; y++) {
 		// Y coordinates
 		oy = (double)y * yfac - 0.5f;
 		oy1 = (int)oy;
@@ -675,7 +810,7 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 }
 
 template <int CC, class T>
-static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_row_from, uint32_t p_dst_row_to) {
 	enum {
 		FRAC_BITS = 8,
 		FRAC_LEN = (1 << FRAC_BITS),
@@ -683,7 +818,7 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 		FRAC_MASK = FRAC_LEN - 1
 	};
 
-	for (uint32_t i = 0; i < p_dst_height; i++) {
+	for (uint32_t i = p_dst_row_from; i < p_dst_row_to; i++) {
 		// Add 0.5 in order to interpolate based on pixel center
 		uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
 		// Calculate nearest src pixel center above current, and truncate to get y index
@@ -765,8 +900,8 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 }
 
 template <int CC, class T>
-static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
-	for (uint32_t i = 0; i < p_dst_height; i++) {
+static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_row_from, uint32_t p_dst_row_to) {
+	for (uint32_t i = p_dst_row_from; i < p_dst_row_to; i++) {
 		uint32_t src_yofs = i * p_src_height / p_dst_height;
 		uint32_t y_ofs = src_yofs * p_src_width * CC;
 
@@ -992,47 +1127,47 @@ void Image::resize(int p_width, int p_height, Interpolation p_interpolation) {
 			if (format >= FORMAT_L8 && format <= FORMAT_RGBA8) {
 				switch (get_format_pixel_size(format)) {
 					case 1:
-						_scale_nearest<1, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_nearest<1, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 2:
-						_scale_nearest<2, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_nearest<2, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 3:
-						_scale_nearest<3, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_nearest<3, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_nearest<4, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_nearest<4, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			} else if (format >= FORMAT_RF && format <= FORMAT_RGBAF) {
 				switch (get_format_pixel_size(format)) {
 					case 4:
-						_scale_nearest<1, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_nearest<1, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_nearest<2, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_nearest<2, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 12:
-						_scale_nearest<3, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_nearest<3, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 16:
-						_scale_nearest<4, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_nearest<4, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 
 			} else if (format >= FORMAT_RH && format <= FORMAT_RGBAH) {
 				switch (get_format_pixel_size(format)) {
 					case 2:
-						_scale_nearest<1, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_nearest<1, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_nearest<2, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_nearest<2, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 6:
-						_scale_nearest<3, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_nearest<3, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_nearest<4, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_nearest<4, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			}
@@ -1079,46 +1214,46 @@ void Image::resize(int p_width, int p_height, Interpolation p_interpolation) {
 				if (format >= FORMAT_L8 && format <= FORMAT_RGBA8) {
 					switch (get_format_pixel_size(format)) {
 						case 1:
-							_scale_bilinear<1, uint8_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded(_scale_bilinear<1, uint8_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 2:
-							_scale_bilinear<2, uint8_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded(_scale_bilinear<2, uint8_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 3:
-							_scale_bilinear<3, uint8_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded(_scale_bilinear<3, uint8_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 4:
-							_scale_bilinear<4, uint8_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded(_scale_bilinear<4, uint8_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 					}
 				} else if (format >= FORMAT_RF && format <= FORMAT_RGBAF) {
 					switch (get_format_pixel_size(format)) {
 						case 4:
-							_scale_bilinear<1, float>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded(_scale_bilinear<1, float>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 8:
-							_scale_bilinear<2, float>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded(_scale_bilinear<2, float>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 12:
-							_scale_bilinear<3, float>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded(_scale_bilinear<3, float>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 16:
-							_scale_bilinear<4, float>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded(_scale_bilinear<4, float>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 					}
 				} else if (format >= FORMAT_RH && format <= FORMAT_RGBAH) {
 					switch (get_format_pixel_size(format)) {
 						case 2:
-							_scale_bilinear<1, uint16_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded(_scale_bilinear<1, uint16_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 4:
-							_scale_bilinear<2, uint16_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded(_scale_bilinear<2, uint16_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 6:
-							_scale_bilinear<3, uint16_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded(_scale_bilinear<3, uint16_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 8:
-							_scale_bilinear<4, uint16_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded(_scale_bilinear<4, uint16_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 					}
 				}
@@ -1135,46 +1270,46 @@ void Image::resize(int p_width, int p_height, Interpolation p_interpolation) {
 			if (format >= FORMAT_L8 && format <= FORMAT_RGBA8) {
 				switch (get_format_pixel_size(format)) {
 					case 1:
-						_scale_cubic<1, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_cubic<1, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 2:
-						_scale_cubic<2, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_cubic<2, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 3:
-						_scale_cubic<3, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_cubic<3, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_cubic<4, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_cubic<4, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			} else if (format >= FORMAT_RF && format <= FORMAT_RGBAF) {
 				switch (get_format_pixel_size(format)) {
 					case 4:
-						_scale_cubic<1, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_cubic<1, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_cubic<2, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_cubic<2, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 12:
-						_scale_cubic<3, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_cubic<3, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 16:
-						_scale_cubic<4, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_cubic<4, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			} else if (format >= FORMAT_RH && format <= FORMAT_RGBAH) {
 				switch (get_format_pixel_size(format)) {
 					case 2:
-						_scale_cubic<1, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_cubic<1, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_cubic<2, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_cubic<2, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 6:
-						_scale_cubic<3, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_cubic<3, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_cubic<4, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded(_scale_cubic<4, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			}
@@ -1414,15 +1549,14 @@ bool Image::_can_modify(Format p_format) const {
 template <class Component, int CC, bool renormalize,
 		void (*average_func)(Component &, const Component &, const Component &, const Component &, const Component &),
 		void (*renormalize_func)(Component *)>
-static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint32_t p_width, uint32_t p_height) {
+static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint32_t p_width, uint32_t p_height, uint32_t p_dst_row_from, uint32_t p_dst_row_to) {
 	//fast power of 2 mipmap generation
 	uint32_t dst_w = MAX(p_width >> 1, 1);
-	uint32_t dst_h = MAX(p_height >> 1, 1);
 
 	int right_step = (p_width == 1) ? 0 : CC;
 	int down_step = (p_height == 1) ? 0 : (p_width * CC);
 
-	for (uint32_t i = 0; i < dst_h; i++) {
+	for (uint32_t i = p_dst_row_from; i < p_dst_row_to; i++) {
 		const Component *rup_ptr = &p_src[i * 2 * down_step];
 		const Component *rdown_ptr = rup_ptr + down_step;
 		Component *dst_ptr = &p_dst[i * dst_w * CC];
@@ -1445,6 +1579,42 @@ static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint3
 	}
 }
 
+// Same result as _generate_po2_mipmap<uint8_t, 4, false, ...>, but averages all four channels
+// of a pixel at once by spreading them into the 16-bit lanes of a 64-bit integer.
+static _FORCE_INLINE_ uint64_t _rgba8_to_lanes(uint32_t p_pixel) {
+	uint64_t v = p_pixel;
+	return (v | (v << 24)) & 0x00FF00FF00FF00FFULL;
+}
+
+static _FORCE_INLINE_ uint32_t _lanes_to_rgba8(uint64_t p_lanes) {
+	return uint32_t(p_lanes | (p_lanes >> 24));
+}
+
+static void _generate_po2_mipmap_rgba8(const uint8_t *p_src, uint8_t *p_dst, uint32_t p_width, uint32_t p_height, uint32_t p_dst_row_from, uint32_t p_dst_row_to) {
+	uint32_t dst_w = MAX(p_width >> 1, 1);
+
+	int right_step = (p_width == 1) ? 0 : 1;
+	int down_step = (p_height == 1) ? 0 : p_width;
+
+	const uint32_t *src = reinterpret_cast<const uint32_t *>(p_src);
+	uint32_t *dst = reinterpret_cast<uint32_t *>(p_dst);
+
+	for (uint32_t i = p_dst_row_from; i < p_dst_row_to; i++) {
+		const uint32_t *rup_ptr = &src[i * 2 * down_step];
+		const uint32_t *rdown_ptr = rup_ptr + down_step;
+		uint32_t *dst_ptr = &dst[i * dst_w];
+
+		for (uint32_t j = 0; j < dst_w; j++) {
+			uint64_t sum = _rgba8_to_lanes(rup_ptr[0]) + _rgba8_to_lanes(rup_ptr[right_step]) + _rgba8_to_lanes(rdown_ptr[0]) + _rgba8_to_lanes(rdown_ptr[right_step]);
+			*dst_ptr = _lanes_to_rgba8(((sum + 0x0002000200020002ULL) >> 2) & 0x00FF00FF00FF00FFULL);
+
+			dst_ptr++;
+			rup_ptr += right_step * 2;
+			rdown_ptr += right_step * 2;
+		}
+	}
+}
+
 void Image::shrink_x2() {
 	ERR_FAIL_COND(data.size() == 0);
 
@@ -1485,49 +1655,49 @@ void Image::shrink_x2() {
 			switch (format) {
 				case FORMAT_L8:
 				case FORMAT_R8:
-					_generate_po2_mipmap<uint8_t, 1, false, Image::average_4_uint8, Image::renormalize_uint8>(r, w, width, height);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint8_t, 1, false, Image::average_4_uint8, Image::renormalize_uint8>, r, w, width, height);
 					break;
 				case FORMAT_LA8:
-					_generate_po2_mipmap<uint8_t, 2, false, Image::average_4_uint8, Image::renormalize_uint8>(r, w, width, height);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint8_t, 2, false, Image::average_4_uint8, Image::renormalize_uint8>, r, w, width, height);
 					break;
 				case FORMAT_RG8:
-					_generate_po2_mipmap<uint8_t, 2, false, Image::average_4_uint8, Image::renormalize_uint8>(r, w, width, height);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint8_t, 2, false, Image::average_4_uint8, Image::renormalize_uint8>, r, w, width, height);
 					break;
 				case FORMAT_RGB8:
-					_generate_po2_mipmap<uint8_t, 3, false, Image::average_4_uint8, Image::renormalize_uint8>(r, w, width, height);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint8_t, 3, false, Image::average_4_uint8, Image::renormalize_uint8>, r, w, width, height);
 					break;
 				case FORMAT_RGBA8:
-					_generate_po2_mipmap<uint8_t, 4, false, Image::average_4_uint8, Image::renormalize_uint8>(r, w, width, height);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap_rgba8, r, w, width, height);
 					break;
 
 				case FORMAT_RF:
-					_generate_po2_mipmap<float, 1, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(r), reinterpret_cast<float *>(w), width, height);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<float, 1, false, Image::average_4_float, Image::renormalize_float>, reinterpret_cast<const float *>(r), reinterpret_cast<float *>(w), width, height);
 					break;
 				case FORMAT_RGF:
-					_generate_po2_mipmap<float, 2, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(r), reinterpret_cast<float *>(w), width, height);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<float, 2, false, Image::average_4_float, Image::renormalize_float>, reinterpret_cast<const float *>(r), reinterpret_cast<float *>(w), width, height);
 					break;
 				case FORMAT_RGBF:
-					_generate_po2_mipmap<float, 3, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(r), reinterpret_cast<float *>(w), width, height);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<float, 3, false, Image::average_4_float, Image::renormalize_float>, reinterpret_cast<const float *>(r), reinterpret_cast<float *>(w), width, height);
 					break;
 				case FORMAT_RGBAF:
-					_generate_po2_mipmap<float, 4, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(r), reinterpret_cast<float *>(w), width, height);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<float, 4, false, Image::average_4_float, Image::renormalize_float>, reinterpret_cast<const float *>(r), reinterpret_cast<float *>(w), width, height);
 					break;
 
 				case FORMAT_RH:
-					_generate_po2_mipmap<uint16_t, 1, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(r), reinterpret_cast<uint16_t *>(w), width, height);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint16_t, 1, false, Image::average_4_half, Image::renormalize_half>, reinterpret_cast<const uint16_t *>(r), reinterpret_cast<uint16_t *>(w), width, height);
 					break;
 				case FORMAT_RGH:
-					_generate_po2_mipmap<uint16_t, 2, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(r), reinterpret_cast<uint16_t *>(w), width, height);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint16_t, 2, false, Image::average_4_half, Image::renormalize_half>, reinterpret_cast<const uint16_t *>(r), reinterpret_cast<uint16_t *>(w), width, height);
 					break;
 				case FORMAT_RGBH:
-					_generate_po2_mipmap<uint16_t, 3, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(r), reinterpret_cast<uint16_t *>(w), width, height);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint16_t, 3, false, Image::average_4_half, Image::renormalize_half>, reinterpret_cast<const uint16_t *>(r), reinterpret_cast<uint16_t *>(w), width, height);
 					break;
 				case FORMAT_RGBAH:
-					_generate_po2_mipmap<uint16_t, 4, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(r), reinterpret_cast<uint16_t *>(w), width, height);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint16_t, 4, false, Image::average_4_half, Image::renormalize_half>, reinterpret_cast<const uint16_t *>(r), reinterpret_cast<uint16_t *>(w), width, height);
 					break;
 
 				case FORMAT_RGBE9995:
-					_generate_po2_mipmap<uint32_t, 1, false, Image::average_4_rgbe9995, Image::renormalize_rgbe9995>(reinterpret_cast<const uint32_t *>(r), reinterpret_cast<uint32_t *>(w), width, height);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint32_t, 1, false, Image::average_4_rgbe9995, Image::renormalize_rgbe9995>, reinterpret_cast<const uint32_t *>(r), reinterpret_cast<uint32_t *>(w), width, height);
 					break;
 				default: {
 				}
@@ -1589,76 +1759,76 @@ Error Image::generate_mipmaps(bool p_renormalize) {
 		switch (format) {
 			case FORMAT_L8:
 			case FORMAT_R8:
-				_generate_po2_mipmap<uint8_t, 1, false, Image::average_4_uint8, Image::renormalize_uint8>(&wp[prev_ofs], &wp[ofs], prev_w, prev_h);
+				_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint8_t, 1, false, Image::average_4_uint8, Image::renormalize_uint8>, &wp[prev_ofs], &wp[ofs], prev_w, prev_h);
 				break;
 			case FORMAT_LA8:
 			case FORMAT_RG8:
-				_generate_po2_mipmap<uint8_t, 2, false, Image::average_4_uint8, Image::renormalize_uint8>(&wp[prev_ofs], &wp[ofs], prev_w, prev_h);
+				_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint8_t, 2, false, Image::average_4_uint8, Image::renormalize_uint8>, &wp[prev_ofs], &wp[ofs], prev_w, prev_h);
 				break;
 			case FORMAT_RGB8:
 				if (p_renormalize) {
-					_generate_po2_mipmap<uint8_t, 3, true, Image::average_4_uint8, Image::renormalize_uint8>(&wp[prev_ofs], &wp[ofs], prev_w, prev_h);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint8_t, 3, true, Image::average_4_uint8, Image::renormalize_uint8>, &wp[prev_ofs], &wp[ofs], prev_w, prev_h);
 				} else {
-					_generate_po2_mipmap<uint8_t, 3, false, Image::average_4_uint8, Image::renormalize_uint8>(&wp[prev_ofs], &wp[ofs], prev_w, prev_h);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint8_t, 3, false, Image::average_4_uint8, Image::renormalize_uint8>, &wp[prev_ofs], &wp[ofs], prev_w, prev_h);
 				}
 
 				break;
 			case FORMAT_RGBA8:
 				if (p_renormalize) {
-					_generate_po2_mipmap<uint8_t, 4, true, Image::average_4_uint8, Image::renormalize_uint8>(&wp[prev_ofs], &wp[ofs], prev_w, prev_h);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint8_t, 4, true, Image::average_4_uint8, Image::renormalize_uint8>, &wp[prev_ofs], &wp[ofs], prev_w, prev_h);
 				} else {
-					_generate_po2_mipmap<uint8_t, 4, false, Image::average_4_uint8, Image::renormalize_uint8>(&wp[prev_ofs], &wp[ofs], prev_w, prev_h);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap_rgba8, &wp[prev_ofs], &wp[ofs], prev_w, prev_h);
 				}
 				break;
 			case FORMAT_RF:
-				_generate_po2_mipmap<float, 1, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
+				_generate_po2_mipmap_threaded(_generate_po2_mipmap<float, 1, false, Image::average_4_float, Image::renormalize_float>, reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
 				break;
 			case FORMAT_RGF:
-				_generate_po2_mipmap<float, 2, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
+				_generate_po2_mipmap_threaded(_generate_po2_mipmap<float, 2, false, Image::average_4_float, Image::renormalize_float>, reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
 				break;
 			case FORMAT_RGBF:
 				if (p_renormalize) {
-					_generate_po2_mipmap<float, 3, true, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<float, 3, true, Image::average_4_float, Image::renormalize_float>, reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
 				} else {
-					_generate_po2_mipmap<float, 3, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<float, 3, false, Image::average_4_float, Image::renormalize_float>, reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
 				}
 
 				break;
 			case FORMAT_RGBAF:
 				if (p_renormalize) {
-					_generate_po2_mipmap<float, 4, true, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<float, 4, true, Image::average_4_float, Image::renormalize_float>, reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
 				} else {
-					_generate_po2_mipmap<float, 4, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<float, 4, false, Image::average_4_float, Image::renormalize_float>, reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
 				}
 
 				break;
 			case FORMAT_RH:
-				_generate_po2_mipmap<uint16_t, 1, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
+				_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint16_t, 1, false, Image::average_4_half, Image::renormalize_half>, reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
 				break;
 			case FORMAT_RGH:
-				_generate_po2_mipmap<uint16_t, 2, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
+				_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint16_t, 2, false, Image::average_4_half, Image::renormalize_half>, reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
 				break;
 			case FORMAT_RGBH:
 				if (p_renormalize) {
-					_generate_po2_mipmap<uint16_t, 3, true, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint16_t, 3, true, Image::average_4_half, Image::renormalize_half>, reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
 				} else {
-					_generate_po2_mipmap<uint16_t, 3, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint16_t, 3, false, Image::average_4_half, Image::renormalize_half>, reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
 				}
 
 				break;
 			case FORMAT_RGBAH:
 				if (p_renormalize) {
-					_generate_po2_mipmap<uint16_t, 4, true, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint16_t, 4, true, Image::average_4_half, Image::renormalize_half>, reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
 				} else {
-					_generate_po2_mipmap<uint16_t, 4, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint16_t, 4, false, Image::average_4_half, Image::renormalize_half>, reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
 				}
 
 				break;
 			case FORMAT_RGBE9995:
 				if (p_renormalize) {
-					_generate_po2_mipmap<uint32_t, 1, true, Image::average_4_rgbe9995, Image::renormalize_rgbe9995>(reinterpret_cast<const uint32_t *>(&wp[prev_ofs]), reinterpret_cast<uint32_t *>(&wp[ofs]), prev_w, prev_h);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint32_t, 1, true, Image::average_4_rgbe9995, Image::renormalize_rgbe9995>, reinterpret_cast<const uint32_t *>(&wp[prev_ofs]), reinterpret_cast<uint32_t *>(&wp[ofs]), prev_w, prev_h);
 				} else {
-					_generate_po2_mipmap<uint32_t, 1, false, Image::average_4_rgbe9995, Image::renormalize_rgbe9995>(reinterpret_cast<const uint32_t *>(&wp[prev_ofs]), reinterpret_cast<uint32_t *>(&wp[ofs]), prev_w, prev_h);
+					_generate_po2_mipmap_threaded(_generate_po2_mipmap<uint32_t, 1, false, Image::average_4_rgbe9995, Image::renormalize_rgbe9995>, reinterpret_cast<const uint32_t *>(&wp[prev_ofs]), reinterpret_cast<uint32_t *>(&wp[ofs]), prev_w, prev_h);
 				}
 
 				break;
@@ -2297,6 +2467,9 @@ Error Image::compress(CompressMode p_mode, CompressSource p_source, float p_loss
 }
 
 Error Image::compress_from_channels(CompressMode p_mode, UsedChannels p_channels, float p_lossy_quality) {
+	uint64_t begin_time = OS::get_singleton()->get_ticks_usec();
+	Format source_format = format;
+
 	switch (p_mode) {
 		case COMPRESS_S3TC: {
 			ERR_FAIL_COND_V(!_image_compress_bc_func, ERR_UNAVAILABLE);
@@ -2324,6 +2497,8 @@ Error Image::compress_from_channels(CompressMode p_mode, UsedChannels p_channels
 		} break;
 	}
 
+	print_verbose(vformat("Image: Compressed %dx%d %s image to %s in %.1f ms.", width, height, get_format_name(source_format), get_format_name(format), (OS::get_singleton()->get_ticks_usec() - begin_time) / 1000.0));
+
 	return OK;
 }
 
@@ -3260,6 +3435,27 @@ void Image::bumpmap_to_normalmap(float bump_scale) {
 	data = result_image;
 }
 
+struct _ImageSRGBToLinearRows : public _ImageRowBands {
+	const uint8_t *lut;
+	uint8_t *data;
+	uint32_t pixel_size;
+	uint32_t pixels;
+	uint32_t row_pixels;
+
+	virtual void process_rows(uint32_t p_from, uint32_t p_to) {
+		uint32_t from = p_from * row_pixels;
+		uint32_t to = MIN(p_to * row_pixels, pixels);
+		uint8_t *ptr = &data[from * pixel_size];
+
+		for (uint32_t i = from; i < to; i++) {
+			ptr[0] = lut[ptr[0]];
+			ptr[1] = lut[ptr[1]];
+			ptr[2] = lut[ptr[2]];
+			ptr += pixel_size;
+		}
+	}
+};
+
 void Image::srgb_to_linear() {
 	if (data.size() == 0) {
 		return;
@@ -3269,26 +3465,16 @@ void Image::srgb_to_linear() {
 
 	ERR_FAIL_COND(format != FORMAT_RGB8 && format != FORMAT_RGBA8);
 
-	if (format == FORMAT_RGBA8) {
-		int len = data.size() / 4;
-		uint8_t *data_ptr = data.ptrw();
-
-		for (int i = 0; i < len; i++) {
-			data_ptr[(i << 2) + 0] = srgb2lin[data_ptr[(i << 2) + 0]];
-			data_ptr[(i << 2) + 1] = srgb2lin[data_ptr[(i << 2) + 1]];
-			data_ptr[(i << 2) + 2] = srgb2lin[data_ptr[(i << 2) + 2]];
-		}
+	// Mipmaps are converted too, so the data is split into rows of a fixed size rather than image rows.
+	const uint32_t row_pixels = 4096;
 
-	} else if (format == FORMAT_RGB8) {
-		int len = data.size() / 3;
-		uint8_t *data_ptr = data.ptrw();
-
-		for (int i = 0; i < len; i++) {
-			data_ptr[(i * 3) + 0] = srgb2lin[data_ptr[(i * 3) + 0]];
-			data_ptr[(i * 3) + 1] = srgb2lin[data_ptr[(i * 3) + 1]];
-			data_ptr[(i * 3) + 2] = srgb2lin[data_ptr[(i * 3) + 2]];
-		}
-	}
+	_ImageSRGBToLinearRows conv;
+	conv.lut = srgb2lin;
+	conv.data = data.ptrw();
+	conv.pixel_size = format == FORMAT_RGBA8 ? 4 : 3;
+	conv.pixels = data.size() / conv.pixel_size;
+	conv.row_pixels = row_pixels;
+	conv.run((conv.pixels + row_pixels - 1) / row_pixels, row_pixels);
 }
 
 void Image::premultiply_alpha() {
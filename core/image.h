@@ -44,6 +44,11 @@
 */
 
 class Image;
+struct _ImageRowBands;
+
+namespace TestImage {
+class ThreadCountScope;
+}
 
 typedef Error (*SavePNGFunc)(const String &p_path, const Ref<Image> &p_img);
 typedef Vector<uint8_t> (*SavePNGBufferFunc)(const Ref<Image> &p_img);
@@ -164,6 +169,12 @@ protected:
 	static void _bind_methods();
 
 private:
+	friend struct _ImageRowBands;
+	friend class TestImage::ThreadCountScope; // Forces the thread count in tests.
+
+	// Threads that large images are split across, 0 for one per CPU.
+	static uint32_t processing_thread_count;
+
 	void _create_empty(int p_width, int p_height, bool p_use_mipmaps, Format p_format) {
 		create(p_width, p_height, p_use_mipmaps, p_format);
 	}
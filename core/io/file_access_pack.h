@@ -112,6 +112,7 @@ public:
 
 	_FORCE_INLINE_ FileAccess *try_open_path(const String &p_path);
 	_FORCE_INLINE_ bool has_path(const String &p_path);
+	_FORCE_INLINE_ bool get_path_content_md5(const String &p_path, uint8_t *r_md5, uint64_t *r_size = nullptr);
 
 	PackedData();
 	~PackedData();
@@ -189,6 +190,30 @@ bool PackedData::has_path(const String &p_path) {
 	return files.has(PathMD5(p_path.md5_buffer()));
 }
 
+bool PackedData::get_path_content_md5(const String &p_path, uint8_t *r_md5, uint64_t *r_size) {
+	Map<PathMD5, PackedFile>::Element *E = files.find(PathMD5(p_path.md5_buffer()));
+	if (!E || E->get().offset == 0) {
+		return false;
+	}
+
+	// Packs written without content hashes store an all-zero md5.
+	bool empty = true;
+	for (int i = 0; i < 16; i++) {
+		r_md5[i] = E->get().md5[i];
+		if (r_md5[i] != 0) {
+			empty = false;
+		}
+	}
+	if (empty) {
+		return false;
+	}
+
+	if (r_size) {
+		*r_size = E->get().size;
+	}
+	return true;
+}
+
 class DirAccessPack : public DirAccess {
 	PackedData::PackedDir *current;
 
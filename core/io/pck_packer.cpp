@@ -30,6 +30,7 @@
 
 #include "pck_packer.h"
 
+#include "core/crypto/crypto_core.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
 #include "core/os/file_access.h"
 #include "core/version.h"
@@ -118,7 +119,7 @@ Error PCKPacker::flush(bool p_verbose) {
 		file->store_64(0); // offset
 		file->store_64(files[i].size); // size
 
-		// # empty md5
+		// md5 of the contents, filled in once the file is written
 		file->store_32(0);
 		file->store_32(0);
 		file->store_32(0);
@@ -137,15 +138,27 @@ Error PCKPacker::flush(bool p_verbose) {
 	for (int i = 0; i < files.size(); i++) {
 		FileAccess *src = FileAccess::open(files[i].src_path, FileAccess::READ);
 		uint64_t to_write = files[i].size;
+
+		// The content hash lets the loader share identical files across packs.
+		CryptoCore::MD5Context md5_ctx;
+		md5_ctx.start();
 		while (to_write > 0) {
 			int read = src->get_buffer(buf, MIN(to_write, buf_max));
+			if (read <= 0) {
+				break;
+			}
 			file->store_buffer(buf, read);
+			md5_ctx.update(buf, read);
 			to_write -= read;
 		}
+		unsigned char md5[16];
+		md5_ctx.finish(md5);
 
 		uint64_t pos = file->get_position();
-		file->seek(files[i].offset_offset); // go back to store the file's offset
+		file->seek(files[i].offset_offset); // go back to store the file's offset and md5
 		file->store_64(ofs);
+		file->store_64(files[i].size);
+		file->store_buffer(md5, 16);
 		file->seek(pos);
 
 		ofs = _align(ofs + files[i].size, alignment);
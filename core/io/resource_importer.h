@@ -72,6 +72,7 @@ public:
 
 	virtual bool can_be_imported(const String &p_path) const;
 	virtual int get_import_order(const String &p_path) const;
+	void get_import_order_threads_and_importer(const String &p_path, int &r_order, bool &r_can_threads, String &r_importer) const;
 
 	String get_internal_resource_path(const String &p_path) const;
 	void get_internal_resource_path_list(const String &p_path, List<String> *r_paths);
@@ -102,6 +103,7 @@ public:
 	virtual String get_resource_type() const = 0;
 	virtual float get_priority() const { return 1.0; }
 	virtual int get_import_order() const { return 0; }
+	virtual int get_format_version() const { return 0; } // Bump when the output for the same source and options changes.
 
 	struct ImportOption {
 		PropertyInfo option;
@@ -126,6 +128,9 @@ public:
 	virtual Error import_group_file(const String &p_group_file, const Map<String, Map<StringName, Variant>> &p_source_file_options, const Map<String, String> &p_base_paths) { return ERR_UNAVAILABLE; }
 	virtual bool are_import_settings_valid(const String &p_path) const { return true; }
 	virtual String get_import_settings_string() const { return String(); }
+
+	// Importers returning true must not touch the scene tree, the editor UI or any unguarded shared state from import().
+	virtual bool can_import_threaded() const { return false; }
 };
 
 #endif // RESOURCE_IMPORTER_H
@@ -30,6 +30,7 @@
 
 #include "resource_loader.h"
 
+#include "core/io/file_access_pack.h"
 #include "core/io/resource_importer.h"
 #include "core/os/file_access.h"
 #include "core/os/os.h"
@@ -179,6 +180,7 @@ void ResourceFormatLoader::_bind_methods() {
 ///////////////////////////////////
 
 RES ResourceLoader::_load(const String &p_path, const String &p_original_path, const String &p_type_hint, bool p_no_cache, Error *r_error, bool p_use_sub_threads, float *r_progress) {
+	MemoryTagScope memory_tag_scope(Memory::TAG_RESOURCES, "ResourceLoader::_load");
 	bool found = false;
 
 	// Try all loaders and pick the first match for the type hint
@@ -213,7 +215,23 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 		//this is an actual thread, so wait for Ok fom semaphore
 		thread_load_semaphore->wait(); //wait until its ok to start loading
 	}
-	load_task.resource = _load(load_task.remapped_path, load_task.remapped_path != load_task.local_path ? load_task.local_path : String(), load_task.type_hint, false, &load_task.error, load_task.use_sub_threads, &load_task.progress);
+
+	uint64_t content_size = 0;
+	String content_hash = _get_content_hash(load_task.remapped_path, &content_size);
+	if (content_hash != String()) {
+		load_task.resource = _get_shared_content(content_hash, load_task.type_hint);
+	}
+
+	if (load_task.resource.is_valid()) {
+		// Another pack shipped the same bytes under a different path, reuse what is already loaded.
+		load_task.content_shared = true;
+		load_task.error = OK;
+		_add_shared_content_path(load_task.resource.ptr(), load_task.local_path, content_size);
+
+		print_verbose("Sharing already loaded resource '" + load_task.resource->get_path() + "' for identical content at: " + load_task.local_path);
+	} else {
+		load_task.resource = _load(load_task.remapped_path, load_task.remapped_path != load_task.local_path ? load_task.local_path : String(), load_task.type_hint, false, &load_task.error, load_task.use_sub_threads, &load_task.progress);
+	}
 
 	load_task.progress = 1.0; //it was fully loaded at this point, so force progress to 1.0
 
@@ -241,9 +259,13 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 		load_task.semaphore = nullptr;
 	}
 
-	if (load_task.resource.is_valid()) {
+	if (load_task.resource.is_valid() && !load_task.content_shared) {
 		load_task.resource->set_path(load_task.local_path);
 
+		if (content_hash != String()) {
+			_set_shared_content(load_task.resource.ptr(), content_hash);
+		}
+
 		if (load_task.xl_remapped) {
 			load_task.resource->set_as_translation_remapped(true);
 		}
@@ -257,15 +279,87 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 			load_task.resource->set_last_modified_time(mt);
 		}
 #endif
+	}
 
-		if (_loaded_callback) {
-			_loaded_callback(load_task.resource, load_task.local_path);
-		}
+	if (load_task.resource.is_valid() && _loaded_callback) {
+		_loaded_callback(load_task.resource, load_task.local_path);
 	}
 
 	thread_load_mutex->unlock();
 }
 
+String ResourceLoader::_get_content_hash(const String &p_path, uint64_t *r_size) {
+	if (!share_identical_content || !PackedData::get_singleton() || PackedData::get_singleton()->is_disabled()) {
+		return String();
+	}
+
+	// Imported resources are read from their internal path, so that is the content that matters.
+	String content_path = p_path;
+	if (ResourceFormatImporter::get_singleton()->recognize_path(p_path)) {
+		content_path = ResourceFormatImporter::get_singleton()->get_internal_resource_path(p_path);
+		if (content_path == String()) {
+			return String();
+		}
+	}
+
+	uint8_t md5[16];
+	if (!PackedData::get_singleton()->get_path_content_md5(content_path, md5, r_size)) {
+		return String();
+	}
+
+	// The extension picks the loader, so identical bytes with different extensions are not the same resource.
+	return String::md5(md5) + ":" + content_path.get_extension().to_lower();
+}
+
+RES ResourceLoader::_get_shared_content(const String &p_hash, const String &p_type_hint) {
+	RES res;
+
+	ResourceCache::lock->read_lock();
+	Resource **rptr = ResourceCache::content_resources.getptr(p_hash);
+	if (rptr) {
+		//it is possible this resource was just freed in a thread. If so, this referencing will not work and resource is considered not shared
+		res = RES(*rptr);
+	}
+	ResourceCache::lock->read_unlock();
+
+	if (res.is_valid() && p_type_hint != String() && !ClassDB::is_parent_class(res->get_class_name(), p_type_hint)) {
+		return RES();
+	}
+
+	return res;
+}
+
+// Every path with the same content gets the same instance, so only data that is not edited after loading is shared.
+static bool _can_share_content(const Resource *p_resource) {
+	const StringName class_name = p_resource->get_class_name();
+	return ClassDB::is_parent_class(class_name, "Texture") || ClassDB::is_parent_class(class_name, "Mesh") || ClassDB::is_parent_class(class_name, "AudioStream");
+}
+
+void ResourceLoader::_set_shared_content(Resource *p_resource, const String &p_hash) {
+	if (!_can_share_content(p_resource)) {
+		return;
+	}
+
+	ResourceCache::lock->write_lock();
+	if (!ResourceCache::content_resources.has(p_hash)) {
+		ResourceCache::content_resources[p_hash] = p_resource;
+		p_resource->content_hash_cache = p_hash;
+	}
+	ResourceCache::lock->write_unlock();
+}
+
+void ResourceLoader::_add_shared_content_path(Resource *p_resource, const String &p_path, uint64_t p_size) {
+	ResourceCache::lock->write_lock();
+	// The alias is cached like the original path, so loading it again doesn't look up the content hash.
+	if (!ResourceCache::resources.has(p_path)) {
+		ResourceCache::resources[p_path] = p_resource;
+		p_resource->content_alias_paths.push_back(p_path);
+		ResourceCache::content_shared_count++;
+		ResourceCache::content_shared_bytes += p_size;
+	}
+	ResourceCache::lock->write_unlock();
+}
+
 Error ResourceLoader::load_threaded_request(const String &p_path, const String &p_type_hint, bool p_use_sub_threads, const String &p_source_resource) {
 	String local_path;
 	if (p_path.is_rel_path()) {
@@ -1121,6 +1215,7 @@ void *ResourceLoader::dep_err_notify_ud = nullptr;
 
 bool ResourceLoader::abort_on_missing_resource = true;
 bool ResourceLoader::timestamp_on_load = false;
+bool ResourceLoader::share_identical_content = false;
 
 Mutex *ResourceLoader::thread_load_mutex = nullptr;
 HashMap<String, ResourceLoader::ThreadLoadTask> ResourceLoader::thread_load_tasks;
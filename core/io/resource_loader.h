@@ -82,6 +82,7 @@ private:
 	static Ref<ResourceFormatLoader> loader[MAX_LOADERS];
 	static int loader_count;
 	static bool timestamp_on_load;
+	static bool share_identical_content;
 
 	static void *err_notify_ud;
 	static ResourceLoadErrorNotify err_notify;
@@ -119,6 +120,7 @@ private:
 		bool xl_remapped = false;
 		bool use_sub_threads = false;
 		bool start_next = true;
+		bool content_shared = false;
 		int requests = 0;
 		int poll_requests = 0;
 		Set<String> sub_tasks;
@@ -135,6 +137,11 @@ private:
 
 	static float _dependency_get_progress(const String &p_path);
 
+	static String _get_content_hash(const String &p_path, uint64_t *r_size);
+	static RES _get_shared_content(const String &p_hash, const String &p_type_hint);
+	static void _set_shared_content(Resource *p_resource, const String &p_hash);
+	static void _add_shared_content_path(Resource *p_resource, const String &p_path, uint64_t p_size);
+
 public:
 	static Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, const String &p_source_resource = String());
 	static ThreadLoadStatus load_threaded_get_status(const String &p_path, float *r_progress = nullptr);
@@ -157,6 +164,9 @@ public:
 	static void set_timestamp_on_load(bool p_timestamp) { timestamp_on_load = p_timestamp; }
 	static bool get_timestamp_on_load() { return timestamp_on_load; }
 
+	static void set_share_identical_content(bool p_share) { share_identical_content = p_share; }
+	static bool is_sharing_identical_content() { return share_identical_content; }
+
 	static void notify_load_error(const String &p_err) {
 		if (err_notify) {
 			err_notify(err_notify_ud, p_err);
@@ -1036,12 +1036,15 @@ Error Object::emit_signal(const StringName &p_name, const Variant **p_args, int
 
 	OBJ_DEBUG_LOCK
 
+	//arguments plus binds are assembled on the stack, unless there are too many of them
+	const Variant *bind_stack[16];
 	Vector<const Variant *> bind_mem;
 
 	Error err = OK;
 
 	for (int i = 0; i < ssize; i++) {
-		const Connection &c = slot_map.getv(i).conn;
+		const SignalData::Slot &slot = slot_map.getv(i);
+		const Connection &c = slot.conn;
 
 		Object *target = c.callable.get_object();
 		if (!target) {
@@ -1054,17 +1057,22 @@ Error Object::emit_signal(const StringName &p_name, const Variant **p_args, int
 
 		if (c.binds.size()) {
 			//handle binds
-			bind_mem.resize(p_argcount + c.binds.size());
+			argc = p_argcount + c.binds.size();
+
+			const Variant **bind_args = bind_stack;
+			if (argc > (int)(sizeof(bind_stack) / sizeof(bind_stack[0]))) {
+				bind_mem.resize(argc);
+				bind_args = bind_mem.ptrw();
+			}
 
 			for (int j = 0; j < p_argcount; j++) {
-				bind_mem.write[j] = p_args[j];
+				bind_args[j] = p_args[j];
 			}
 			for (int j = 0; j < c.binds.size(); j++) {
-				bind_mem.write[p_argcount + j] = &c.binds[j];
+				bind_args[p_argcount + j] = &c.binds[j];
 			}
 
-			args = (const Variant **)bind_mem.ptr();
-			argc = bind_mem.size();
+			args = bind_args;
 		}
 
 		if (c.flags & CONNECT_DEFERRED) {
@@ -1073,7 +1081,19 @@ Error Object::emit_signal(const StringName &p_name, const Variant **p_args, int
 			Callable::CallError ce;
 			_emitting = true;
 			Variant ret;
-			c.callable.call(args, argc, ret, ce);
+			if (slot.method_bind && !target->get_script_instance()) {
+				//native method, skip the method lookup by name
+#ifdef DEBUG_ENABLED
+				_ObjectDebugLock target_lock(target);
+#endif
+				ce.error = Callable::CallError::CALL_OK;
+				ret = slot.method_bind->call(target, args, argc, ce);
+			} else if (c.callable.is_standard()) {
+				//target was already resolved above, don't look it up again
+				ret = target->call(c.callable.get_method(), args, argc, ce);
+			} else {
+				c.callable.call(args, argc, ret, ce);
+			}
 			_emitting = false;
 
 			if (ce.error != Callable::CallError::CALL_OK) {
@@ -1333,6 +1353,9 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, co
 	conn.binds = p_binds;
 	slot.conn = conn;
 	slot.cE = target_object->connections.push_back(conn);
+	if (target.is_standard()) {
+		slot.method_bind = ClassDB::get_method(target_object->get_class_name(), target.get_method());
+	}
 	if (p_flags & CONNECT_REFERENCE_COUNTED) {
 		slot.reference_count = 1;
 	}
@@ -1369,6 +1392,11 @@ bool Object::is_connected(const StringName &p_signal, const Callable &p_callable
 	//return (E!=nullptr );
 }
 
+bool Object::has_connections(const StringName &p_signal) const {
+	const SignalData *s = signal_map.getptr(p_signal);
+	return s && !s->slot_map.empty();
+}
+
 void Object::disconnect_compat(const StringName &p_signal, Object *p_to_object, const StringName &p_to_method) {
 	_disconnect(p_signal, Callable(p_to_object, p_to_method));
 }
@@ -31,6 +31,7 @@
 #ifndef OBJECT_H
 #define OBJECT_H
 
+#include "core/dense_hash_map.h"
 #include "core/hash_map.h"
 #include "core/list.h"
 #include "core/map.h"
@@ -400,6 +401,7 @@ public:                                                                 \
                                                                         \
 private:
 
+class MethodBind;
 class ScriptInstance;
 
 class Object {
@@ -442,13 +444,14 @@ private:
 			int reference_count = 0;
 			Connection conn;
 			List<Connection>::Element *cE = nullptr;
+			MethodBind *method_bind = nullptr; // Native target method, called directly while the target has no script.
 		};
 
 		MethodInfo user;
 		VMap<Callable, Slot> slot_map;
 	};
 
-	HashMap<StringName, SignalData> signal_map;
+	DenseHashMap<StringName, SignalData> signal_map;
 	List<Connection> connections;
 #ifdef DEBUG_ENABLED
 	SafeRefCount _lock_index;
@@ -705,6 +708,7 @@ public:
 	Error connect(const StringName &p_signal, const Callable &p_callable, const Vector<Variant> &p_binds = Vector<Variant>(), uint32_t p_flags = 0);
 	void disconnect(const StringName &p_signal, const Callable &p_callable);
 	bool is_connected(const StringName &p_signal, const Callable &p_callable) const;
+	bool has_connections(const StringName &p_signal) const; // Lets hot paths skip building the arguments of a signal nobody listens to.
 
 	void call_deferred(const StringName &p_method, VARIANT_ARG_LIST);
 	void set_deferred(const StringName &p_property, const Variant &p_value);
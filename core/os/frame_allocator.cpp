@@ -0,0 +1,189 @@
+/*************************************************************************/
+/*  frame_allocator.cpp                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "frame_allocator.h"
+
+#include "core/error_macros.h"
+#include "core/os/copymem.h"
+#include "core/os/memory.h"
+
+// Every allocation is preceded by a header, which keeps the data aligned the
+// same way Memory::alloc_static() does with padding.
+struct FrameAllocationHeader {
+	uint64_t size;
+	uint64_t in_arena;
+};
+
+static_assert(sizeof(FrameAllocationHeader) <= PAD_ALIGN, "Frame allocation header must fit in the alignment padding.");
+
+struct FrameArena {
+	enum {
+		MAX_BLOCKS = 24,
+		FIRST_BLOCK_SIZE = 64 * 1024,
+	};
+
+	uint8_t *blocks[MAX_BLOCKS] = {};
+	size_t block_sizes[MAX_BLOCKS] = {};
+	uint32_t block = 0;
+	size_t offset = 0;
+	uint32_t scope_depth = 0;
+	uint8_t *last = nullptr; // Last allocation, can be resized or released in place.
+
+	uint8_t *allocate(size_t p_size) {
+		while (true) {
+			if (blocks[block] && offset + p_size <= block_sizes[block]) {
+				uint8_t *mem = blocks[block] + offset;
+				offset += p_size;
+				return mem;
+			}
+
+			if (blocks[block]) {
+				if (block + 1 == MAX_BLOCKS) {
+					return nullptr;
+				}
+				block++;
+				offset = 0;
+			}
+
+			if (!blocks[block]) {
+				// Blocks are kept around once allocated, each new one doubles the size.
+				size_t size = block ? block_sizes[block - 1] * 2 : (size_t)FIRST_BLOCK_SIZE;
+				while (size < p_size) {
+					size *= 2;
+				}
+				blocks[block] = (uint8_t *)Memory::alloc_static(size);
+				block_sizes[block] = size;
+			}
+		}
+	}
+
+	~FrameArena() {
+		for (uint32_t i = 0; i < MAX_BLOCKS; i++) {
+			if (blocks[i]) {
+				Memory::free_static(blocks[i]);
+			}
+		}
+	}
+};
+
+static thread_local FrameArena frame_arena;
+
+FrameAllocator::Scope::Scope() {
+	FrameArena &arena = frame_arena;
+	block = arena.block;
+	offset = arena.offset;
+	arena.last = nullptr; // Allocations from outer scopes can't grow in place anymore.
+	arena.scope_depth++;
+}
+
+FrameAllocator::Scope::~Scope() {
+	FrameArena &arena = frame_arena;
+	arena.block = block;
+	arena.offset = offset;
+	arena.last = nullptr;
+	arena.scope_depth--;
+}
+
+void *FrameAllocator::alloc(size_t p_bytes) {
+	FrameArena &arena = frame_arena;
+	size_t size = PAD_ALIGN + ((p_bytes + PAD_ALIGN - 1) & ~(size_t)(PAD_ALIGN - 1));
+
+	uint8_t *mem = nullptr;
+	if (arena.scope_depth) {
+		mem = arena.allocate(size);
+	}
+
+	FrameAllocationHeader *header;
+	if (mem) {
+		header = (FrameAllocationHeader *)mem;
+		header->in_arena = 1;
+		arena.last = mem;
+	} else {
+		mem = (uint8_t *)Memory::alloc_static(size);
+		ERR_FAIL_COND_V(!mem, nullptr);
+		header = (FrameAllocationHeader *)mem;
+		header->in_arena = 0;
+	}
+
+	header->size = p_bytes;
+	return mem + PAD_ALIGN;
+}
+
+void *FrameAllocator::realloc(void *p_ptr, size_t p_bytes) {
+	if (!p_ptr) {
+		return alloc(p_bytes);
+	}
+	if (p_bytes == 0) {
+		free(p_ptr);
+		return nullptr;
+	}
+
+	uint8_t *mem = (uint8_t *)p_ptr - PAD_ALIGN;
+	FrameAllocationHeader *header = (FrameAllocationHeader *)mem;
+
+	if (header->in_arena) {
+		FrameArena &arena = frame_arena;
+		if (mem == arena.last) {
+			// Growing or shrinking the last allocation doesn't need to move it.
+			size_t end = (mem - arena.blocks[arena.block]) + PAD_ALIGN + ((p_bytes + PAD_ALIGN - 1) & ~(size_t)(PAD_ALIGN - 1));
+			if (end <= arena.block_sizes[arena.block]) {
+				arena.offset = end;
+				header->size = p_bytes;
+				return p_ptr;
+			}
+		}
+	}
+
+	void *new_ptr = alloc(p_bytes);
+	ERR_FAIL_COND_V(!new_ptr, nullptr);
+	copymem(new_ptr, p_ptr, MIN(header->size, (uint64_t)p_bytes));
+	free(p_ptr);
+	return new_ptr;
+}
+
+void FrameAllocator::free(void *p_ptr) {
+	ERR_FAIL_COND(p_ptr == nullptr);
+
+	uint8_t *mem = (uint8_t *)p_ptr - PAD_ALIGN;
+	FrameAllocationHeader *header = (FrameAllocationHeader *)mem;
+
+	if (!header->in_arena) {
+		Memory::free_static(mem);
+		return;
+	}
+
+	// Arena memory is released when the scope ends, unless this was the last
+	// allocation, which is easy to give back right away.
+	FrameArena &arena = frame_arena;
+	if (mem == arena.last) {
+		arena.offset = mem - arena.blocks[arena.block];
+		arena.last = nullptr;
+	}
+}
@@ -0,0 +1,67 @@
+/*************************************************************************/
+/*  frame_allocator.h                                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef FRAME_ALLOCATOR_H
+#define FRAME_ALLOCATOR_H
+
+#include "core/typedefs.h"
+
+#include <stddef.h>
+
+/**
+ * Per thread bump allocator for short lived temporaries, meant to be used as
+ * the allocator parameter of containers such as LocalVector or List.
+ *
+ * Memory is only handed out from the arena while a FrameAllocator::Scope is
+ * alive on the calling thread, everything allocated inside a scope is
+ * released at once when the scope ends. Main::iteration() keeps a scope open
+ * for the whole frame, and functions using the allocator on hot paths can
+ * open their own to give the memory back sooner. Outside of any scope (or if
+ * the arena runs out of room), allocations fall back to the heap, so using
+ * the allocator is always safe as long as the containers don't outlive the
+ * scope they were filled in.
+ */
+class FrameAllocator {
+public:
+	class Scope {
+		uint32_t block;
+		size_t offset;
+
+	public:
+		Scope();
+		~Scope();
+	};
+
+	static void *alloc(size_t p_bytes);
+	static void *realloc(void *p_ptr, size_t p_bytes);
+	static void free(void *p_ptr);
+};
+
+#endif // FRAME_ALLOCATOR_H
@@ -33,6 +33,7 @@
 #include "core/error_macros.h"
 #include "core/os/copymem.h"
 #include "core/safe_refcount.h"
+#include "core/spin_lock.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -62,9 +63,42 @@ void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_d
 #ifdef DEBUG_ENABLED
 uint64_t Memory::mem_usage = 0;
 uint64_t Memory::max_usage = 0;
+
+uint64_t Memory::tag_usage[Memory::TAG_MAX] = {};
+uint64_t Memory::tag_alloc_count[Memory::TAG_MAX] = {};
+uint32_t Memory::alloc_sample_rate = 0;
+
+thread_local Memory::Tag Memory::current_tag = Memory::TAG_GENERAL;
+thread_local const char *Memory::current_site = nullptr;
+
+// Sampled sites live in a fixed table so recording never allocates.
+static Memory::AllocSample alloc_samples[Memory::MAX_ALLOC_SAMPLES];
+static int alloc_sample_count = 0;
+static SpinLock alloc_sample_lock;
+
+void Memory::_sample_alloc(size_t p_bytes) {
+	alloc_sample_lock.lock();
+	int idx = 0;
+	while (idx < alloc_sample_count && (alloc_samples[idx].site != current_site || alloc_samples[idx].tag != current_tag)) {
+		idx++;
+	}
+	if (idx == alloc_sample_count && alloc_sample_count < MAX_ALLOC_SAMPLES) {
+		alloc_samples[idx].site = current_site;
+		alloc_samples[idx].tag = current_tag;
+		alloc_samples[idx].count = 0;
+		alloc_samples[idx].bytes = 0;
+		alloc_sample_count++;
+	}
+	if (idx < alloc_sample_count) {
+		alloc_samples[idx].count++;
+		alloc_samples[idx].bytes += p_bytes;
+	}
+	alloc_sample_lock.unlock();
+}
 #endif
 
 uint64_t Memory::alloc_count = 0;
+uint64_t Memory::total_alloc_count = 0;
 
 void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 #ifdef DEBUG_ENABLED
@@ -78,6 +112,7 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 	ERR_FAIL_COND_V(!mem, nullptr);
 
 	atomic_increment(&alloc_count);
+	uint64_t count = atomic_increment(&total_alloc_count);
 
 	if (prepad) {
 		uint64_t *s = (uint64_t *)mem;
@@ -86,8 +121,18 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 		uint8_t *s8 = (uint8_t *)mem;
 
 #ifdef DEBUG_ENABLED
+		// The second half of the padding belongs to CowData, so the tag
+		// travels in the unused top byte of the size instead.
+		*s |= (uint64_t)current_tag << TAG_SHIFT;
 		atomic_add(&mem_usage, p_bytes);
 		atomic_exchange_if_greater(&max_usage, mem_usage);
+		atomic_add(&tag_usage[current_tag], p_bytes);
+		atomic_increment(&tag_alloc_count[current_tag]);
+		if (alloc_sample_rate && count % alloc_sample_rate == 0) {
+			_sample_alloc(p_bytes);
+		}
+#else
+		(void)count;
 #endif
 		return s8 + PAD_ALIGN;
 	} else {
@@ -113,11 +158,15 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 		uint64_t *s = (uint64_t *)mem;
 
 #ifdef DEBUG_ENABLED
-		if (p_bytes > *s) {
-			atomic_add(&mem_usage, p_bytes - *s);
+		uint64_t tag = *s >> TAG_SHIFT;
+		uint64_t old_bytes = *s & SIZE_MASK;
+		if (p_bytes > old_bytes) {
+			atomic_add(&mem_usage, p_bytes - old_bytes);
 			atomic_exchange_if_greater(&max_usage, mem_usage);
+			atomic_add(&tag_usage[tag], p_bytes - old_bytes);
 		} else {
-			atomic_sub(&mem_usage, *s - p_bytes);
+			atomic_sub(&mem_usage, old_bytes - p_bytes);
+			atomic_sub(&tag_usage[tag], old_bytes - p_bytes);
 		}
 #endif
 
@@ -125,14 +174,16 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 			free(mem);
 			return nullptr;
 		} else {
-			*s = p_bytes;
-
 			mem = (uint8_t *)realloc(mem, p_bytes + PAD_ALIGN);
 			ERR_FAIL_COND_V(!mem, nullptr);
 
 			s = (uint64_t *)mem;
 
+#ifdef DEBUG_ENABLED
+			*s = p_bytes | (tag << TAG_SHIFT);
+#else
 			*s = p_bytes;
+#endif
 
 			return mem + PAD_ALIGN;
 		}
@@ -163,7 +214,8 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 
 #ifdef DEBUG_ENABLED
 		uint64_t *s = (uint64_t *)mem;
-		atomic_sub(&mem_usage, *s);
+		atomic_sub(&mem_usage, *s & SIZE_MASK);
+		atomic_sub(&tag_usage[*s >> TAG_SHIFT], *s & SIZE_MASK);
 #endif
 
 		free(mem);
@@ -192,6 +244,81 @@ uint64_t Memory::get_mem_max_usage() {
 #endif
 }
 
+uint64_t Memory::get_alloc_count() {
+	return alloc_count;
+}
+
+uint64_t Memory::get_total_alloc_count() {
+	return total_alloc_count;
+}
+
+const char *Memory::get_tag_name(Tag p_tag) {
+	static const char *names[TAG_MAX] = {
+		"general",
+		"rendering",
+		"physics",
+		"scripting",
+		"audio",
+		"resources",
+	};
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, "");
+	return names[p_tag];
+}
+
+uint64_t Memory::get_tag_usage(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+#ifdef DEBUG_ENABLED
+	return tag_usage[p_tag];
+#else
+	return 0;
+#endif
+}
+
+uint64_t Memory::get_tag_alloc_count(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+#ifdef DEBUG_ENABLED
+	return tag_alloc_count[p_tag];
+#else
+	return 0;
+#endif
+}
+
+void Memory::set_alloc_sample_rate(uint32_t p_rate) {
+#ifdef DEBUG_ENABLED
+	alloc_sample_rate = p_rate;
+#endif
+}
+
+uint32_t Memory::get_alloc_sample_rate() {
+#ifdef DEBUG_ENABLED
+	return alloc_sample_rate;
+#else
+	return 0;
+#endif
+}
+
+int Memory::get_alloc_samples(AllocSample *r_samples, int p_max) {
+#ifdef DEBUG_ENABLED
+	alloc_sample_lock.lock();
+	int count = MIN(p_max, alloc_sample_count);
+	for (int i = 0; i < count; i++) {
+		r_samples[i] = alloc_samples[i];
+	}
+	alloc_sample_lock.unlock();
+	return count;
+#else
+	return 0;
+#endif
+}
+
+void Memory::clear_alloc_samples() {
+#ifdef DEBUG_ENABLED
+	alloc_sample_lock.lock();
+	alloc_sample_count = 0;
+	alloc_sample_lock.unlock();
+#endif
+}
+
 _GlobalNil::_GlobalNil() {
 	left = this;
 	right = this;
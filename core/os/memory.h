@@ -41,13 +41,51 @@
 #endif
 
 class Memory {
+public:
+	// Subsystem an allocation is accounted to. Set per thread with MemoryTagScope.
+	enum Tag {
+		TAG_GENERAL,
+		TAG_RENDERING,
+		TAG_PHYSICS,
+		TAG_SCRIPTING,
+		TAG_AUDIO,
+		TAG_RESOURCES,
+		TAG_MAX
+	};
+
+	static const int MAX_ALLOC_SAMPLES = 128;
+
+	struct AllocSample {
+		const char *site = nullptr;
+		Tag tag = TAG_GENERAL;
+		uint64_t count = 0;
+		uint64_t bytes = 0;
+	};
+
+private:
 	Memory();
 #ifdef DEBUG_ENABLED
 	static uint64_t mem_usage;
 	static uint64_t max_usage;
+
+	static uint64_t tag_usage[TAG_MAX];
+	static uint64_t tag_alloc_count[TAG_MAX];
+	static uint32_t alloc_sample_rate;
+
+	// The allocation header keeps the tag in the top byte of the size.
+	static const int TAG_SHIFT = 56;
+	static const uint64_t SIZE_MASK = (uint64_t(1) << TAG_SHIFT) - 1;
+
+	static thread_local Tag current_tag;
+	static thread_local const char *current_site;
+
+	static void _sample_alloc(size_t p_bytes);
 #endif
 
-	static uint64_t alloc_count;
+	static uint64_t alloc_count; // Allocations currently alive.
+	static uint64_t total_alloc_count; // Allocations made since startup.
+
+	friend class MemoryTagScope;
 
 public:
 	static void *alloc_static(size_t p_bytes, bool p_pad_align = false);
@@ -57,11 +95,49 @@ public:
 	static uint64_t get_mem_available();
 	static uint64_t get_mem_usage();
 	static uint64_t get_mem_max_usage();
+	static uint64_t get_alloc_count();
+	static uint64_t get_total_alloc_count();
+
+	static const char *get_tag_name(Tag p_tag);
+	static uint64_t get_tag_usage(Tag p_tag);
+	static uint64_t get_tag_alloc_count(Tag p_tag);
+
+	// Record the tag and scope site of every Nth allocation (0 disables).
+	static void set_alloc_sample_rate(uint32_t p_rate);
+	static uint32_t get_alloc_sample_rate();
+	static int get_alloc_samples(AllocSample *r_samples, int p_max);
+	static void clear_alloc_samples();
+};
+
+// Accounts allocations made by the current thread to a subsystem until the
+// scope ends. Scopes nest; the innermost tag wins. No-op in release builds.
+class MemoryTagScope {
+#ifdef DEBUG_ENABLED
+	Memory::Tag prev_tag;
+	const char *prev_site;
+#endif
+
+public:
+	_FORCE_INLINE_ MemoryTagScope(Memory::Tag p_tag, const char *p_site = nullptr) {
+#ifdef DEBUG_ENABLED
+		prev_tag = Memory::current_tag;
+		prev_site = Memory::current_site;
+		Memory::current_tag = p_tag;
+		Memory::current_site = p_site;
+#endif
+	}
+	_FORCE_INLINE_ ~MemoryTagScope() {
+#ifdef DEBUG_ENABLED
+		Memory::current_tag = prev_tag;
+		Memory::current_site = prev_site;
+#endif
+	}
 };
 
 class DefaultAllocator {
 public:
 	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return Memory::alloc_static(p_memory, false); }
+	_FORCE_INLINE_ static void *realloc(void *p_ptr, size_t p_memory) { return Memory::realloc_static(p_ptr, p_memory, false); }
 	_FORCE_INLINE_ static void free(void *p_ptr) { Memory::free_static(p_ptr, false); }
 };
 
@@ -50,6 +50,23 @@ struct ThreadArrayProcessData {
 	}
 };
 
+// Limits how many threads the work split up on the calling thread may use, 0 means one per CPU.
+// Threads that already run next to one another (e.g. parallel imports) set it to 1, so the work
+// each of them splits up stays on that thread instead of starting one more thread per CPU.
+inline thread_local uint32_t thread_process_max_threads = 0;
+
+inline uint32_t thread_process_get_thread_count() {
+#ifdef NO_THREADS
+	return 1;
+#else
+	uint32_t count = OS::get_singleton() ? MAX(OS::get_singleton()->get_processor_count(), 1) : 1;
+	if (thread_process_max_threads > 0 && thread_process_max_threads < count) {
+		count = thread_process_max_threads;
+	}
+	return count;
+#endif
+}
+
 #ifndef NO_THREADS
 
 template <class T>
@@ -72,11 +89,20 @@ void thread_process_array(uint32_t p_elements, C *p_instance, M p_method, U p_us
 	data.userdata = p_userdata;
 	data.index = 0;
 	data.elements = p_elements;
+
+	uint32_t thread_count = thread_process_get_thread_count();
+	if (thread_count < 2) {
+		for (uint32_t i = 0; i < p_elements; i++) {
+			data.process(i);
+		}
+		return;
+	}
+
 	data.process(data.index); //process first, let threads increment for next
 
 	Vector<Thread *> threads;
 
-	threads.resize(OS::get_singleton()->get_processor_count());
+	threads.resize(thread_count);
 
 	for (int i = 0; i < threads.size(); i++) {
 		threads.write[i] = Thread::create(process_array_thread<ThreadArrayProcessData<C, U>>, &data);
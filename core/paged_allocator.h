@@ -0,0 +1,101 @@
+/*************************************************************************/
+/*  paged_allocator.h                                                    */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef PAGED_ALLOCATOR_H
+#define PAGED_ALLOCATOR_H
+
+#include "core/os/memory.h"
+#include "core/spin_lock.h"
+
+/**
+ * Allocates objects of a single type out of pages, recycling freed slots
+ * through a free list. This is meant for small objects that are created and
+ * destroyed very often, where going through the general purpose allocator
+ * every time is the main cost.
+ *
+ * Pages are never released, so the memory used stays at the peak amount of
+ * live objects. For the same reason it's safe to use in static instances,
+ * objects may still be freed after the allocator would have been destroyed.
+ */
+template <class T, bool thread_safe = false, uint32_t page_size = 256>
+class PagedAllocator {
+	union Slot {
+		Slot *next;
+		alignas(T) uint8_t data[sizeof(T)];
+	};
+
+	Slot *free_slots = nullptr;
+	SpinLock spin_lock;
+
+public:
+	template <class... Args>
+	T *alloc(const Args &... p_args) {
+		if (thread_safe) {
+			spin_lock.lock();
+		}
+
+		if (unlikely(!free_slots)) {
+			Slot *page = static_cast<Slot *>(Memory::alloc_static(sizeof(Slot) * page_size));
+			for (uint32_t i = 0; i < page_size - 1; i++) {
+				page[i].next = &page[i + 1];
+			}
+			page[page_size - 1].next = nullptr;
+			free_slots = page;
+		}
+
+		Slot *slot = free_slots;
+		free_slots = slot->next;
+
+		if (thread_safe) {
+			spin_lock.unlock();
+		}
+
+		return memnew_placement(slot->data, T(p_args...));
+	}
+
+	void free(T *p_obj) {
+		p_obj->~T();
+
+		Slot *slot = reinterpret_cast<Slot *>(p_obj);
+
+		if (thread_safe) {
+			spin_lock.lock();
+		}
+
+		slot->next = free_slots;
+		free_slots = slot;
+
+		if (thread_safe) {
+			spin_lock.unlock();
+		}
+	}
+};
+
+#endif // PAGED_ALLOCATOR_H
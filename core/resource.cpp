@@ -408,12 +408,29 @@ Resource::~Resource() {
 		ResourceCache::resources.erase(path_cache);
 		ResourceCache::lock->write_unlock();
 	}
+	if (content_hash_cache != "") {
+		ResourceCache::lock->write_lock();
+		Resource **res = ResourceCache::content_resources.getptr(content_hash_cache);
+		if (res && *res == this) {
+			ResourceCache::content_resources.erase(content_hash_cache);
+		}
+		for (int i = 0; i < content_alias_paths.size(); i++) {
+			res = ResourceCache::resources.getptr(content_alias_paths[i]);
+			if (res && *res == this) {
+				ResourceCache::resources.erase(content_alias_paths[i]);
+			}
+		}
+		ResourceCache::lock->write_unlock();
+	}
 	if (owners.size()) {
 		WARN_PRINT("Resource is still owned.");
 	}
 }
 
 HashMap<String, Resource *> ResourceCache::resources;
+HashMap<String, Resource *> ResourceCache::content_resources;
+uint64_t ResourceCache::content_shared_count = 0;
+uint64_t ResourceCache::content_shared_bytes = 0;
 #ifdef TOOLS_ENABLED
 HashMap<String, HashMap<String, int>> ResourceCache::resource_path_cache;
 #endif
@@ -443,6 +460,7 @@ void ResourceCache::clear() {
 	}
 
 	resources.clear();
+	content_resources.clear();
 	memdelete(lock);
 #ifdef TOOLS_ENABLED
 	memdelete(path_cache_lock);
@@ -492,6 +510,22 @@ int ResourceCache::get_cached_resource_count() {
 	return rc;
 }
 
+uint64_t ResourceCache::get_shared_content_count() {
+	lock->read_lock();
+	uint64_t count = content_shared_count;
+	lock->read_unlock();
+
+	return count;
+}
+
+uint64_t ResourceCache::get_shared_content_bytes() {
+	lock->read_lock();
+	uint64_t bytes = content_shared_bytes;
+	lock->read_unlock();
+
+	return bytes;
+}
+
 void ResourceCache::dump(const char *p_file, bool p_short) {
 #ifdef DEBUG_ENABLED
 	lock->read_lock();
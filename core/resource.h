@@ -57,9 +57,12 @@ private:
 
 	friend class ResBase;
 	friend class ResourceCache;
+	friend class ResourceLoader;
 
 	String name;
 	String path_cache;
+	String content_hash_cache;
+	Vector<String> content_alias_paths; // Other paths this resource is cached under, as they have the same content.
 	int subindex = 0;
 
 	virtual bool _use_builtin_script() const { return true; }
@@ -152,6 +155,9 @@ class ResourceCache {
 	friend class ResourceLoader; //need the lock
 	static RWLock *lock;
 	static HashMap<String, Resource *> resources;
+	static HashMap<String, Resource *> content_resources; // resources loaded from packs, keyed by content hash
+	static uint64_t content_shared_count;
+	static uint64_t content_shared_bytes;
 #ifdef TOOLS_ENABLED
 	static HashMap<String, HashMap<String, int>> resource_path_cache; // each tscn has a set of resource paths and IDs
 	static RWLock *path_cache_lock;
@@ -168,6 +174,9 @@ public:
 	static void dump(const char *p_file = nullptr, bool p_short = false);
 	static void get_cached_resources(List<Ref<Resource>> *p_resources);
 	static int get_cached_resource_count();
+
+	static uint64_t get_shared_content_count();
+	static uint64_t get_shared_content_bytes();
 };
 
 #endif // RESOURCE_H
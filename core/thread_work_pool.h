@@ -76,10 +76,13 @@ class ThreadWorkPool {
 
 	static void _thread_function(ThreadData *p_thread);
 
+	BaseWork *current_work = nullptr;
+
 public:
 	template <class C, class M, class U>
-	void do_work(uint32_t p_elements, C *p_instance, M p_method, U p_userdata) {
+	void begin_work(uint32_t p_elements, C *p_instance, M p_method, U p_userdata) {
 		ERR_FAIL_COND(!threads); //never initialized
+		ERR_FAIL_COND(current_work != nullptr);
 
 		index.store(0);
 
@@ -90,16 +93,39 @@ public:
 		w->index = &index;
 		w->max_elements = p_elements;
 
+		current_work = w;
+
 		for (uint32_t i = 0; i < thread_count; i++) {
 			threads[i].work = w;
 			threads[i].start.post();
 		}
+	}
+
+	bool is_working() const {
+		return current_work != nullptr;
+	}
+
+	// True once every element has been handed to a thread, some may still be processing.
+	bool is_done_dispatching() const {
+		ERR_FAIL_COND_V(current_work == nullptr, true);
+		return index.load(std::memory_order_relaxed) >= current_work->max_elements;
+	}
+
+	void end_work() {
+		ERR_FAIL_COND(current_work == nullptr);
 		for (uint32_t i = 0; i < thread_count; i++) {
 			threads[i].completed.wait();
 			threads[i].work = nullptr;
 		}
 
-		memdelete(w);
+		memdelete(current_work);
+		current_work = nullptr;
+	}
+
+	template <class C, class M, class U>
+	void do_work(uint32_t p_elements, C *p_instance, M p_method, U p_userdata) {
+		begin_work(p_elements, p_instance, p_method, p_userdata);
+		end_work();
 	}
 
 	void init(int p_thread_count = -1);
@@ -34,12 +34,20 @@
 #include "core/debugger/engine_debugger.h"
 #include "core/io/marshalls.h"
 #include "core/math/math_funcs.h"
+#include "core/paged_allocator.h"
 #include "core/print_string.h"
 #include "core/resource.h"
 #include "core/variant_parser.h"
 #include "scene/gui/control.h"
 #include "scene/main/node.h"
 
+// These types don't fit in _data._mem, their storage is recycled through
+// pools rather than going to the allocator every time a Variant is copied.
+static PagedAllocator<Transform2D, true> transform2d_pool;
+static PagedAllocator<::AABB, true> aabb_pool;
+static PagedAllocator<Basis, true> basis_pool;
+static PagedAllocator<Transform, true> transform_pool;
+
 String Variant::get_type_name(Variant::Type p_type) {
 	switch (p_type) {
 		case NIL: {
@@ -1077,7 +1085,7 @@ void Variant::reference(const Variant &p_variant) {
 			memnew_placement(_data._mem, Rect2i(*reinterpret_cast<const Rect2i *>(p_variant._data._mem)));
 		} break;
 		case TRANSFORM2D: {
-			_data._transform2d = memnew(Transform2D(*p_variant._data._transform2d));
+			_data._transform2d = transform2d_pool.alloc(*p_variant._data._transform2d);
 		} break;
 		case VECTOR3: {
 			memnew_placement(_data._mem, Vector3(*reinterpret_cast<const Vector3 *>(p_variant._data._mem)));
@@ -1090,18 +1098,18 @@ void Variant::reference(const Variant &p_variant) {
 		} break;
 
 		case AABB: {
-			_data._aabb = memnew(::AABB(*p_variant._data._aabb));
+			_data._aabb = aabb_pool.alloc(*p_variant._data._aabb);
 		} break;
 		case QUAT: {
 			memnew_placement(_data._mem, Quat(*reinterpret_cast<const Quat *>(p_variant._data._mem)));
 
 		} break;
 		case BASIS: {
-			_data._basis = memnew(Basis(*p_variant._data._basis));
+			_data._basis = basis_pool.alloc(*p_variant._data._basis);
 
 		} break;
 		case TRANSFORM: {
-			_data._transform = memnew(Transform(*p_variant._data._transform));
+			_data._transform = transform_pool.alloc(*p_variant._data._transform);
 		} break;
 
 		// misc types
@@ -1281,16 +1289,16 @@ void Variant::clear() {
 		RECT2
 		*/
 		case TRANSFORM2D: {
-			memdelete(_data._transform2d);
+			transform2d_pool.free(_data._transform2d);
 		} break;
 		case AABB: {
-			memdelete(_data._aabb);
+			aabb_pool.free(_data._aabb);
 		} break;
 		case BASIS: {
-			memdelete(_data._basis);
+			basis_pool.free(_data._basis);
 		} break;
 		case TRANSFORM: {
-			memdelete(_data._transform);
+			transform_pool.free(_data._transform);
 		} break;
 
 			// misc types
@@ -2487,12 +2495,12 @@ Variant::Variant(const Plane &p_plane) {
 
 Variant::Variant(const ::AABB &p_aabb) {
 	type = AABB;
-	_data._aabb = memnew(::AABB(p_aabb));
+	_data._aabb = aabb_pool.alloc(p_aabb);
 }
 
 Variant::Variant(const Basis &p_matrix) {
 	type = BASIS;
-	_data._basis = memnew(Basis(p_matrix));
+	_data._basis = basis_pool.alloc(p_matrix);
 }
 
 Variant::Variant(const Quat &p_quat) {
@@ -2502,12 +2510,12 @@ Variant::Variant(const Quat &p_quat) {
 
 Variant::Variant(const Transform &p_transform) {
 	type = TRANSFORM;
-	_data._transform = memnew(Transform(p_transform));
+	_data._transform = transform_pool.alloc(p_transform);
 }
 
 Variant::Variant(const Transform2D &p_transform) {
 	type = TRANSFORM2D;
-	_data._transform2d = memnew(Transform2D(p_transform));
+	_data._transform2d = transform2d_pool.alloc(p_transform);
 }
 
 Variant::Variant(const Color &p_color) {
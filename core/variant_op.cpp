@@ -3508,8 +3508,8 @@ bool Variant::iter_init(Variant &r_iter, bool &valid) const {
 				return false;
 			}
 
-			const Variant *next = dic->next(nullptr);
-			r_iter = *next;
+			//the iterator is a cursor into the dictionary entries, not the key
+			r_iter = dic->next_cursor();
 			return true;
 
 		} break;
@@ -3734,12 +3734,12 @@ bool Variant::iter_next(Variant &r_iter, bool &valid) const {
 		} break;
 		case DICTIONARY: {
 			const Dictionary *dic = reinterpret_cast<const Dictionary *>(_data._mem);
-			const Variant *next = dic->next(&r_iter);
-			if (!next) {
+			int next = dic->next_cursor(r_iter);
+			if (next < 0) {
 				return false;
 			}
 
-			r_iter = *next;
+			r_iter = next;
 			return true;
 
 		} break;
@@ -3909,7 +3909,13 @@ Variant Variant::iter_get(const Variant &r_iter, bool &r_valid) const {
 			return str->substr(r_iter, 1);
 		} break;
 		case DICTIONARY: {
-			return r_iter; //iterator is the same as the key
+			const Dictionary *dic = reinterpret_cast<const Dictionary *>(_data._mem);
+			const Variant *key = dic->get_key_at_cursor(r_iter);
+			if (!key) {
+				r_valid = false;
+				return Variant();
+			}
+			return *key;
 
 		} break;
 		case ARRAY: {
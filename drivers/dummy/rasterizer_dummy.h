@@ -881,6 +881,7 @@ public:
 			DummyTexture *texture = texture_owner.getornull(p_rid);
 			texture_owner.free(p_rid);
 			memdelete(texture);
+			return true;
 		}
 
 		if (mesh_owner.owns(p_rid)) {
@@ -888,8 +889,11 @@ public:
 			DummyMesh *mesh = mesh_owner.getornull(p_rid);
 			mesh_owner.free(p_rid);
 			memdelete(mesh);
+			return true;
 		}
-		return true;
+
+		// Not a storage RID, let the other servers free it
+		return false;
 	}
 
 	bool has_os_feature(const String &p_feature) const { return false; }
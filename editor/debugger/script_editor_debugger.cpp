@@ -55,6 +55,7 @@
 #include "scene/gui/margin_container.h"
 #include "scene/gui/rich_text_label.h"
 #include "scene/gui/separator.h"
+#include "scene/gui/spin_box.h"
 #include "scene/gui/split_container.h"
 #include "scene/gui/tab_container.h"
 #include "scene/gui/texture_button.h"
@@ -285,6 +286,16 @@ void ScriptEditorDebugger::_video_mem_export() {
 	file_dialog->popup_file_dialog();
 }
 
+void ScriptEditorDebugger::_memory_tags_request() {
+	_put_msg("core:memory_tags", Array());
+}
+
+void ScriptEditorDebugger::_memory_sample_rate_changed(double p_rate) {
+	Array msg;
+	msg.push_back(int(p_rate));
+	_put_msg("core:memory_sample_rate", msg);
+}
+
 Size2 ScriptEditorDebugger::get_minimum_size() const {
 	Size2 ms = MarginContainer::get_minimum_size();
 	ms.y = MAX(ms.y, 250 * EDSCALE);
@@ -362,6 +373,35 @@ void ScriptEditorDebugger::_parse_message(const String &p_msg, const Array &p_da
 		vmem_total->set_tooltip(TTR("Bytes:") + " " + itos(total));
 		vmem_total->set_text(String::humanize_size(total));
 
+	} else if (p_msg == "memory:tags") {
+		mtag_tree->clear();
+		TreeItem *root = mtag_tree->create_item();
+		DebuggerMarshalls::MemoryTagUsage usage;
+		usage.deserialize(p_data);
+
+		Map<String, TreeItem *> tag_items;
+		for (int i = 0; i < usage.tags.size(); i++) {
+			const DebuggerMarshalls::MemoryTagInfo &info = usage.tags[i];
+			TreeItem *it = mtag_tree->create_item(root);
+			it->set_text(0, info.name);
+			it->set_text(1, String::humanize_size(info.bytes));
+			it->set_tooltip(1, TTR("Bytes:") + " " + itos(info.bytes));
+			it->set_text(2, itos(info.allocs));
+			tag_items[info.name] = it;
+		}
+
+		// Sampled allocation sites go under the subsystem they were tagged with.
+		for (int i = 0; i < usage.samples.size(); i++) {
+			const DebuggerMarshalls::MemorySampleInfo &info = usage.samples[i];
+			Map<String, TreeItem *>::Element *E = tag_items.find(info.tag);
+			TreeItem *it = mtag_tree->create_item(E ? E->get() : root);
+			it->set_text(0, info.site != String() ? info.site : TTR("(unknown site)"));
+			it->set_text(1, String::humanize_size(info.bytes));
+			it->set_tooltip(1, TTR("Bytes:") + " " + itos(info.bytes));
+			it->set_text(2, itos(info.count));
+		}
+
+
 	} else if (p_msg == "stack_dump") {
 		DebuggerMarshalls::ScriptStackDump stack;
 		stack.deserialize(p_data);
@@ -736,6 +776,7 @@ void ScriptEditorDebugger::_notification(int p_what) {
 			error_tree->connect("item_activated", callable_mp(this, &ScriptEditorDebugger::_error_activated));
 			vmem_refresh->set_icon(get_theme_icon("Reload", "EditorIcons"));
 			vmem_export->set_icon(get_theme_icon("Save", "EditorIcons"));
+			mtag_refresh->set_icon(get_theme_icon("Reload", "EditorIcons"));
 
 			reason->add_theme_color_override("font_color", get_theme_color("error_color", "Editor"));
 
@@ -810,6 +851,7 @@ void ScriptEditorDebugger::_notification(int p_what) {
 			docontinue->set_icon(get_theme_icon("DebugContinue", "EditorIcons"));
 			vmem_refresh->set_icon(get_theme_icon("Reload", "EditorIcons"));
 			vmem_export->set_icon(get_theme_icon("Save", "EditorIcons"));
+			mtag_refresh->set_icon(get_theme_icon("Reload", "EditorIcons"));
 		} break;
 	}
 }
@@ -847,12 +889,18 @@ void ScriptEditorDebugger::start(Ref<RemoteDebuggerPeer> p_peer) {
 	tabs->set_current_tab(0);
 	_set_reason_text(TTR("Debug session started."), MESSAGE_SUCCESS);
 	_update_buttons_state();
+
+	if (mtag_sample_rate->get_value() > 0) {
+		_memory_sample_rate_changed(mtag_sample_rate->get_value());
+	}
 }
 
 void ScriptEditorDebugger::_update_buttons_state() {
 	const bool active = is_session_active();
 	const bool has_editor_tree = active && editor_remote_tree && editor_remote_tree->get_selected();
 	vmem_refresh->set_disabled(!active);
+	mtag_refresh->set_disabled(!active);
+	mtag_sample_rate->set_editable(active);
 	step->set_disabled(!active || !breaked || !can_debug);
 	next->set_disabled(!active || !breaked || !can_debug);
 	copy->set_disabled(!active || !breaked);
@@ -1381,6 +1429,8 @@ void ScriptEditorDebugger::_tab_changed(int p_tab) {
 	if (tabs->get_tab_title(p_tab) == TTR("Video RAM")) {
 		// "Video RAM" tab was clicked, refresh the data it's displaying when entering the tab.
 		_video_mem_request();
+	} else if (tabs->get_tab_title(p_tab) == TTR("Memory Tags")) {
+		_memory_tags_request();
 	}
 }
 
@@ -1638,6 +1688,47 @@ ScriptEditorDebugger::ScriptEditorDebugger(EditorNode *p_editor) {
 		tabs->add_child(vmem_vb);
 	}
 
+	{ //memory tags
+		VBoxContainer *mtag_vb = memnew(VBoxContainer);
+		HBoxContainer *mtag_hb = memnew(HBoxContainer);
+		Label *mtlb = memnew(Label(TTR("Memory Usage by Subsystem:") + " "));
+		mtlb->set_h_size_flags(SIZE_EXPAND_FILL);
+		mtag_hb->add_child(mtlb);
+		mtag_hb->add_child(memnew(Label(TTR("Sample Every:") + " ")));
+		mtag_sample_rate = memnew(SpinBox);
+		mtag_sample_rate->set_min(0);
+		mtag_sample_rate->set_max(1000000);
+		mtag_sample_rate->set_suffix(TTR("allocs"));
+		mtag_sample_rate->set_tooltip(TTR("Record the site of every nth allocation, 0 disables sampling.\nChanging it clears the previous samples."));
+		mtag_hb->add_child(mtag_sample_rate);
+		mtag_refresh = memnew(Button);
+		mtag_refresh->set_flat(true);
+		mtag_hb->add_child(mtag_refresh);
+		mtag_vb->add_child(mtag_hb);
+		mtag_sample_rate->connect("value_changed", callable_mp(this, &ScriptEditorDebugger::_memory_sample_rate_changed));
+		mtag_refresh->connect("pressed", callable_mp(this, &ScriptEditorDebugger::_memory_tags_request));
+
+		mtag_tree = memnew(Tree);
+		mtag_tree->set_v_size_flags(SIZE_EXPAND_FILL);
+		mtag_tree->set_h_size_flags(SIZE_EXPAND_FILL);
+		mtag_vb->add_child(mtag_tree);
+
+		mtag_vb->set_name(TTR("Memory Tags"));
+		mtag_tree->set_columns(3);
+		mtag_tree->set_column_titles_visible(true);
+		mtag_tree->set_column_title(0, TTR("Subsystem / Site"));
+		mtag_tree->set_column_expand(0, true);
+		mtag_tree->set_column_expand(1, false);
+		mtag_tree->set_column_title(1, TTR("Usage"));
+		mtag_tree->set_column_min_width(1, 100 * EDSCALE);
+		mtag_tree->set_column_expand(2, false);
+		mtag_tree->set_column_title(2, TTR("Allocations"));
+		mtag_tree->set_column_min_width(2, 100 * EDSCALE);
+		mtag_tree->set_hide_root(true);
+
+		tabs->add_child(mtag_vb);
+	}
+
 	{ // misc
 		VBoxContainer *misc = memnew(VBoxContainer);
 		misc->set_name(TTR("Misc"));
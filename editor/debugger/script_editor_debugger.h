@@ -54,6 +54,7 @@ class EditorVisualProfiler;
 class EditorNetworkProfiler;
 class EditorPerformanceProfiler;
 class SceneDebuggerTree;
+class SpinBox;
 
 class ScriptEditorDebugger : public MarginContainer {
 	GDCLASS(ScriptEditorDebugger, MarginContainer);
@@ -121,6 +122,10 @@ private:
 	Button *vmem_export;
 	LineEdit *vmem_total;
 
+	Tree *mtag_tree;
+	Button *mtag_refresh;
+	SpinBox *mtag_sample_rate;
+
 	Tree *stack_dump;
 	EditorDebuggerInspector *inspector;
 	SceneDebuggerTree *scene_tree;
@@ -159,6 +164,9 @@ private:
 	void _video_mem_request();
 	void _video_mem_export();
 
+	void _memory_tags_request();
+	void _memory_sample_rate_changed(double p_rate);
+
 	int _get_node_path_cache(const NodePath &p_path);
 
 	int _get_res_path_cache(const String &p_path);
@@ -30,13 +30,16 @@
 
 #include "editor_file_system.h"
 
+#include "core/engine.h"
 #include "core/io/resource_importer.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "core/os/file_access.h"
 #include "core/os/os.h"
+#include "core/os/threaded_array_processor.h"
 #include "core/project_settings.h"
 #include "core/variant_parser.h"
+#include "core/version.h"
 #include "editor_node.h"
 #include "editor_resource_preview.h"
 #include "editor_settings.h"
@@ -1655,6 +1658,15 @@ void EditorFileSystem::_reimport_file(const String &p_file) {
 	bool found = _find_file(p_file, &fs, cpos);
 	ERR_FAIL_COND_MSG(!found, "Can't find file '" + p_file + "'.");
 
+	String type;
+	if (_import_file(p_file, &type)) {
+		_update_imported_file(fs, cpos, p_file, type);
+	}
+}
+
+// Runs the importer and writes the .import and .md5 files. Does not touch the filesystem tree,
+// so it can be called from the import worker threads for importers that allow it.
+bool EditorFileSystem::_import_file(const String &p_file, String *r_type) {
 	//try to obtain existing params
 
 	Map<StringName, Variant> params;
@@ -1679,6 +1691,7 @@ void EditorFileSystem::_reimport_file(const String &p_file) {
 		}
 
 	} else {
+		MutexLock lock(late_added_files_mutex);
 		late_added_files.insert(p_file); //imported files do not call update_file(), but just in case..
 	}
 
@@ -1695,7 +1708,7 @@ void EditorFileSystem::_reimport_file(const String &p_file) {
 		load_default = true;
 		if (importer.is_null()) {
 			ERR_PRINT("BUG: File queued for import, but can't be imported!");
-			ERR_FAIL();
+			ERR_FAIL_V(false);
 		}
 	}
 
@@ -1722,11 +1735,28 @@ void EditorFileSystem::_reimport_file(const String &p_file) {
 
 	//finally, perform import!!
 	String base_path = ResourceFormatImporter::get_singleton()->get_import_base_path(p_file);
+	String source_md5 = FileAccess::get_md5(p_file);
 
 	List<String> import_variants;
 	List<String> gen_files;
 	Variant metadata;
-	Error err = importer->import(p_file, base_path, params, &import_variants, &gen_files, &metadata);
+	Error err;
+
+	String cache_key;
+	if (import_cache_path != String() && importer->get_save_extension() != "") {
+		cache_key = _get_import_cache_key(source_md5, importer, opts, params);
+	}
+
+	if (cache_key != String() && _restore_from_import_cache(cache_key, base_path, &import_variants, &metadata)) {
+		err = OK;
+	} else {
+		err = importer->import(p_file, base_path, params, &import_variants, &gen_files, &metadata);
+
+		//generated files can live anywhere in the project, so only self-contained imports are cached
+		if (err == OK && cache_key != String() && gen_files.empty()) {
+			_store_in_import_cache(cache_key, base_path, importer, import_variants, metadata);
+		}
+	}
 
 	if (err != OK) {
 		ERR_PRINT("Error importing '" + p_file + "'.");
@@ -1735,7 +1765,7 @@ void EditorFileSystem::_reimport_file(const String &p_file) {
 	//as import is complete, save the .import file
 
 	FileAccess *f = FileAccess::open(p_file + ".import", FileAccess::WRITE);
-	ERR_FAIL_COND_MSG(!f, "Cannot open file from path '" + p_file + ".import'.");
+	ERR_FAIL_COND_V_MSG(!f, false, "Cannot open file from path '" + p_file + ".import'.");
 
 	//write manually, as order matters ([remap] has to go first for performance).
 	f->store_line("[remap]");
@@ -1816,21 +1846,219 @@ void EditorFileSystem::_reimport_file(const String &p_file) {
 
 	// Store the md5's of the various files. These are stored separately so that the .import files can be version controlled.
 	FileAccess *md5s = FileAccess::open(base_path + ".md5", FileAccess::WRITE);
-	ERR_FAIL_COND_MSG(!md5s, "Cannot open MD5 file '" + base_path + ".md5'.");
+	ERR_FAIL_COND_V_MSG(!md5s, false, "Cannot open MD5 file '" + base_path + ".md5'.");
 
-	md5s->store_line("source_md5=\"" + FileAccess::get_md5(p_file) + "\"");
+	md5s->store_line("source_md5=\"" + source_md5 + "\"");
 	if (dest_paths.size()) {
 		md5s->store_line("dest_md5=\"" + FileAccess::get_multiple_md5(dest_paths) + "\"\n");
 	}
 	md5s->close();
 	memdelete(md5s);
 
+	*r_type = importer->get_resource_type();
+	return true;
+}
+
+String EditorFileSystem::_get_import_cache_key(const String &p_source_md5, const Ref<ResourceImporter> &p_importer, const List<ResourceImporter::ImportOption> &p_options, const Map<StringName, Variant> &p_params) const {
+	String key = p_source_md5 + ":" + p_importer->get_importer_name() + ":" + itos(p_importer->get_format_version()) + ":" + p_importer->get_import_settings_string();
+	key += ":" + String(VERSION_FULL_BUILD) + ":" + String(Engine::get_singleton()->get_version_info()["hash"]);
+
+	for (const List<ResourceImporter::ImportOption>::Element *E = p_options.front(); E; E = E->next()) {
+		const Variant &param = p_params[E->get().option.name];
+		String value;
+		VariantWriter::write_to_string(param, value);
+		key += ":" + String(E->get().option.name) + "=" + value;
+
+		//options pointing to other project files (e.g. the normal map used for roughness) also depend on their contents
+		if (param.get_type() == Variant::STRING) {
+			String path = param;
+			if (path.begins_with("res://") && FileAccess::exists(path)) {
+				key += ":" + FileAccess::get_md5(path);
+			}
+		}
+	}
+
+	return key.md5_text();
+}
+
+bool EditorFileSystem::_restore_from_import_cache(const String &p_key, const String &p_base_path, List<String> *r_variants, Variant *r_metadata) {
+	String entry_path = import_cache_path.plus_file(p_key.substr(0, 2)).plus_file(p_key);
+
+	Ref<ConfigFile> manifest;
+	manifest.instance();
+	if (manifest->load(entry_path.plus_file("manifest.cfg")) != OK) {
+		return false;
+	}
+
+	Vector<String> files = manifest->get_value("entry", "files", Vector<String>());
+	if (files.empty()) {
+		return false;
+	}
+
+	DirAccessRef da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+	String global_base_path = ProjectSettings::get_singleton()->globalize_path(p_base_path);
+	for (int i = 0; i < files.size(); i++) {
+		if (da->copy(entry_path.plus_file("output" + files[i]), global_base_path + files[i]) != OK) {
+			return false;
+		}
+	}
+
+	Vector<String> variants = manifest->get_value("entry", "variants", Vector<String>());
+	for (int i = 0; i < variants.size(); i++) {
+		r_variants->push_back(variants[i]);
+	}
+	*r_metadata = manifest->get_value("entry", "metadata", Variant());
+
+	{
+		//entries used least recently are the first evicted when trimming
+		MutexLock lock(import_cache_mutex);
+		manifest->set_value("entry", "last_used", (int64_t)OS::get_singleton()->get_unix_time());
+		manifest->save(entry_path.plus_file("manifest.cfg"));
+	}
+
+	print_verbose("EditorFileSystem: Reused cached import for '" + p_base_path + "' (" + p_key + ").");
+	return true;
+}
+
+void EditorFileSystem::_store_in_import_cache(const String &p_key, const String &p_base_path, const Ref<ResourceImporter> &p_importer, const List<String> &p_variants, const Variant &p_metadata) {
+	Vector<String> files;
+	Vector<String> variants;
+	if (p_variants.size()) {
+		for (const List<String>::Element *E = p_variants.front(); E; E = E->next()) {
+			files.push_back("." + E->get() + "." + p_importer->get_save_extension());
+			variants.push_back(E->get());
+		}
+	} else {
+		files.push_back("." + p_importer->get_save_extension());
+	}
+
+	//identical sources may be imported at the same time from several threads
+	MutexLock lock(import_cache_mutex);
+
+	String entry_path = import_cache_path.plus_file(p_key.substr(0, 2)).plus_file(p_key);
+	DirAccessRef da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+	if (da->file_exists(entry_path.plus_file("manifest.cfg"))) {
+		return;
+	}
+
+	Error err = da->make_dir_recursive(entry_path);
+	ERR_FAIL_COND_MSG(err != OK, "Cannot create import cache folder '" + entry_path + "'.");
+
+	String global_base_path = ProjectSettings::get_singleton()->globalize_path(p_base_path);
+	uint64_t size = 0;
+	for (int i = 0; i < files.size(); i++) {
+		err = da->copy(global_base_path + files[i], entry_path.plus_file("output" + files[i]));
+		ERR_FAIL_COND_MSG(err != OK, "Cannot store '" + p_base_path + files[i] + "' in the import cache.");
+
+		FileAccessRef f = FileAccess::open(entry_path.plus_file("output" + files[i]), FileAccess::READ);
+		if (f) {
+			size += f->get_len();
+		}
+	}
+
+	//the manifest is written last, entries without one are ignored
+	Ref<ConfigFile> manifest;
+	manifest.instance();
+	manifest->set_value("entry", "files", files);
+	manifest->set_value("entry", "variants", variants);
+	manifest->set_value("entry", "size", size);
+	manifest->set_value("entry", "last_used", (int64_t)OS::get_singleton()->get_unix_time());
+	if (p_metadata != Variant()) {
+		manifest->set_value("entry", "metadata", p_metadata);
+	}
+	manifest->save(entry_path.plus_file("manifest.cfg"));
+}
+
+void EditorFileSystem::_trim_import_cache() {
+	if (import_cache_path == String() || import_cache_max_size == 0) {
+		return;
+	}
+
+	DirAccessRef da = DirAccess::open(import_cache_path);
+	if (!da) {
+		return;
+	}
+
+	//entries are grouped in folders named after the first two characters of their key
+	Vector<String> buckets;
+	da->list_dir_begin();
+	while (true) {
+		String f = da->get_next();
+		if (f == "") {
+			break;
+		}
+		if (da->current_is_dir() && !f.begins_with(".")) {
+			buckets.push_back(import_cache_path.plus_file(f));
+		}
+	}
+	da->list_dir_end();
+
+	Vector<ImportCacheEntry> entries;
+	uint64_t total_size = 0;
+	for (int i = 0; i < buckets.size(); i++) {
+		if (da->change_dir(buckets[i]) != OK) {
+			continue;
+		}
+
+		da->list_dir_begin();
+		while (true) {
+			String f = da->get_next();
+			if (f == "") {
+				break;
+			}
+			if (!da->current_is_dir() || f.begins_with(".")) {
+				continue;
+			}
+
+			ImportCacheEntry entry;
+			entry.path = buckets[i].plus_file(f);
+
+			Ref<ConfigFile> manifest;
+			manifest.instance();
+			if (manifest->load(entry.path.plus_file("manifest.cfg")) != OK) {
+				continue;
+			}
+
+			entry.files = manifest->get_value("entry", "files", Vector<String>());
+			entry.size = manifest->get_value("entry", "size", 0);
+			entry.last_used = manifest->get_value("entry", "last_used", 0);
+			total_size += entry.size;
+			entries.push_back(entry);
+		}
+		da->list_dir_end();
+	}
+
+	if (total_size <= import_cache_max_size) {
+		return;
+	}
+
+	entries.sort();
+
+	int removed = 0;
+	for (int i = 0; i < entries.size() && total_size > import_cache_max_size; i++) {
+		const ImportCacheEntry &entry = entries[i];
+
+		//the manifest goes first, so a partially removed entry is never reused
+		da->remove(entry.path.plus_file("manifest.cfg"));
+		for (int j = 0; j < entry.files.size(); j++) {
+			da->remove(entry.path.plus_file("output" + entry.files[j]));
+		}
+		da->remove(entry.path);
+
+		total_size -= entry.size;
+		removed++;
+	}
+
+	print_verbose("EditorFileSystem: Evicted " + itos(removed) + " entries from the import cache.");
+}
+
+void EditorFileSystem::_update_imported_file(EditorFileSystemDirectory *p_dir, int p_file_pos, const String &p_file, const String &p_type) {
 	//update modified times, to avoid reimport
-	fs->files[cpos]->modified_time = FileAccess::get_modified_time(p_file);
-	fs->files[cpos]->import_modified_time = FileAccess::get_modified_time(p_file + ".import");
-	fs->files[cpos]->deps = _get_dependencies(p_file);
-	fs->files[cpos]->type = importer->get_resource_type();
-	fs->files[cpos]->import_valid = ResourceLoader::is_import_valid(p_file);
+	p_dir->files[p_file_pos]->modified_time = FileAccess::get_modified_time(p_file);
+	p_dir->files[p_file_pos]->import_modified_time = FileAccess::get_modified_time(p_file + ".import");
+	p_dir->files[p_file_pos]->deps = _get_dependencies(p_file);
+	p_dir->files[p_file_pos]->type = p_type;
+	p_dir->files[p_file_pos]->import_valid = ResourceLoader::is_import_valid(p_file);
 
 	//if file is currently up, maybe the source it was loaded from changed, so import math must be updated for it
 	//to reload properly
@@ -1847,6 +2075,19 @@ void EditorFileSystem::_reimport_file(const String &p_file) {
 	EditorResourcePreview::get_singleton()->check_for_invalidation(p_file);
 }
 
+void EditorFileSystem::_reimport_thread(uint32_t p_index, ImportThreadData *p_import_data) {
+	uint32_t max_index = p_import_data->max_index.load();
+	while (p_index > max_index && !p_import_data->max_index.compare_exchange_weak(max_index, p_index)) {
+	}
+
+	// Files are already imported one per CPU here, so importers that split up their own work
+	// (e.g. Image::compress) keep it on this thread instead of starting one more thread per CPU.
+	uint32_t prev_max_threads = thread_process_max_threads;
+	thread_process_max_threads = 1;
+	p_import_data->imported[p_index] = _import_file(p_import_data->files[p_index].path, &p_import_data->types[p_index]);
+	thread_process_max_threads = prev_max_threads;
+}
+
 void EditorFileSystem::_find_group_files(EditorFileSystemDirectory *efd, Map<String, Vector<String>> &group_files, Set<String> &groups_to_reimport) {
 	int fc = efd->files.size();
 	const EditorFileSystemDirectory::FileInfo *const *files = efd->files.ptr();
@@ -1877,6 +2118,15 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 		memdelete(da);
 	}
 
+	import_cache_path = String();
+	if (EDITOR_GET("filesystem/import/use_import_cache")) {
+		import_cache_path = EDITOR_GET("filesystem/import/import_cache_path");
+		if (import_cache_path == String()) {
+			import_cache_path = EditorSettings::get_singleton()->get_cache_dir().plus_file("import_cache");
+		}
+		import_cache_max_size = uint64_t(int(EDITOR_GET("filesystem/import/import_cache_max_size_mb"))) * 1024 * 1024;
+	}
+
 	importing = true;
 	EditorProgress pr("reimport", TTR("(Re)Importing Assets"), p_files.size());
 
@@ -1898,7 +2148,7 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 			//it's a regular file
 			ImportFile ifile;
 			ifile.path = p_files[i];
-			ifile.order = ResourceFormatImporter::get_singleton()->get_import_order(p_files[i]);
+			ResourceFormatImporter::get_singleton()->get_import_order_threads_and_importer(p_files[i], ifile.order, ifile.threaded, ifile.importer);
 			files.push_back(ifile);
 		}
 
@@ -1912,9 +2162,73 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 
 	files.sort();
 
+	// Files are processed in runs sharing the same import order and importer. Import order is what
+	// expresses dependencies (e.g. scenes import after the textures they use), so a run only starts
+	// once every lower-order file is done. Runs of importers that allow it are spread across threads.
+
+	int from = 0;
 	for (int i = 0; i < files.size(); i++) {
-		pr.step(files[i].path.get_file(), i);
-		_reimport_file(files[i].path);
+		if (i < files.size() - 1 && files[i].order == files[i + 1].order && files[i].importer == files[i + 1].importer) {
+			continue;
+		}
+
+		int count = i - from + 1;
+
+		if (files[from].threaded && count > 1) {
+			if (!import_threads_initialized) {
+				import_threads.init();
+				import_threads_initialized = true;
+			}
+
+			Vector<String> types;
+			types.resize(count);
+			Vector<bool> imported;
+			imported.resize(count);
+
+			ImportThreadData data;
+			data.files = &files[from];
+			data.types = types.ptrw();
+			data.imported = imported.ptrw();
+			data.max_index.store(0);
+
+			import_threads.begin_work(count, this, &EditorFileSystem::_reimport_thread, &data);
+
+			// Step the progress for each file as the workers pick it up.
+			int current_index = -1;
+			while (true) {
+				bool done_dispatching = import_threads.is_done_dispatching();
+				int max_index = data.max_index.load();
+				if (max_index > current_index) {
+					current_index = max_index;
+					pr.step(files[from + current_index].path.get_file(), from + current_index);
+				}
+				if (done_dispatching) {
+					break;
+				}
+				OS::get_singleton()->delay_usec(1000);
+			}
+
+			import_threads.end_work();
+
+			// The filesystem tree, resource cache and previews are only updated from the main thread.
+			for (int j = 0; j < count; j++) {
+				if (!imported[j]) {
+					continue;
+				}
+				EditorFileSystemDirectory *fs = nullptr;
+				int cpos = -1;
+				bool found = _find_file(files[from + j].path, &fs, cpos);
+				ERR_CONTINUE_MSG(!found, "Can't find file '" + files[from + j].path + "'.");
+				_update_imported_file(fs, cpos, files[from + j].path, types[j]);
+			}
+		} else {
+			for (int j = from; j <= i; j++) {
+				pr.step(files[j].path.get_file(), j);
+				_reimport_file(files[j].path);
+			}
+		}
+
+		from = i + 1;
 	}
 
 	//reimport groups
@@ -1931,6 +2245,7 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 	}
 
 	_save_filesystem_cache();
+	_trim_import_cache();
 	importing = false;
 	if (!is_scanning()) {
 		emit_signal("filesystem_changed");
@@ -2048,6 +2363,7 @@ EditorFileSystem::EditorFileSystem() {
 	importing = false;
 	use_threads = true;
 	thread_sources = nullptr;
+	import_threads_initialized = false;
 	new_filesystem = nullptr;
 
 	abort_scan = false;
@@ -2070,4 +2386,5 @@ EditorFileSystem::EditorFileSystem() {
 }
 
 EditorFileSystem::~EditorFileSystem() {
+	import_threads.finish();
 }
@@ -31,10 +31,12 @@
 #ifndef EDITOR_FILE_SYSTEM_H
 #define EDITOR_FILE_SYSTEM_H
 
+#include "core/io/resource_importer.h"
 #include "core/os/dir_access.h"
 #include "core/os/thread.h"
 #include "core/os/thread_safe.h"
 #include "core/set.h"
+#include "core/thread_work_pool.h"
 #include "scene/main/node.h"
 class FileAccess;
 
@@ -209,6 +211,8 @@ class EditorFileSystem : public Node {
 	void _update_extensions();
 
 	void _reimport_file(const String &p_file);
+	bool _import_file(const String &p_file, String *r_type);
+	void _update_imported_file(EditorFileSystemDirectory *p_dir, int p_file_pos, const String &p_file, const String &p_type);
 	Error _reimport_group(const String &p_group_file, const Vector<String> &p_files);
 
 	bool _test_for_reimport(const String &p_path, bool p_only_imported_files);
@@ -219,12 +223,42 @@ class EditorFileSystem : public Node {
 
 	struct ImportFile {
 		String path;
-		int order;
+		String importer;
+		bool threaded = false;
+		int order = 0;
 		bool operator<(const ImportFile &p_if) const {
-			return order < p_if.order;
+			return order == p_if.order ? (importer < p_if.importer) : (order < p_if.order);
 		}
 	};
 
+	struct ImportThreadData {
+		const ImportFile *files;
+		String *types;
+		bool *imported;
+		std::atomic<uint32_t> max_index;
+	};
+
+	Mutex late_added_files_mutex;
+
+	struct ImportCacheEntry {
+		String path;
+		Vector<String> files;
+		uint64_t size = 0;
+		uint64_t last_used = 0;
+		bool operator<(const ImportCacheEntry &p_entry) const { return last_used < p_entry.last_used; }
+	};
+
+	String import_cache_path;
+	uint64_t import_cache_max_size = 0;
+	Mutex import_cache_mutex;
+	String _get_import_cache_key(const String &p_source_md5, const Ref<ResourceImporter> &p_importer, const List<ResourceImporter::ImportOption> &p_options, const Map<StringName, Variant> &p_params) const;
+	bool _restore_from_import_cache(const String &p_key, const String &p_base_path, List<String> *r_variants, Variant *r_metadata);
+	void _store_in_import_cache(const String &p_key, const String &p_base_path, const Ref<ResourceImporter> &p_importer, const List<String> &p_variants, const Variant &p_metadata);
+	void _trim_import_cache();
+	ThreadWorkPool import_threads;
+	bool import_threads_initialized;
+	void _reimport_thread(uint32_t p_index, ImportThreadData *p_import_data);
+
 	void _scan_script_classes(EditorFileSystemDirectory *p_dir);
 	volatile bool update_script_classes_queued;
 	void _queue_update_script_classes();
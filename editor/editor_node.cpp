@@ -42,6 +42,7 @@
 #include "core/os/file_access.h"
 #include "core/os/keyboard.h"
 #include "core/os/os.h"
+#include "core/os/thread.h"
 #include "core/print_string.h"
 #include "core/project_settings.h"
 #include "core/translation.h"
@@ -3550,9 +3551,18 @@ void EditorNode::notify_all_debug_sessions_exited() {
 }
 
 void EditorNode::add_io_error(const String &p_error) {
+	if (Thread::get_caller_id() != Thread::get_main_id()) {
+		// Importers may run on worker threads, the error dialog can only be touched from the main thread.
+		singleton->call_deferred("_add_io_error_deferred", p_error);
+		return;
+	}
 	_load_error_notify(singleton, p_error);
 }
 
+void EditorNode::_add_io_error_deferred(const String &p_error) {
+	_load_error_notify(this, p_error);
+}
+
 void EditorNode::_load_error_notify(void *p_ud, const String &p_text) {
 	EditorNode *en = (EditorNode *)p_ud;
 	en->load_errors->add_image(en->gui_base->get_theme_icon("Error", "EditorIcons"));
@@ -5385,6 +5395,7 @@ void EditorNode::_bind_methods() {
 	ClassDB::bind_method("open_request", &EditorNode::open_request);
 	ClassDB::bind_method("_close_messages", &EditorNode::_close_messages);
 	ClassDB::bind_method("_show_messages", &EditorNode::_show_messages);
+	ClassDB::bind_method("_add_io_error_deferred", &EditorNode::_add_io_error_deferred);
 
 	ClassDB::bind_method("stop_child_process", &EditorNode::stop_child_process);
 
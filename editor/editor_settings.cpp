@@ -395,6 +395,11 @@ void EditorSettings::_load_defaults(Ref<ConfigFile> p_extra_config) {
 	hints["filesystem/import/pvrtc_texture_tool"] = PropertyInfo(Variant::STRING, "filesystem/import/pvrtc_texture_tool", PROPERTY_HINT_GLOBAL_FILE, "");
 #endif
 	_initial_set("filesystem/import/pvrtc_fast_conversion", false);
+	_initial_set("filesystem/import/use_import_cache", false);
+	_initial_set("filesystem/import/import_cache_path", "");
+	hints["filesystem/import/import_cache_path"] = PropertyInfo(Variant::STRING, "filesystem/import/import_cache_path", PROPERTY_HINT_GLOBAL_DIR);
+	_initial_set("filesystem/import/import_cache_max_size_mb", 2048);
+	hints["filesystem/import/import_cache_max_size_mb"] = PropertyInfo(Variant::INT, "filesystem/import/import_cache_max_size_mb", PROPERTY_HINT_RANGE, "0,65536,1,or_greater");
 
 	/* Docks */
 
@@ -43,6 +43,7 @@
 #include "core/io/resource_loader.h"
 #include "core/message_queue.h"
 #include "core/os/dir_access.h"
+#include "core/os/frame_allocator.h"
 #include "core/os/os.h"
 #include "core/project_settings.h"
 #include "core/register_core_types.h"
@@ -375,9 +376,22 @@ int Main::test_entrypoint(int argc, char *argv[], bool &tests_need_run) {
 		if (strncmp(argv[x], "--test", 6) == 0) {
 			tests_need_run = true;
 			OS::get_singleton()->initialize();
-			StringName::setup();
+			// Tests create objects and resources, so the core is set up as in setup().
+			engine = memnew(Engine);
+			ClassDB::init();
+			register_core_types();
+			register_core_driver_types();
+			globals = memnew(ProjectSettings);
+			message_queue = memnew(MessageQueue);
 			int status = test_main(argc, argv);
-			StringName::cleanup();
+			memdelete(message_queue);
+			message_queue = nullptr;
+			memdelete(globals);
+			globals = nullptr;
+			unregister_core_driver_types();
+			unregister_core_types();
+			memdelete(engine);
+			engine = nullptr;
 			// TODO: fix OS::singleton cleanup
 			return status;
 		}
@@ -2252,6 +2266,7 @@ bool Main::is_iterating() {
 // For performance metrics.
 static uint64_t physics_process_max = 0;
 static uint64_t idle_process_max = 0;
+static uint64_t frames_alloc_count = 0;
 
 bool Main::iteration() {
 	//for now do not error on this
@@ -2259,6 +2274,9 @@ bool Main::iteration() {
 
 	iterating++;
 
+	// Frame allocations made on the main thread are released when the iteration ends.
+	FrameAllocator::Scope frame_scope;
+
 	uint64_t ticks = OS::get_singleton()->get_ticks_usec();
 	Engine::get_singleton()->_frame_ticks = ticks;
 	main_timer_sync.set_cpu_ticks_usec(ticks);
@@ -2380,6 +2398,9 @@ bool Main::iteration() {
 		Engine::get_singleton()->_fps = frames;
 		performance->set_process_time(USEC_TO_SEC(idle_process_max));
 		performance->set_physics_process_time(USEC_TO_SEC(physics_process_max));
+		uint64_t alloc_count = Memory::get_total_alloc_count();
+		performance->set_allocations_per_frame(float(alloc_count - frames_alloc_count) / frames);
+		frames_alloc_count = alloc_count;
 		idle_process_max = 0;
 		physics_process_max = 0;
 
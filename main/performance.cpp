@@ -77,6 +77,12 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(PHYSICS_3D_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(PHYSICS_3D_ISLAND_COUNT);
 	BIND_ENUM_CONSTANT(AUDIO_OUTPUT_LATENCY);
+	BIND_ENUM_CONSTANT(MEMORY_ALLOCATIONS_PER_FRAME);
+	BIND_ENUM_CONSTANT(MEMORY_RENDERING);
+	BIND_ENUM_CONSTANT(MEMORY_PHYSICS);
+	BIND_ENUM_CONSTANT(MEMORY_SCRIPTING);
+	BIND_ENUM_CONSTANT(MEMORY_AUDIO);
+	BIND_ENUM_CONSTANT(MEMORY_RESOURCES);
 
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
@@ -121,6 +127,12 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		"physics_3d/collision_pairs",
 		"physics_3d/islands",
 		"audio/output_latency",
+		"memory/allocs_per_frame",
+		"memory/rendering",
+		"memory/physics",
+		"memory/scripting",
+		"memory/audio",
+		"memory/resources",
 
 	};
 
@@ -141,6 +153,18 @@ float Performance::get_monitor(Monitor p_monitor) const {
 			return Memory::get_mem_max_usage();
 		case MEMORY_MESSAGE_BUFFER_MAX:
 			return MessageQueue::get_singleton()->get_max_buffer_usage();
+		case MEMORY_ALLOCATIONS_PER_FRAME:
+			return _allocations_per_frame;
+		case MEMORY_RENDERING:
+			return Memory::get_tag_usage(Memory::TAG_RENDERING);
+		case MEMORY_PHYSICS:
+			return Memory::get_tag_usage(Memory::TAG_PHYSICS);
+		case MEMORY_SCRIPTING:
+			return Memory::get_tag_usage(Memory::TAG_SCRIPTING);
+		case MEMORY_AUDIO:
+			return Memory::get_tag_usage(Memory::TAG_AUDIO);
+		case MEMORY_RESOURCES:
+			return Memory::get_tag_usage(Memory::TAG_RESOURCES);
 		case OBJECT_COUNT:
 			return ObjectDB::get_object_count();
 		case OBJECT_RESOURCE_COUNT:
@@ -223,6 +247,12 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
 
 	};
 
@@ -237,6 +267,10 @@ void Performance::set_physics_process_time(float p_pt) {
 	_physics_process_time = p_pt;
 }
 
+void Performance::set_allocations_per_frame(float p_allocs) {
+	_allocations_per_frame = p_allocs;
+}
+
 void Performance::add_custom_monitor(const StringName &p_id, const Callable &p_callable, const Vector<Variant> &p_args) {
 	ERR_FAIL_COND_MSG(has_custom_monitor(p_id), "Custom monitor with id '" + String(p_id) + "' already exists.");
 	_monitor_map.insert(p_id, MonitorCall(p_callable, p_args));
@@ -283,6 +317,7 @@ uint64_t Performance::get_monitor_modification_time() {
 Performance::Performance() {
 	_process_time = 0;
 	_physics_process_time = 0;
+	_allocations_per_frame = 0;
 	_monitor_modification_time = 0;
 	singleton = this;
 }
@@ -47,6 +47,7 @@ class Performance : public Object {
 
 	float _process_time;
 	float _physics_process_time;
+	float _allocations_per_frame;
 
 	class MonitorCall {
 		Callable _callable;
@@ -92,6 +93,12 @@ public:
 		PHYSICS_3D_ISLAND_COUNT,
 		//physics
 		AUDIO_OUTPUT_LATENCY,
+		MEMORY_ALLOCATIONS_PER_FRAME,
+		MEMORY_RENDERING,
+		MEMORY_PHYSICS,
+		MEMORY_SCRIPTING,
+		MEMORY_AUDIO,
+		MEMORY_RESOURCES,
 		MONITOR_MAX
 	};
 
@@ -108,6 +115,7 @@ public:
 
 	void set_process_time(float p_pt);
 	void set_physics_process_time(float p_pt);
+	void set_allocations_per_frame(float p_allocs);
 
 	void add_custom_monitor(const StringName &p_id, const Callable &p_callable, const Vector<Variant> &p_args);
 	void remove_custom_monitor(const StringName &p_id);
@@ -31,6 +31,7 @@
 #include "register_types.h"
 
 #include "core/os/os.h"
+#include "core/os/threaded_array_processor.h"
 #include "servers/rendering_server.h"
 #include "texture_basisu.h"
 
@@ -91,7 +92,7 @@ static Vector<uint8_t> basis_universal_packer(const Ref<Image> &p_image, Image::
 		//params.m_no_selector_rdo = true;
 		params.m_auto_global_sel_pal = false;
 
-		basisu::job_pool jpool(OS::get_singleton()->get_processor_count());
+		basisu::job_pool jpool(thread_process_get_thread_count());
 		params.m_pJob_pool = &jpool;
 
 		params.m_mip_gen = false; //sorry, please some day support provided mipmaps.
@@ -32,6 +32,7 @@
 
 #include "core/os/os.h"
 #include "core/os/thread.h"
+#include "core/os/threaded_array_processor.h"
 #include "core/print_string.h"
 
 #include <ConvectionKernels.h>
@@ -217,7 +218,7 @@ void image_compress_cvtt(Image *p_image, float p_lossy_quality, Image::UsedChann
 #ifdef NO_THREADS
 	int num_job_threads = 0;
 #else
-	int num_job_threads = OS::get_singleton()->can_use_threads() ? (OS::get_singleton()->get_processor_count() - 1) : 0;
+	int num_job_threads = OS::get_singleton()->can_use_threads() ? (thread_process_get_thread_count() - 1) : 0;
 #endif
 
 	Vector<CVTTCompressionRowTask> tasks;
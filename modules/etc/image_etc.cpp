@@ -34,8 +34,58 @@
 #include "core/image.h"
 #include "core/os/copymem.h"
 #include "core/os/os.h"
+#include "core/os/threaded_array_processor.h"
 #include "core/print_string.h"
 
+// Mipmaps are split into jobs of at least this many 4x4 blocks, smaller ones are encoded by a single job.
+#define ETC_MIN_BLOCKS_PER_JOB 256
+
+struct ETCCompressMipmapTask {
+	const uint8_t *src;
+	int width;
+	int height;
+	unsigned int dst_ofs;
+	int jobs;
+};
+
+struct ETCCompressJob {
+	Vector<ETCCompressMipmapTask> tasks;
+	Etc::Image::Format format;
+	Etc::ErrorMetric error_metric;
+	float effort;
+	uint8_t *dst;
+	unsigned int dst_size;
+	int first_small_mipmap = 0;
+
+	void compress_mipmap(uint32_t p_index, void *p_userdata) {
+		const ETCCompressMipmapTask &task = tasks[p_index];
+
+		// convert source image to internal etc2comp format (which is equivalent to Image::FORMAT_RGBAF)
+		// NOTE: We can alternatively add a case to Image::convert to handle Image::FORMAT_RGBAF conversion.
+		Etc::ColorFloatRGBA *src_rgba_f = new Etc::ColorFloatRGBA[task.width * task.height];
+		for (int j = 0; j < task.width * task.height; j++) {
+			int si = j * 4; // RGBA8
+			src_rgba_f[j] = Etc::ColorFloatRGBA::ConvertFromRGBA8(task.src[si], task.src[si + 1], task.src[si + 2], task.src[si + 3]);
+		}
+
+		unsigned char *etc_data = nullptr;
+		unsigned int etc_data_len = 0;
+		unsigned int extended_width = 0, extended_height = 0;
+		int encoding_time = 0;
+		Etc::Encode((float *)src_rgba_f, task.width, task.height, format, error_metric, effort, task.jobs, task.jobs, &etc_data, &etc_data_len, &extended_width, &extended_height, &encoding_time);
+
+		CRASH_COND(task.dst_ofs + etc_data_len > dst_size);
+		memcpy(&dst[task.dst_ofs], etc_data, etc_data_len);
+
+		delete[] etc_data;
+		delete[] src_rgba_f;
+	}
+
+	void compress_small_mipmap(uint32_t p_index, void *p_userdata) {
+		compress_mipmap(first_small_mipmap + p_index, p_userdata);
+	}
+};
+
 static Image::Format _get_etc2_mode(Image::UsedChannels format) {
 	switch (format) {
 		case Image::USED_CHANNELS_R:
@@ -162,8 +212,7 @@ static void _compress_etc(Image *p_img, float p_lossy_quality, bool force_etc1_f
 	uint8_t *w = dst_data.ptrw();
 
 	// prepare parameters to be passed to etc2comp
-	int num_cpus = OS::get_singleton()->get_processor_count();
-	int encoding_time = 0;
+	int num_cpus = thread_process_get_thread_count();
 	float effort = 0.0; //default, reasonable time
 
 	if (p_lossy_quality > 0.75) {
@@ -174,37 +223,44 @@ static void _compress_etc(Image *p_img, float p_lossy_quality, bool force_etc1_f
 		effort = 0.8;
 	}
 
-	Etc::ErrorMetric error_metric = Etc::ErrorMetric::RGBX; // NOTE: we can experiment with other error metrics
-	Etc::Image::Format etc2comp_etc_format = _image_format_to_etc2comp_format(etc_format);
-
-	int wofs = 0;
+	ETCCompressJob job;
+	job.error_metric = Etc::ErrorMetric::RGBX; // NOTE: we can experiment with other error metrics
+	job.format = _image_format_to_etc2comp_format(etc_format);
+	job.effort = effort;
+	job.dst = w;
+	job.dst_size = target_size;
 
-	print_verbose("ETC: Begin encoding, format: " + Image::get_format_name(etc_format));
-	uint64_t t = OS::get_singleton()->get_ticks_msec();
 	for (int i = 0; i < mmc; i++) {
-		// convert source image to internal etc2comp format (which is equivalent to Image::FORMAT_RGBAF)
-		// NOTE: We can alternatively add a case to Image::convert to handle Image::FORMAT_RGBAF conversion.
 		int mipmap_ofs = 0, mipmap_size = 0, mipmap_w = 0, mipmap_h = 0;
 		img->get_mipmap_offset_size_and_dimensions(i, mipmap_ofs, mipmap_size, mipmap_w, mipmap_h);
-		const uint8_t *src = &r[mipmap_ofs];
 
-		Etc::ColorFloatRGBA *src_rgba_f = new Etc::ColorFloatRGBA[mipmap_w * mipmap_h];
-		for (int j = 0; j < mipmap_w * mipmap_h; j++) {
-			int si = j * 4; // RGBA8
-			src_rgba_f[j] = Etc::ColorFloatRGBA::ConvertFromRGBA8(src[si], src[si + 1], src[si + 2], src[si + 3]);
-		}
+		ETCCompressMipmapTask task;
+		task.src = &r[mipmap_ofs];
+		task.width = mipmap_w;
+		task.height = mipmap_h;
+		task.dst_ofs = Image::get_image_mipmap_offset(imgw, imgh, etc_format, i);
+		int blocks = ((mipmap_w + 3) / 4) * ((mipmap_h + 3) / 4);
+		task.jobs = CLAMP(blocks / ETC_MIN_BLOCKS_PER_JOB, 1, num_cpus);
+		job.tasks.push_back(task);
+	}
 
-		unsigned char *etc_data = nullptr;
-		unsigned int etc_data_len = 0;
-		unsigned int extended_width = 0, extended_height = 0;
-		Etc::Encode((float *)src_rgba_f, mipmap_w, mipmap_h, etc2comp_etc_format, error_metric, effort, num_cpus, num_cpus, &etc_data, &etc_data_len, &extended_width, &extended_height, &encoding_time);
+	print_verbose("ETC: Begin encoding, format: " + Image::get_format_name(etc_format));
+	uint64_t t = OS::get_singleton()->get_ticks_msec();
 
-		CRASH_COND(wofs + etc_data_len > target_size);
-		memcpy(&w[wofs], etc_data, etc_data_len);
-		wofs += etc_data_len;
+	// Mipmaps large enough to split are encoded one after another, each spreading its blocks across its jobs.
+	// The small ones left have a single job each, so they are encoded at the same time instead.
+	while (job.first_small_mipmap < mmc && job.tasks[job.first_small_mipmap].jobs > 1) {
+		job.compress_mipmap(job.first_small_mipmap, nullptr);
+		job.first_small_mipmap++;
+	}
 
-		delete[] etc_data;
-		delete[] src_rgba_f;
+	int small_mipmaps = mmc - job.first_small_mipmap;
+	if (small_mipmaps > 1 && OS::get_singleton()->can_use_threads()) {
+		thread_process_array(small_mipmaps, &job, &ETCCompressJob::compress_small_mipmap, (void *)nullptr);
+	} else {
+		for (int i = job.first_small_mipmap; i < mmc; i++) {
+			job.compress_mipmap(i, nullptr);
+		}
 	}
 
 	print_verbose("ETC: Time encoding: " + rtos(OS::get_singleton()->get_ticks_msec() - t));
@@ -260,6 +260,8 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 		return Variant();
 	}
 
+	MemoryTagScope memory_tag_scope(Memory::TAG_SCRIPTING, "GDScriptFunction::call");
+
 	r_err.error = Callable::CallError::CALL_OK;
 
 	Variant self;
@@ -30,8 +30,28 @@
 
 #include "image_compress_squish.h"
 
+#include "core/os/threaded_array_processor.h"
+
 #include <squish.h>
 
+// A row of 4x4 blocks from one mipmap, compressed independently from the others.
+struct SquishCompressRowTask {
+	const uint8_t *src;
+	uint8_t *dst;
+	int width;
+	int height;
+};
+
+struct SquishCompressJob {
+	Vector<SquishCompressRowTask> tasks;
+	int flags;
+
+	void compress_row(uint32_t p_index, void *p_userdata) {
+		const SquishCompressRowTask &task = tasks[p_index];
+		squish::CompressImage(task.src, task.width, task.height, task.dst, flags);
+	}
+};
+
 void image_decompress_squish(Image *p_image) {
 	int w = p_image->get_width();
 	int h = p_image->get_height();
@@ -142,17 +162,39 @@ void image_compress_squish(Image *p_image, float p_lossy_quality, Image::UsedCha
 
 		int dst_ofs = 0;
 
+		SquishCompressJob job;
+		job.flags = squish_comp;
+
 		for (int i = 0; i <= mm_count; i++) {
 			int bw = w % 4 != 0 ? w + (4 - w % 4) : w;
 			int bh = h % 4 != 0 ? h + (4 - h % 4) : h;
 
 			int src_ofs = p_image->get_mipmap_offset(i);
-			squish::CompressImage(&rb[src_ofs], w, h, &wb[dst_ofs], squish_comp);
+			int row_size = (MAX(4, bw) * 4) >> shift;
+
+			for (int y = 0; y < h; y += 4) {
+				SquishCompressRowTask task;
+				task.src = &rb[src_ofs + y * w * 4];
+				task.dst = &wb[dst_ofs + (y / 4) * row_size];
+				task.width = w;
+				task.height = MIN(4, h - y);
+				job.tasks.push_back(task);
+			}
+
 			dst_ofs += (MAX(4, bw) * MAX(4, bh)) >> shift;
 			w = MAX(w / 2, 1);
 			h = MAX(h / 2, 1);
 		}
 
+		// Every row writes its own blocks, so the result is the same regardless of the thread count.
+		if (job.tasks.size() > 1 && OS::get_singleton()->can_use_threads()) {
+			thread_process_array(job.tasks.size(), &job, &SquishCompressJob::compress_row, (void *)nullptr);
+		} else {
+			for (int i = 0; i < job.tasks.size(); i++) {
+				job.compress_row(i, nullptr);
+			}
+		}
+
 		p_image->create(p_image->get_width(), p_image->get_height(), p_image->has_mipmaps(), target_format, data);
 	}
 }
@@ -31,10 +31,17 @@
 #ifndef CPU_PARTICLES_2D_H
 #define CPU_PARTICLES_2D_H
 
+#include "core/local_vector.h"
 #include "core/rid.h"
 #include "scene/2d/node_2d.h"
 #include "scene/resources/texture.h"
 
+class ThreadWorkPool;
+
+namespace TestCPUParticles {
+class Simulator;
+}
+
 class CPUParticles2D : public Node2D {
 private:
 	GDCLASS(CPUParticles2D, Node2D);
@@ -79,6 +86,8 @@ public:
 	};
 
 private:
+	friend class TestCPUParticles::Simulator; // Steps emitters on a given pool in tests.
+
 	bool emitting;
 
 	struct Particle {
@@ -112,21 +121,15 @@ private:
 	Vector<float> particle_data;
 	Vector<int> particle_order;
 
-	struct SortLifetime {
-		const Particle *particles;
+	struct SortKey {
+		const float *keys;
 
 		bool operator()(int p_a, int p_b) const {
-			return particles[p_a].time > particles[p_b].time;
+			return keys[p_a] < keys[p_b];
 		}
 	};
 
-	struct SortAxis {
-		const Particle *particles;
-		Vector2 axis;
-		bool operator()(int p_a, int p_b) const {
-			return axis.dot(particles[p_a].transform[2]) < axis.dot(particles[p_b].transform[2]);
-		}
-	};
+	LocalVector<float> particle_sort_keys;
 
 	//
 
@@ -173,9 +176,34 @@ private:
 
 	Vector2 gravity;
 
+	// Particles are simulated and copied to the buffer in blocks of this size,
+	// which are spread over the SceneTree process threads.
+	enum {
+		PROCESS_BLOCK_SIZE = 1024
+	};
+
+	struct ProcessStep {
+		Particle *particles = nullptr;
+		float delta = 0.0;
+		float prev_time = 0.0;
+		float system_phase = 0.0;
+		uint32_t random_seed = 0;
+		Transform2D emission_xform;
+		Transform2D velocity_xform;
+	};
+
+	struct BufferFill {
+		const Particle *particles = nullptr;
+		const int *order = nullptr;
+		float *data = nullptr;
+	};
+
 	void _update_internal();
-	void _particles_process(float p_delta);
-	void _update_particle_data_buffer();
+	ThreadWorkPool *_get_process_thread_pool() const;
+	void _particles_process(float p_delta, ThreadWorkPool *p_pool);
+	void _particles_process_block(uint32_t p_block, const ProcessStep *p_step);
+	void _update_particle_data_buffer(ThreadWorkPool *p_pool);
+	void _update_particle_data_block(uint32_t p_block, const BufferFill *p_fill);
 
 	Mutex update_mutex;
 
@@ -76,11 +76,11 @@ void TileMap::_notification(int p_what) {
 
 		case NOTIFICATION_EXIT_TREE: {
 			_update_quadrant_space(RID());
-			for (Map<PosKey, Quadrant>::Element *E = quadrant_map.front(); E; E = E->next()) {
-				Quadrant &q = E->get();
+			for (int i = quadrant_map.next_cursor(-1); i != -1; i = quadrant_map.next_cursor(i)) {
+				Quadrant &q = *quadrant_map.get_value_at_cursor(i);
 				if (navigation) {
-					for (Map<PosKey, Quadrant::NavPoly>::Element *F = q.navpoly_ids.front(); F; F = F->next()) {
-						NavigationServer2D::get_singleton()->region_set_map(F->get().region, RID());
+					for (int f = q.navpoly_ids.next_cursor(-1); f != -1; f = q.navpoly_ids.next_cursor(f)) {
+						NavigationServer2D::get_singleton()->region_set_map(q.navpoly_ids.get_value_at_cursor(f).region, RID());
 					}
 					q.navpoly_ids.clear();
 				}
@@ -90,8 +90,8 @@ void TileMap::_notification(int p_what) {
 					q.shape_owner_id = -1;
 				}
 
-				for (Map<PosKey, Quadrant::Occluder>::Element *F = q.occluder_instances.front(); F; F = F->next()) {
-					RS::get_singleton()->free(F->get().id);
+				for (int f = q.occluder_instances.next_cursor(-1); f != -1; f = q.occluder_instances.next_cursor(f)) {
+					RS::get_singleton()->free(q.occluder_instances.get_value_at_cursor(f).id);
 				}
 				q.occluder_instances.clear();
 			}
@@ -117,8 +117,8 @@ void TileMap::_notification(int p_what) {
 
 void TileMap::_update_quadrant_space(const RID &p_space) {
 	if (!use_parent) {
-		for (Map<PosKey, Quadrant>::Element *E = quadrant_map.front(); E; E = E->next()) {
-			Quadrant &q = E->get();
+		for (int i = quadrant_map.next_cursor(-1); i != -1; i = quadrant_map.next_cursor(i)) {
+			Quadrant &q = *quadrant_map.get_value_at_cursor(i);
 			PhysicsServer2D::get_singleton()->body_set_space(q.body, p_space);
 		}
 	}
@@ -141,8 +141,8 @@ void TileMap::_update_quadrant_transform() {
 		nav_rel = get_relative_transform_to_parent(navigation);
 	}
 
-	for (Map<PosKey, Quadrant>::Element *E = quadrant_map.front(); E; E = E->next()) {
-		Quadrant &q = E->get();
+	for (int i = quadrant_map.next_cursor(-1); i != -1; i = quadrant_map.next_cursor(i)) {
+		Quadrant &q = *quadrant_map.get_value_at_cursor(i);
 		Transform2D xform;
 		xform.set_origin(q.pos);
 
@@ -152,13 +152,15 @@ void TileMap::_update_quadrant_transform() {
 		}
 
 		if (navigation) {
-			for (Map<PosKey, Quadrant::NavPoly>::Element *F = q.navpoly_ids.front(); F; F = F->next()) {
-				NavigationServer2D::get_singleton()->region_set_transform(F->get().region, nav_rel * F->get().xform);
+			for (int f = q.navpoly_ids.next_cursor(-1); f != -1; f = q.navpoly_ids.next_cursor(f)) {
+				const Quadrant::NavPoly &np = q.navpoly_ids.get_value_at_cursor(f);
+				NavigationServer2D::get_singleton()->region_set_transform(np.region, nav_rel * np.xform);
 			}
 		}
 
-		for (Map<PosKey, Quadrant::Occluder>::Element *F = q.occluder_instances.front(); F; F = F->next()) {
-			RS::get_singleton()->canvas_light_occluder_set_transform(F->get().id, global_transform * F->get().xform);
+		for (int f = q.occluder_instances.next_cursor(-1); f != -1; f = q.occluder_instances.next_cursor(f)) {
+			const Quadrant::Occluder &oc = q.occluder_instances.get_value_at_cursor(f);
+			RS::get_singleton()->canvas_light_occluder_set_transform(oc.id, global_transform * oc.xform);
 		}
 	}
 }
@@ -356,14 +358,14 @@ void TileMap::update_dirty_quadrants() {
 		int shape_idx = 0;
 
 		if (navigation) {
-			for (Map<PosKey, Quadrant::NavPoly>::Element *E = q.navpoly_ids.front(); E; E = E->next()) {
-				NavigationServer2D::get_singleton()->region_set_map(E->get().region, RID());
+			for (int e = q.navpoly_ids.next_cursor(-1); e != -1; e = q.navpoly_ids.next_cursor(e)) {
+				NavigationServer2D::get_singleton()->region_set_map(q.navpoly_ids.get_value_at_cursor(e).region, RID());
 			}
 			q.navpoly_ids.clear();
 		}
 
-		for (Map<PosKey, Quadrant::Occluder>::Element *E = q.occluder_instances.front(); E; E = E->next()) {
-			RS::get_singleton()->free(E->get().id);
+		for (int e = q.occluder_instances.next_cursor(-1); e != -1; e = q.occluder_instances.next_cursor(e)) {
+			RS::get_singleton()->free(q.occluder_instances.get_value_at_cursor(e).id);
 		}
 		q.occluder_instances.clear();
 		Ref<ShaderMaterial> prev_material;
@@ -372,8 +374,8 @@ void TileMap::update_dirty_quadrants() {
 		RID prev_debug_canvas_item;
 
 		for (int i = 0; i < q.cells.size(); i++) {
-			Map<PosKey, Cell>::Element *E = tile_map.find(q.cells[i]);
-			Cell &c = E->get();
+			const PosKey &pk = q.cells[i];
+			const Cell &c = *_get_cell(pk);
 			//moment of truth
 			if (!tile_set->has_tile(c.id)) {
 				continue;
@@ -381,7 +383,7 @@ void TileMap::update_dirty_quadrants() {
 			Ref<Texture2D> tex = tile_set->tile_get_texture(c.id);
 			Vector2 tile_ofs = tile_set->tile_get_texture_offset(c.id);
 
-			Vector2 wofs = _map_to_world(E->key().x, E->key().y);
+			Vector2 wofs = _map_to_world(pk.x, pk.y);
 			Vector2 offset = wofs - q.pos + tofs;
 
 			if (!tex.is_valid()) {
@@ -562,7 +564,7 @@ void TileMap::update_dirty_quadrants() {
 							for (int k = 0; k < _shapes.size(); k++) {
 								Ref<ConvexPolygonShape2D> convex = _shapes[k];
 								if (convex.is_valid()) {
-									_add_shape(shape_idx, q, convex, shapes[j], xform, Vector2(E->key().x, E->key().y));
+									_add_shape(shape_idx, q, convex, shapes[j], xform, Vector2(pk.x, pk.y));
 #ifdef DEBUG_ENABLED
 								} else {
 									print_error("The TileSet assigned to the TileMap " + get_name() + " has an invalid convex shape.");
@@ -570,7 +572,7 @@ void TileMap::update_dirty_quadrants() {
 								}
 							}
 						} else {
-							_add_shape(shape_idx, q, shape, shapes[j], xform, Vector2(E->key().x, E->key().y));
+							_add_shape(shape_idx, q, shape, shapes[j], xform, Vector2(pk.x, pk.y));
 						}
 					}
 				}
@@ -604,7 +606,7 @@ void TileMap::update_dirty_quadrants() {
 					Quadrant::NavPoly np;
 					np.region = region;
 					np.xform = xform;
-					q.navpoly_ids[E->key()] = np;
+					q.navpoly_ids[pk] = np;
 
 					if (debug_navigation) {
 						RID debug_navigation_item = vs->canvas_item_create();
@@ -675,7 +677,7 @@ void TileMap::update_dirty_quadrants() {
 				Quadrant::Occluder oc;
 				oc.xform = xform;
 				oc.id = orid;
-				q.occluder_instances[E->key()] = oc;
+				q.occluder_instances[pk] = oc;
 			}
 		}
 
@@ -686,10 +688,19 @@ void TileMap::update_dirty_quadrants() {
 	pending_update = false;
 
 	if (quadrant_order_dirty) {
+		// Quadrants are drawn row by row, top to bottom.
+		Vector<PosKey> keys;
+		keys.resize(quadrant_map.size());
+		int count = 0;
+		for (int i = quadrant_map.next_cursor(-1); i != -1; i = quadrant_map.next_cursor(i)) {
+			keys.write[count++] = quadrant_map.get_key_at_cursor(i);
+		}
+		keys.sort();
+
 		int index = -(int64_t)0x80000000; //always must be drawn below children
-		for (Map<PosKey, Quadrant>::Element *E = quadrant_map.front(); E; E = E->next()) {
-			Quadrant &q = E->get();
-			for (List<RID>::Element *F = q.canvas_items.front(); F; F = F->next()) {
+		for (int i = 0; i < keys.size(); i++) {
+			const Quadrant &q = *quadrant_map.get(keys[i]);
+			for (const List<RID>::Element *F = q.canvas_items.front(); F; F = F->next()) {
 				RS::get_singleton()->canvas_item_set_draw_index(F->get(), index++);
 			}
 		}
@@ -708,13 +719,16 @@ void TileMap::_recompute_rect_cache() {
 	}
 
 	Rect2 r_total;
-	for (Map<PosKey, Quadrant>::Element *E = quadrant_map.front(); E; E = E->next()) {
+	bool first = true;
+	for (int i = quadrant_map.next_cursor(-1); i != -1; i = quadrant_map.next_cursor(i)) {
+		const PosKey &qk = quadrant_map.get_key_at_cursor(i);
 		Rect2 r;
-		r.position = _map_to_world(E->key().x * _get_quadrant_size(), E->key().y * _get_quadrant_size());
-		r.expand_to(_map_to_world(E->key().x * _get_quadrant_size() + _get_quadrant_size(), E->key().y * _get_quadrant_size()));
-		r.expand_to(_map_to_world(E->key().x * _get_quadrant_size() + _get_quadrant_size(), E->key().y * _get_quadrant_size() + _get_quadrant_size()));
-		r.expand_to(_map_to_world(E->key().x * _get_quadrant_size(), E->key().y * _get_quadrant_size() + _get_quadrant_size()));
-		if (E == quadrant_map.front()) {
+		r.position = _map_to_world(qk.x * _get_quadrant_size(), qk.y * _get_quadrant_size());
+		r.expand_to(_map_to_world(qk.x * _get_quadrant_size() + _get_quadrant_size(), qk.y * _get_quadrant_size()));
+		r.expand_to(_map_to_world(qk.x * _get_quadrant_size() + _get_quadrant_size(), qk.y * _get_quadrant_size() + _get_quadrant_size()));
+		r.expand_to(_map_to_world(qk.x * _get_quadrant_size(), qk.y * _get_quadrant_size() + _get_quadrant_size()));
+		if (first) {
+			first = false;
 			r_total = r;
 		} else {
 			r_total = r_total.merge(r);
@@ -729,10 +743,12 @@ void TileMap::_recompute_rect_cache() {
 #endif
 }
 
-Map<TileMap::PosKey, TileMap::Quadrant>::Element *TileMap::_create_quadrant(const PosKey &p_qk) {
+TileMap::Quadrant *TileMap::_create_quadrant(const PosKey &p_qk) {
 	Transform2D xform;
 	//xform.set_origin(Point2(p_qk.x,p_qk.y)*cell_size*quadrant_size);
-	Quadrant q;
+	Quadrant *qptr = memnew(Quadrant);
+	Quadrant &q = *qptr;
+	q.key = p_qk;
 	q.pos = _map_to_world(p_qk.x * _get_quadrant_size(), p_qk.y * _get_quadrant_size());
 	q.pos += get_cell_draw_offset();
 	if (tile_origin == TILE_ORIGIN_CENTER) {
@@ -769,11 +785,12 @@ Map<TileMap::PosKey, TileMap::Quadrant>::Element *TileMap::_create_quadrant(cons
 
 	rect_cache_dirty = true;
 	quadrant_order_dirty = true;
-	return quadrant_map.insert(p_qk, q);
+	quadrant_map.set(p_qk, qptr);
+	return qptr;
 }
 
-void TileMap::_erase_quadrant(Map<PosKey, Quadrant>::Element *Q) {
-	Quadrant &q = Q->get();
+void TileMap::_erase_quadrant(Quadrant *p_q) {
+	Quadrant &q = *p_q;
 	if (!use_parent) {
 		PhysicsServer2D::get_singleton()->free(q.body);
 	} else if (collision_parent) {
@@ -789,23 +806,24 @@ void TileMap::_erase_quadrant(Map<PosKey, Quadrant>::Element *Q) {
 	}
 
 	if (navigation) {
-		for (Map<PosKey, Quadrant::NavPoly>::Element *E = q.navpoly_ids.front(); E; E = E->next()) {
-			NavigationServer2D::get_singleton()->region_set_map(E->get().region, RID());
+		for (int e = q.navpoly_ids.next_cursor(-1); e != -1; e = q.navpoly_ids.next_cursor(e)) {
+			NavigationServer2D::get_singleton()->region_set_map(q.navpoly_ids.get_value_at_cursor(e).region, RID());
 		}
 		q.navpoly_ids.clear();
 	}
 
-	for (Map<PosKey, Quadrant::Occluder>::Element *E = q.occluder_instances.front(); E; E = E->next()) {
-		RS::get_singleton()->free(E->get().id);
+	for (int e = q.occluder_instances.next_cursor(-1); e != -1; e = q.occluder_instances.next_cursor(e)) {
+		RS::get_singleton()->free(q.occluder_instances.get_value_at_cursor(e).id);
 	}
 	q.occluder_instances.clear();
 
-	quadrant_map.erase(Q);
+	quadrant_map.erase(q.key);
+	memdelete(p_q);
 	rect_cache_dirty = true;
 }
 
-void TileMap::_make_quadrant_dirty(Map<PosKey, Quadrant>::Element *Q, bool update) {
-	Quadrant &q = Q->get();
+void TileMap::_make_quadrant_dirty(Quadrant *p_q, bool update) {
+	Quadrant &q = *p_q;
 	if (!q.dirty_list.in_list()) {
 		dirty_quadrant_list.add(&q.dirty_list);
 	}
@@ -823,6 +841,107 @@ void TileMap::_make_quadrant_dirty(Map<PosKey, Quadrant>::Element *Q, bool updat
 	}
 }
 
+const TileMap::Cell *TileMap::_get_cell(const PosKey &p_pk) const {
+	CellChunk *const *chunk = cell_chunks.getptr(_get_chunk_key(p_pk));
+	if (!chunk) {
+		return nullptr;
+	}
+
+	const Cell &c = (*chunk)->cells[_get_chunk_index(p_pk)];
+	return c.id == INVALID_CELL ? nullptr : &c;
+}
+
+// The caller has to give the cell a valid id.
+TileMap::Cell &TileMap::_insert_cell(const PosKey &p_pk) {
+	const PosKey ck = _get_chunk_key(p_pk);
+	CellChunk **chunk_ptr = cell_chunks.getptr(ck);
+	CellChunk *chunk;
+	if (chunk_ptr) {
+		chunk = *chunk_ptr;
+	} else {
+		chunk = memnew(CellChunk);
+		cell_chunks.set(ck, chunk);
+	}
+
+	Cell &c = chunk->cells[_get_chunk_index(p_pk)];
+	if (c.id == INVALID_CELL) {
+		chunk->used++;
+		cell_count++;
+	}
+	return c;
+}
+
+void TileMap::_erase_cell(const PosKey &p_pk) {
+	const PosKey ck = _get_chunk_key(p_pk);
+	CellChunk **chunk_ptr = cell_chunks.getptr(ck);
+	if (!chunk_ptr) {
+		return;
+	}
+
+	CellChunk *chunk = *chunk_ptr;
+	Cell &c = chunk->cells[_get_chunk_index(p_pk)];
+	if (c.id == INVALID_CELL) {
+		return;
+	}
+
+	c = Cell();
+	c.id = INVALID_CELL;
+	cell_count--;
+
+	chunk->used--;
+	if (chunk->used == 0) {
+		cell_chunks.erase(ck);
+		memdelete(chunk);
+	}
+}
+
+void TileMap::_clear_cells() {
+	for (int i = cell_chunks.next_cursor(-1); i != -1; i = cell_chunks.next_cursor(i)) {
+		memdelete(cell_chunks.get_value_at_cursor(i));
+	}
+	cell_chunks.clear();
+	cell_count = 0;
+}
+
+// Visits the used cells row by row, sorted like PosKey, so the order does not
+// depend on how the chunks were created.
+template <class F>
+void TileMap::_for_each_cell_sorted(F p_func) const {
+	Vector<PosKey> chunk_keys;
+	chunk_keys.resize(cell_chunks.size());
+	int count = 0;
+	for (int i = cell_chunks.next_cursor(-1); i != -1; i = cell_chunks.next_cursor(i)) {
+		chunk_keys.write[count++] = cell_chunks.get_key_at_cursor(i);
+	}
+	chunk_keys.sort();
+
+	Vector<const CellChunk *> row_chunks;
+	int row_start = 0;
+	while (row_start < chunk_keys.size()) {
+		// Chunks sharing a row of cells.
+		row_chunks.clear();
+		int row_end = row_start;
+		while (row_end < chunk_keys.size() && chunk_keys[row_end].y == chunk_keys[row_start].y) {
+			row_chunks.push_back(cell_chunks.get(chunk_keys[row_end]));
+			row_end++;
+		}
+
+		for (int y = 0; y < CHUNK_SIZE; y++) {
+			for (int i = 0; i < row_chunks.size(); i++) {
+				const PosKey &ck = chunk_keys[row_start + i];
+				const Cell *row = &row_chunks[i]->cells[y << CHUNK_SHIFT];
+				for (int x = 0; x < CHUNK_SIZE; x++) {
+					if (row[x].id != INVALID_CELL) {
+						p_func(PosKey(ck.x * CHUNK_SIZE + x, ck.y * CHUNK_SIZE + y), row[x]);
+					}
+				}
+			}
+		}
+
+		row_start = row_end;
+	}
+}
+
 void TileMap::set_cellv(const Vector2 &p_pos, int p_tile, bool p_flip_x, bool p_flip_y, bool p_transpose) {
 	set_cell(p_pos.x, p_pos.y, p_tile, p_flip_x, p_flip_y, p_transpose);
 }
@@ -837,47 +956,53 @@ void TileMap::_set_celld(const Vector2 &p_pos, const Dictionary &p_data) {
 void TileMap::set_cell(int p_x, int p_y, int p_tile, bool p_flip_x, bool p_flip_y, bool p_transpose, Vector2 p_autotile_coord) {
 	PosKey pk(p_x, p_y);
 
-	Map<PosKey, Cell>::Element *E = tile_map.find(pk);
-	if (!E && p_tile == INVALID_CELL) {
+	Cell *cell = _get_cell(pk);
+	if (!cell && p_tile == INVALID_CELL) {
 		return; //nothing to do
 	}
 
 	PosKey qk = pk.to_quadrant(_get_quadrant_size());
 	if (p_tile == INVALID_CELL) {
 		//erase existing
-		tile_map.erase(pk);
-		Map<PosKey, Quadrant>::Element *Q = quadrant_map.find(qk);
+		_erase_cell(pk);
+		Quadrant **Q = quadrant_map.getptr(qk);
 		ERR_FAIL_COND(!Q);
-		Quadrant &q = Q->get();
-		q.cells.erase(pk);
-		if (q.cells.size() == 0) {
-			_erase_quadrant(Q);
+		Quadrant *q = *Q;
+		q->cells.erase(pk);
+		if (q->cells.size() == 0) {
+			_erase_quadrant(q);
 		} else {
-			_make_quadrant_dirty(Q);
+			_make_quadrant_dirty(q);
 		}
 
 		used_size_cache_dirty = true;
 		return;
 	}
 
-	Map<PosKey, Quadrant>::Element *Q = quadrant_map.find(qk);
+	Quadrant **Q = quadrant_map.getptr(qk);
+	Quadrant *q = Q ? *Q : nullptr;
 
-	if (!E) {
-		E = tile_map.insert(pk, Cell());
-		if (!Q) {
-			Q = _create_quadrant(qk);
+	if (!cell) {
+		cell = &_insert_cell(pk);
+		if (!q) {
+			q = _create_quadrant(qk);
+		}
+		q->cells.insert(pk);
+
+		// Adding a cell can only grow the used rect.
+		if (!used_size_cache_dirty) {
+			Rect2 r(p_x, p_y, 1, 1);
+			used_size_cache = cell_count == 1 ? r : used_size_cache.merge(r);
 		}
-		Quadrant &q = Q->get();
-		q.cells.insert(pk);
 	} else {
-		ERR_FAIL_COND(!Q); // quadrant should exist...
+		ERR_FAIL_COND(!q); // quadrant should exist...
 
-		if (E->get().id == p_tile && E->get().flip_h == p_flip_x && E->get().flip_v == p_flip_y && E->get().transpose == p_transpose && E->get().autotile_coord_x == (uint16_t)p_autotile_coord.x && E->get().autotile_coord_y == (uint16_t)p_autotile_coord.y) {
+		if (cell->id == p_tile && cell->flip_h == p_flip_x && cell->flip_v == p_flip_y && cell->transpose == p_transpose && cell->autotile_coord_x == (uint16_t)p_autotile_coord.x && cell->autotile_coord_y == (uint16_t)p_autotile_coord.y) {
 			return; //nothing changed
 		}
 	}
 
-	Cell &c = E->get();
+	Cell &c = *cell;
 
 	c.id = p_tile;
 	c.flip_h = p_flip_x;
@@ -886,8 +1011,19 @@ void TileMap::set_cell(int p_x, int p_y, int p_tile, bool p_flip_x, bool p_flip_
 	c.autotile_coord_x = (uint16_t)p_autotile_coord.x;
 	c.autotile_coord_y = (uint16_t)p_autotile_coord.y;
 
-	_make_quadrant_dirty(Q);
-	used_size_cache_dirty = true;
+	_make_quadrant_dirty(q);
+}
+
+void TileMap::set_cells(const Vector<Vector2> &p_positions, const Vector<int> &p_tiles) {
+	ERR_FAIL_COND_MSG(p_tiles.size() != p_positions.size() && p_tiles.size() != 1, "Expected one tile per position, or a single tile for all of them.");
+
+	const Vector2 *positions = p_positions.ptr();
+	const int *tiles = p_tiles.ptr();
+	const int tile_step = p_tiles.size() == 1 ? 0 : 1;
+
+	for (int i = 0; i < p_positions.size(); i++) {
+		set_cell(positions[i].x, positions[i].y, tiles[i * tile_step]);
+	}
 }
 
 int TileMap::get_cellv(const Vector2 &p_pos) const {
@@ -932,8 +1068,8 @@ void TileMap::update_bitmask_region(const Vector2 &p_start, const Vector2 &p_end
 void TileMap::update_cell_bitmask(int p_x, int p_y) {
 	ERR_FAIL_COND_MSG(tile_set.is_null(), "Cannot update cell bitmask if Tileset is not open.");
 	PosKey p(p_x, p_y);
-	Map<PosKey, Cell>::Element *E = tile_map.find(p);
-	if (E != nullptr) {
+	Cell *cell = _get_cell(p);
+	if (cell != nullptr) {
 		int id = get_cell(p_x, p_y);
 		if (tile_set->tile_get_tile_mode(id) == TileSet::AUTO_TILE) {
 			uint16_t mask = 0;
@@ -993,22 +1129,21 @@ void TileMap::update_cell_bitmask(int p_x, int p_y) {
 				}
 			}
 			Vector2 coord = tile_set->autotile_get_subtile_for_bitmask(id, mask, this, Vector2(p_x, p_y));
-			E->get().autotile_coord_x = (int)coord.x;
-			E->get().autotile_coord_y = (int)coord.y;
+			cell->autotile_coord_x = (int)coord.x;
+			cell->autotile_coord_y = (int)coord.y;
 
 			PosKey qk = p.to_quadrant(_get_quadrant_size());
-			Map<PosKey, Quadrant>::Element *Q = quadrant_map.find(qk);
-			_make_quadrant_dirty(Q);
+			_make_quadrant_dirty(quadrant_map.get(qk));
 
 		} else if (tile_set->tile_get_tile_mode(id) == TileSet::SINGLE_TILE) {
-			E->get().autotile_coord_x = 0;
-			E->get().autotile_coord_y = 0;
+			cell->autotile_coord_x = 0;
+			cell->autotile_coord_y = 0;
 		} else if (tile_set->tile_get_tile_mode(id) == TileSet::ATLAS_TILE) {
 			if (tile_set->autotile_get_bitmask(id, Vector2(p_x, p_y)) == TileSet::BIND_CENTER) {
 				Vector2 coord = tile_set->atlastile_get_subtile_by_priority(id, this, Vector2(p_x, p_y));
 
-				E->get().autotile_coord_x = (int)coord.x;
-				E->get().autotile_coord_y = (int)coord.y;
+				cell->autotile_coord_x = (int)coord.x;
+				cell->autotile_coord_y = (int)coord.y;
 			}
 		}
 	}
@@ -1023,118 +1158,143 @@ void TileMap::update_dirty_bitmask() {
 
 void TileMap::fix_invalid_tiles() {
 	ERR_FAIL_COND_MSG(tile_set.is_null(), "Cannot fix invalid tiles if Tileset is not open.");
-	for (Map<PosKey, Cell>::Element *E = tile_map.front(); E; E = E->next()) {
-		if (!tile_set->has_tile(get_cell(E->key().x, E->key().y))) {
-			set_cell(E->key().x, E->key().y, INVALID_CELL);
+	Vector<PosKey> invalid;
+	_for_each_cell_sorted([&](const PosKey &p_pk, const Cell &p_cell) {
+		if (!tile_set->has_tile(p_cell.id)) {
+			invalid.push_back(p_pk);
 		}
+	});
+
+	for (int i = 0; i < invalid.size(); i++) {
+		set_cell(invalid[i].x, invalid[i].y, INVALID_CELL);
 	}
 }
 
 int TileMap::get_cell(int p_x, int p_y) const {
 	PosKey pk(p_x, p_y);
 
-	const Map<PosKey, Cell>::Element *E = tile_map.find(pk);
+	const Cell *c = _get_cell(pk);
 
-	if (!E) {
+	if (!c) {
 		return INVALID_CELL;
 	}
 
-	return E->get().id;
+	return c->id;
 }
 
 bool TileMap::is_cell_x_flipped(int p_x, int p_y) const {
 	PosKey pk(p_x, p_y);
 
-	const Map<PosKey, Cell>::Element *E = tile_map.find(pk);
+	const Cell *c = _get_cell(pk);
 
-	if (!E) {
+	if (!c) {
 		return false;
 	}
 
-	return E->get().flip_h;
+	return c->flip_h;
 }
 
 bool TileMap::is_cell_y_flipped(int p_x, int p_y) const {
 	PosKey pk(p_x, p_y);
 
-	const Map<PosKey, Cell>::Element *E = tile_map.find(pk);
+	const Cell *c = _get_cell(pk);
 
-	if (!E) {
+	if (!c) {
 		return false;
 	}
 
-	return E->get().flip_v;
+	return c->flip_v;
 }
 
 bool TileMap::is_cell_transposed(int p_x, int p_y) const {
 	PosKey pk(p_x, p_y);
 
-	const Map<PosKey, Cell>::Element *E = tile_map.find(pk);
+	const Cell *c = _get_cell(pk);
 
-	if (!E) {
+	if (!c) {
 		return false;
 	}
 
-	return E->get().transpose;
+	return c->transpose;
 }
 
 void TileMap::set_cell_autotile_coord(int p_x, int p_y, const Vector2 &p_coord) {
 	PosKey pk(p_x, p_y);
 
-	const Map<PosKey, Cell>::Element *E = tile_map.find(pk);
+	Cell *c = _get_cell(pk);
 
-	if (!E) {
+	if (!c) {
 		return;
 	}
 
-	Cell c = E->get();
-	c.autotile_coord_x = p_coord.x;
-	c.autotile_coord_y = p_coord.y;
-	tile_map[pk] = c;
+	c->autotile_coord_x = p_coord.x;
+	c->autotile_coord_y = p_coord.y;
 
 	PosKey qk = pk.to_quadrant(_get_quadrant_size());
-	Map<PosKey, Quadrant>::Element *Q = quadrant_map.find(qk);
+	Quadrant **Q = quadrant_map.getptr(qk);
 
 	if (!Q) {
 		return;
 	}
 
-	_make_quadrant_dirty(Q);
+	_make_quadrant_dirty(*Q);
 }
 
 Vector2 TileMap::get_cell_autotile_coord(int p_x, int p_y) const {
 	PosKey pk(p_x, p_y);
 
-	const Map<PosKey, Cell>::Element *E = tile_map.find(pk);
+	const Cell *c = _get_cell(pk);
 
-	if (!E) {
+	if (!c) {
 		return Vector2();
 	}
 
-	return Vector2(E->get().autotile_coord_x, E->get().autotile_coord_y);
+	return Vector2(c->autotile_coord_x, c->autotile_coord_y);
 }
 
 void TileMap::_recreate_quadrants() {
 	_clear_quadrants();
 
-	for (Map<PosKey, Cell>::Element *E = tile_map.front(); E; E = E->next()) {
-		PosKey qk = PosKey(E->key().x, E->key().y).to_quadrant(_get_quadrant_size());
+	const int quadrant_size = _get_quadrant_size();
+	Quadrant *q = nullptr;
+	for (int i = cell_chunks.next_cursor(-1); i != -1; i = cell_chunks.next_cursor(i)) {
+		const PosKey &ck = cell_chunks.get_key_at_cursor(i);
+		const CellChunk *chunk = cell_chunks.get_value_at_cursor(i);
 
-		Map<PosKey, Quadrant>::Element *Q = quadrant_map.find(qk);
-		if (!Q) {
-			Q = _create_quadrant(qk);
-			dirty_quadrant_list.add(&Q->get().dirty_list);
-		}
+		for (int j = 0; j < CHUNK_SIZE * CHUNK_SIZE; j++) {
+			if (chunk->cells[j].id == INVALID_CELL) {
+				continue;
+			}
 
-		Q->get().cells.insert(E->key());
-		_make_quadrant_dirty(Q, false);
+			PosKey pk(ck.x * CHUNK_SIZE + (j & CHUNK_MASK), ck.y * CHUNK_SIZE + (j >> CHUNK_SHIFT));
+			PosKey qk = pk.to_quadrant(quadrant_size);
+
+			// Neighbouring cells mostly share a quadrant.
+			if (!q || !(q->key == qk)) {
+				Quadrant **Q = quadrant_map.getptr(qk);
+				if (Q) {
+					q = *Q;
+				} else {
+					q = _create_quadrant(qk);
+					dirty_quadrant_list.add(&q->dirty_list);
+				}
+			}
+
+			q->cells.insert(pk);
+			_make_quadrant_dirty(q, false);
+		}
 	}
 	update_dirty_quadrants();
 }
 
 void TileMap::_clear_quadrants() {
-	while (quadrant_map.size()) {
-		_erase_quadrant(quadrant_map.front());
+	Vector<Quadrant *> quadrants;
+	for (int i = quadrant_map.next_cursor(-1); i != -1; i = quadrant_map.next_cursor(i)) {
+		quadrants.push_back(quadrant_map.get_value_at_cursor(i));
+	}
+
+	for (int i = 0; i < quadrants.size(); i++) {
+		_erase_quadrant(quadrants[i]);
 	}
 }
 
@@ -1149,8 +1309,8 @@ void TileMap::set_use_parent_material(bool p_use_parent_material) {
 }
 
 void TileMap::_update_all_items_material_state() {
-	for (Map<PosKey, Quadrant>::Element *E = quadrant_map.front(); E; E = E->next()) {
-		Quadrant &q = E->get();
+	for (int i = quadrant_map.next_cursor(-1); i != -1; i = quadrant_map.next_cursor(i)) {
+		Quadrant &q = *quadrant_map.get_value_at_cursor(i);
 		for (List<RID>::Element *F = q.canvas_items.front(); F; F = F->next()) {
 			_update_item_material_state(F->get());
 		}
@@ -1163,7 +1323,7 @@ void TileMap::_update_item_material_state(const RID &p_canvas_item) {
 
 void TileMap::clear() {
 	_clear_quadrants();
-	tile_map.clear();
+	_clear_cells();
 	used_size_cache_dirty = true;
 }
 
@@ -1196,8 +1356,8 @@ void TileMap::_set_tile_data(const Vector<int> &p_data) {
 		}
 #endif
 
-		uint16_t x = decode_uint16(&local[0]);
-		uint16_t y = decode_uint16(&local[2]);
+		int16_t x = decode_uint16(&local[0]);
+		int16_t y = decode_uint16(&local[2]);
 		uint32_t v = decode_uint32(&local[4]);
 		bool flip_h = v & (1 << 29);
 		bool flip_v = v & (1 << 30);
@@ -1216,31 +1376,31 @@ void TileMap::_set_tile_data(const Vector<int> &p_data) {
 
 Vector<int> TileMap::_get_tile_data() const {
 	Vector<int> data;
-	data.resize(tile_map.size() * 3);
+	data.resize(cell_count * 3);
 	int *w = data.ptrw();
 
 	// Save in highest format
 
 	int idx = 0;
-	for (const Map<PosKey, Cell>::Element *E = tile_map.front(); E; E = E->next()) {
+	_for_each_cell_sorted([&](const PosKey &p_pk, const Cell &p_cell) {
 		uint8_t *ptr = (uint8_t *)&w[idx];
-		encode_uint16(E->key().x, &ptr[0]);
-		encode_uint16(E->key().y, &ptr[2]);
-		uint32_t val = E->get().id;
-		if (E->get().flip_h) {
+		encode_uint16(p_pk.x, &ptr[0]);
+		encode_uint16(p_pk.y, &ptr[2]);
+		uint32_t val = p_cell.id;
+		if (p_cell.flip_h) {
 			val |= (1 << 29);
 		}
-		if (E->get().flip_v) {
+		if (p_cell.flip_v) {
 			val |= (1 << 30);
 		}
-		if (E->get().transpose) {
+		if (p_cell.transpose) {
 			val |= (1 << 31);
 		}
 		encode_uint32(val, &ptr[4]);
-		encode_uint16(E->get().autotile_coord_x, &ptr[8]);
-		encode_uint16(E->get().autotile_coord_y, &ptr[10]);
+		encode_uint16(p_cell.autotile_coord_x, &ptr[8]);
+		encode_uint16(p_cell.autotile_coord_y, &ptr[10]);
 		idx += 3;
-	}
+	});
 
 	return data;
 }
@@ -1259,8 +1419,8 @@ Rect2 TileMap::_edit_get_rect() const {
 void TileMap::set_collision_layer(uint32_t p_layer) {
 	collision_layer = p_layer;
 	if (!use_parent) {
-		for (Map<PosKey, Quadrant>::Element *E = quadrant_map.front(); E; E = E->next()) {
-			Quadrant &q = E->get();
+		for (int i = quadrant_map.next_cursor(-1); i != -1; i = quadrant_map.next_cursor(i)) {
+			Quadrant &q = *quadrant_map.get_value_at_cursor(i);
 			PhysicsServer2D::get_singleton()->body_set_collision_layer(q.body, collision_layer);
 		}
 	}
@@ -1269,8 +1429,8 @@ void TileMap::set_collision_layer(uint32_t p_layer) {
 void TileMap::set_collision_mask(uint32_t p_mask) {
 	collision_mask = p_mask;
 	if (!use_parent) {
-		for (Map<PosKey, Quadrant>::Element *E = quadrant_map.front(); E; E = E->next()) {
-			Quadrant &q = E->get();
+		for (int i = quadrant_map.next_cursor(-1); i != -1; i = quadrant_map.next_cursor(i)) {
+			Quadrant &q = *quadrant_map.get_value_at_cursor(i);
 			PhysicsServer2D::get_singleton()->body_set_collision_mask(q.body, collision_mask);
 		}
 	}
@@ -1334,8 +1494,8 @@ void TileMap::set_collision_use_parent(bool p_use_parent) {
 void TileMap::set_collision_friction(float p_friction) {
 	friction = p_friction;
 	if (!use_parent) {
-		for (Map<PosKey, Quadrant>::Element *E = quadrant_map.front(); E; E = E->next()) {
-			Quadrant &q = E->get();
+		for (int i = quadrant_map.next_cursor(-1); i != -1; i = quadrant_map.next_cursor(i)) {
+			Quadrant &q = *quadrant_map.get_value_at_cursor(i);
 			PhysicsServer2D::get_singleton()->body_set_param(q.body, PhysicsServer2D::BODY_PARAM_FRICTION, p_friction);
 		}
 	}
@@ -1348,8 +1508,8 @@ float TileMap::get_collision_friction() const {
 void TileMap::set_collision_bounce(float p_bounce) {
 	bounce = p_bounce;
 	if (!use_parent) {
-		for (Map<PosKey, Quadrant>::Element *E = quadrant_map.front(); E; E = E->next()) {
-			Quadrant &q = E->get();
+		for (int i = quadrant_map.next_cursor(-1); i != -1; i = quadrant_map.next_cursor(i)) {
+			Quadrant &q = *quadrant_map.get_value_at_cursor(i);
 			PhysicsServer2D::get_singleton()->body_set_param(q.body, PhysicsServer2D::BODY_PARAM_BOUNCE, p_bounce);
 		}
 	}
@@ -1608,24 +1768,22 @@ bool TileMap::is_centered_textures_enabled() const {
 
 TypedArray<Vector2i> TileMap::get_used_cells() const {
 	TypedArray<Vector2i> a;
-	a.resize(tile_map.size());
+	a.resize(cell_count);
 	int i = 0;
-	for (Map<PosKey, Cell>::Element *E = tile_map.front(); E; E = E->next()) {
-		Vector2i p(E->key().x, E->key().y);
-		a[i++] = p;
-	}
+	_for_each_cell_sorted([&](const PosKey &p_pk, const Cell &p_cell) {
+		a[i++] = Vector2i(p_pk.x, p_pk.y);
+	});
 
 	return a;
 }
 
 TypedArray<Vector2i> TileMap::get_used_cells_by_index(int p_id) const {
 	TypedArray<Vector2i> a;
-	for (Map<PosKey, Cell>::Element *E = tile_map.front(); E; E = E->next()) {
-		if (E->value().id == p_id) {
-			Vector2i p(E->key().x, E->key().y);
-			a.push_back(p);
+	_for_each_cell_sorted([&](const PosKey &p_pk, const Cell &p_cell) {
+		if (p_cell.id == p_id) {
+			a.push_back(Vector2i(p_pk.x, p_pk.y));
 		}
-	}
+	});
 
 	return a;
 }
@@ -1633,16 +1791,31 @@ TypedArray<Vector2i> TileMap::get_used_cells_by_index(int p_id) const {
 Rect2 TileMap::get_used_rect() { // Not const because of cache
 
 	if (used_size_cache_dirty) {
-		if (tile_map.size() > 0) {
-			used_size_cache = Rect2(tile_map.front()->key().x, tile_map.front()->key().y, 0, 0);
-
-			for (Map<PosKey, Cell>::Element *E = tile_map.front(); E; E = E->next()) {
-				used_size_cache.expand_to(Vector2(E->key().x, E->key().y));
+		used_size_cache = Rect2();
+		bool first = true;
+
+		for (int i = cell_chunks.next_cursor(-1); i != -1; i = cell_chunks.next_cursor(i)) {
+			const PosKey &ck = cell_chunks.get_key_at_cursor(i);
+			const CellChunk *chunk = cell_chunks.get_value_at_cursor(i);
+
+			// Bounds of the chunk's cells, then merged into the total.
+			int min_x = CHUNK_SIZE, min_y = CHUNK_SIZE, max_x = -1, max_y = -1;
+			for (int j = 0; j < CHUNK_SIZE * CHUNK_SIZE; j++) {
+				if (chunk->cells[j].id != INVALID_CELL) {
+					min_x = MIN(min_x, j & CHUNK_MASK);
+					max_x = MAX(max_x, j & CHUNK_MASK);
+					min_y = MIN(min_y, j >> CHUNK_SHIFT);
+					max_y = MAX(max_y, j >> CHUNK_SHIFT);
+				}
 			}
 
-			used_size_cache.size += Vector2(1, 1);
-		} else {
-			used_size_cache = Rect2();
+			Rect2 r(ck.x * CHUNK_SIZE + min_x, ck.y * CHUNK_SIZE + min_y, max_x - min_x + 1, max_y - min_y + 1);
+			if (first) {
+				used_size_cache = r;
+				first = false;
+			} else {
+				used_size_cache = used_size_cache.merge(r);
+			}
 		}
 
 		used_size_cache_dirty = false;
@@ -1653,9 +1826,10 @@ Rect2 TileMap::get_used_rect() { // Not const because of cache
 
 void TileMap::set_occluder_light_mask(int p_mask) {
 	occluder_light_mask = p_mask;
-	for (Map<PosKey, Quadrant>::Element *E = quadrant_map.front(); E; E = E->next()) {
-		for (Map<PosKey, Quadrant::Occluder>::Element *F = E->get().occluder_instances.front(); F; F = F->next()) {
-			RenderingServer::get_singleton()->canvas_light_occluder_set_light_mask(F->get().id, occluder_light_mask);
+	for (int i = quadrant_map.next_cursor(-1); i != -1; i = quadrant_map.next_cursor(i)) {
+		Quadrant &q = *quadrant_map.get_value_at_cursor(i);
+		for (int f = q.occluder_instances.next_cursor(-1); f != -1; f = q.occluder_instances.next_cursor(f)) {
+			RenderingServer::get_singleton()->canvas_light_occluder_set_light_mask(q.occluder_instances.get_value_at_cursor(f).id, occluder_light_mask);
 		}
 	}
 }
@@ -1666,8 +1840,8 @@ int TileMap::get_occluder_light_mask() const {
 
 void TileMap::set_light_mask(int p_light_mask) {
 	CanvasItem::set_light_mask(p_light_mask);
-	for (Map<PosKey, Quadrant>::Element *E = quadrant_map.front(); E; E = E->next()) {
-		for (List<RID>::Element *F = E->get().canvas_items.front(); F; F = F->next()) {
+	for (int i = quadrant_map.next_cursor(-1); i != -1; i = quadrant_map.next_cursor(i)) {
+		for (List<RID>::Element *F = quadrant_map.get_value_at_cursor(i)->canvas_items.front(); F; F = F->next()) {
 			RenderingServer::get_singleton()->canvas_item_set_light_mask(F->get(), get_light_mask());
 		}
 	}
@@ -1767,6 +1941,7 @@ void TileMap::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_cell", "x", "y", "tile", "flip_x", "flip_y", "transpose", "autotile_coord"), &TileMap::set_cell, DEFVAL(false), DEFVAL(false), DEFVAL(false), DEFVAL(Vector2()));
 	ClassDB::bind_method(D_METHOD("set_cellv", "position", "tile", "flip_x", "flip_y", "transpose"), &TileMap::set_cellv, DEFVAL(false), DEFVAL(false), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("_set_celld", "position", "data"), &TileMap::_set_celld);
+	ClassDB::bind_method(D_METHOD("set_cells", "positions", "tiles"), &TileMap::set_cells);
 	ClassDB::bind_method(D_METHOD("get_cell", "x", "y"), &TileMap::get_cell);
 	ClassDB::bind_method(D_METHOD("get_cellv", "position"), &TileMap::get_cellv);
 	ClassDB::bind_method(D_METHOD("is_cell_x_flipped", "x", "y"), &TileMap::is_cell_x_flipped);
@@ -1849,6 +2024,7 @@ void TileMap::_changed_callback(Object *p_changed, const char *p_prop) {
 TileMap::TileMap() {
 	rect_cache_dirty = true;
 	used_size_cache_dirty = true;
+	cell_count = 0;
 	pending_update = false;
 	quadrant_order_dirty = false;
 	quadrant_size = 16;
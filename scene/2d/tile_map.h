@@ -31,6 +31,7 @@
 #ifndef TILE_MAP_H
 #define TILE_MAP_H
 
+#include "core/dense_hash_map.h"
 #include "core/self_list.h"
 #include "core/vset.h"
 #include "scene/2d/navigation_2d.h"
@@ -109,6 +110,10 @@ private:
 		}
 	};
 
+	struct PosKeyHasher {
+		static _FORCE_INLINE_ uint32_t hash(const PosKey &p_key) { return hash_one_uint64(p_key.key); }
+	};
+
 	union Cell {
 		struct {
 			int32_t id : 24;
@@ -123,10 +128,31 @@ private:
 		Cell() { _u64t = 0; }
 	};
 
-	Map<PosKey, Cell> tile_map;
+	enum {
+		CHUNK_SHIFT = 5,
+		CHUNK_SIZE = 1 << CHUNK_SHIFT,
+		CHUNK_MASK = CHUNK_SIZE - 1
+	};
+
+	// Cells are stored in dense CHUNK_SIZE x CHUNK_SIZE blocks, unused cells
+	// have an INVALID_CELL id. Chunks are freed once their last cell is erased.
+	struct CellChunk {
+		Cell cells[CHUNK_SIZE * CHUNK_SIZE];
+		uint32_t used = 0;
+
+		CellChunk() {
+			for (int i = 0; i < CHUNK_SIZE * CHUNK_SIZE; i++) {
+				cells[i].id = INVALID_CELL;
+			}
+		}
+	};
+
+	DenseHashMap<PosKey, CellChunk *, PosKeyHasher> cell_chunks;
+	uint32_t cell_count;
 	List<PosKey> dirty_bitmask;
 
 	struct Quadrant {
+		PosKey key;
 		Vector2 pos;
 		List<RID> canvas_items;
 		RID body;
@@ -144,35 +170,16 @@ private:
 			Transform2D xform;
 		};
 
-		Map<PosKey, NavPoly> navpoly_ids;
-		Map<PosKey, Occluder> occluder_instances;
+		DenseHashMap<PosKey, NavPoly, PosKeyHasher> navpoly_ids;
+		DenseHashMap<PosKey, Occluder, PosKeyHasher> occluder_instances;
 
 		VSet<PosKey> cells;
 
-		void operator=(const Quadrant &q) {
-			pos = q.pos;
-			canvas_items = q.canvas_items;
-			body = q.body;
-			shape_owner_id = q.shape_owner_id;
-			cells = q.cells;
-			navpoly_ids = q.navpoly_ids;
-			occluder_instances = q.occluder_instances;
-		}
-		Quadrant(const Quadrant &q) :
-				dirty_list(this) {
-			pos = q.pos;
-			canvas_items = q.canvas_items;
-			body = q.body;
-			shape_owner_id = q.shape_owner_id;
-			cells = q.cells;
-			occluder_instances = q.occluder_instances;
-			navpoly_ids = q.navpoly_ids;
-		}
 		Quadrant() :
 				dirty_list(this) {}
 	};
 
-	Map<PosKey, Quadrant> quadrant_map;
+	DenseHashMap<PosKey, Quadrant *, PosKeyHasher> quadrant_map;
 
 	SelfList<Quadrant>::List dirty_quadrant_list;
 
@@ -202,9 +209,19 @@ private:
 
 	void _add_shape(int &shape_idx, const Quadrant &p_q, const Ref<Shape2D> &p_shape, const TileSet::ShapeData &p_shape_data, const Transform2D &p_xform, const Vector2 &p_metadata);
 
-	Map<PosKey, Quadrant>::Element *_create_quadrant(const PosKey &p_qk);
-	void _erase_quadrant(Map<PosKey, Quadrant>::Element *Q);
-	void _make_quadrant_dirty(Map<PosKey, Quadrant>::Element *Q, bool update = true);
+	_FORCE_INLINE_ static PosKey _get_chunk_key(const PosKey &p_pk) { return PosKey(p_pk.x >> CHUNK_SHIFT, p_pk.y >> CHUNK_SHIFT); }
+	_FORCE_INLINE_ static int _get_chunk_index(const PosKey &p_pk) { return ((p_pk.y & CHUNK_MASK) << CHUNK_SHIFT) | (p_pk.x & CHUNK_MASK); }
+	const Cell *_get_cell(const PosKey &p_pk) const;
+	_FORCE_INLINE_ Cell *_get_cell(const PosKey &p_pk) { return const_cast<Cell *>(static_cast<const TileMap *>(this)->_get_cell(p_pk)); }
+	Cell &_insert_cell(const PosKey &p_pk);
+	void _erase_cell(const PosKey &p_pk);
+	void _clear_cells();
+	template <class F>
+	void _for_each_cell_sorted(F p_func) const;
+
+	Quadrant *_create_quadrant(const PosKey &p_qk);
+	void _erase_quadrant(Quadrant *p_q);
+	void _make_quadrant_dirty(Quadrant *p_q, bool update = true);
 	void _recreate_quadrants();
 	void _clear_quadrants();
 	void _update_quadrant_space(const RID &p_space);
@@ -254,6 +271,7 @@ public:
 	int get_quadrant_size() const;
 
 	void set_cell(int p_x, int p_y, int p_tile, bool p_flip_x = false, bool p_flip_y = false, bool p_transpose = false, Vector2 p_autotile_coord = Vector2());
+	void set_cells(const Vector<Vector2> &p_positions, const Vector<int> &p_tiles);
 	int get_cell(int p_x, int p_y) const;
 	bool is_cell_x_flipped(int p_x, int p_y) const;
 	bool is_cell_y_flipped(int p_x, int p_y) const;
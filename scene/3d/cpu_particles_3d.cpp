@@ -30,8 +30,10 @@
 
 #include "cpu_particles_3d.h"
 
+#include "core/os/thread.h"
 #include "scene/3d/camera_3d.h"
 #include "scene/3d/gpu_particles_3d.h"
+#include "scene/main/scene_tree.h"
 #include "scene/resources/particles_material.h"
 #include "servers/rendering_server.h"
 
@@ -511,6 +513,8 @@ void CPUParticles3D::_update_internal() {
 	}
 	_set_redraw(true);
 
+	ThreadWorkPool *pool = _get_process_thread_pool();
+
 	bool processed = false;
 
 	if (time == 0 && pre_process_time > 0.0) {
@@ -524,7 +528,7 @@ void CPUParticles3D::_update_internal() {
 		float todo = pre_process_time;
 
 		while (todo >= 0) {
-			_particles_process(frame_time);
+			_particles_process(frame_time, pool);
 			processed = true;
 			todo -= frame_time;
 		}
@@ -543,7 +547,7 @@ void CPUParticles3D::_update_internal() {
 		float todo = frame_remainder + ldelta;
 
 		while (todo >= frame_time) {
-			_particles_process(frame_time);
+			_particles_process(frame_time, pool);
 			processed = true;
 			todo -= decr;
 		}
@@ -551,24 +555,33 @@ void CPUParticles3D::_update_internal() {
 		frame_remainder = todo;
 
 	} else {
-		_particles_process(delta);
+		_particles_process(delta, pool);
 		processed = true;
 	}
 
 	if (processed) {
-		_update_particle_data_buffer();
+		_update_particle_data_buffer(pool);
 	}
 }
 
-void CPUParticles3D::_particles_process(float p_delta) {
+ThreadWorkPool *CPUParticles3D::_get_process_thread_pool() const {
+	// Emitters processed from a process thread group are already running on the pool.
+	if (!is_inside_tree() || Thread::get_caller_id() != Thread::get_main_id()) {
+		return nullptr;
+	}
+	return &get_tree()->get_process_thread_pool();
+}
+
+void CPUParticles3D::_particles_process(float p_delta, ThreadWorkPool *p_pool) {
 	p_delta *= speed_scale;
 
 	int pcount = particles.size();
-	Particle *w = particles.ptrw();
 
-	Particle *parray = w;
+	ProcessStep step;
+	step.particles = particles.ptrw();
+	step.delta = p_delta;
+	step.prev_time = time;
 
-	float prev_time = time;
 	time += p_delta;
 	if (time > lifetime) {
 		time = Math::fmod(time, lifetime);
@@ -579,23 +592,45 @@ void CPUParticles3D::_particles_process(float p_delta) {
 		}
 	}
 
-	Transform emission_xform;
-	Basis velocity_xform;
 	if (!local_coords) {
-		emission_xform = get_global_transform();
-		velocity_xform = emission_xform.basis;
+		step.emission_xform = get_global_transform();
+		step.velocity_xform = step.emission_xform.basis;
 	}
 
-	float system_phase = time / lifetime;
+	step.system_phase = time / lifetime;
+	// Blocks can run in any order, so each particle draws from its own sequence.
+	step.random_seed = Math::rand();
+
+	if (color_ramp.is_valid()) {
+		// Make sure the gradient points are sorted before reading them from several threads.
+		color_ramp->get_color_at_offset(0.0);
+	}
 
-	for (int i = 0; i < pcount; i++) {
+	uint32_t block_count = (pcount + PROCESS_BLOCK_SIZE - 1) / PROCESS_BLOCK_SIZE;
+	if (p_pool && block_count > 1) {
+		p_pool->do_work(block_count, this, &CPUParticles3D::_particles_process_block, (const ProcessStep *)&step);
+	} else {
+		for (uint32_t i = 0; i < block_count; i++) {
+			_particles_process_block(i, &step);
+		}
+	}
+}
+
+void CPUParticles3D::_particles_process_block(uint32_t p_block, const ProcessStep *p_step) {
+	int pcount = particles.size();
+	int from = p_block * PROCESS_BLOCK_SIZE;
+	int to = MIN(from + PROCESS_BLOCK_SIZE, pcount);
+
+	Particle *parray = p_step->particles;
+
+	for (int i = from; i < to; i++) {
 		Particle &p = parray[i];
 
 		if (!emitting && !p.active) {
 			continue;
 		}
 
-		float local_delta = p_delta;
+		float local_delta = p_step->delta;
 
 		// The phase is a ratio between 0 (birth) and 1 (end of life) for each particle.
 		// While we use time in tests later on, for randomness we use the phase as done in the
@@ -604,7 +639,7 @@ void CPUParticles3D::_particles_process(float p_delta) {
 
 		if (randomness_ratio > 0.0) {
 			uint32_t seed = cycle;
-			if (restart_phase >= system_phase) {
+			if (restart_phase >= p_step->system_phase) {
 				seed -= uint32_t(1);
 			}
 			seed *= uint32_t(pcount);
@@ -617,10 +652,10 @@ void CPUParticles3D::_particles_process(float p_delta) {
 		float restart_time = restart_phase * lifetime;
 		bool restart = false;
 
-		if (time > prev_time) {
+		if (time > p_step->prev_time) {
 			// restart_time >= prev_time is used so particles emit in the first frame they are processed
 
-			if (restart_time >= prev_time && restart_time < time) {
+			if (restart_time >= p_step->prev_time && restart_time < time) {
 				restart = true;
 				if (fractional_delta) {
 					local_delta = time - restart_time;
@@ -628,7 +663,7 @@ void CPUParticles3D::_particles_process(float p_delta) {
 			}
 
 		} else if (local_delta > 0.0) {
-			if (restart_time >= prev_time) {
+			if (restart_time >= p_step->prev_time) {
 				restart = true;
 				if (fractional_delta) {
 					local_delta = lifetime - restart_time + time;
@@ -668,28 +703,29 @@ void CPUParticles3D::_particles_process(float p_delta) {
 				tex_anim_offset = curve_parameters[PARAM_ANGLE]->interpolate(0);
 			}
 
-			p.seed = Math::rand();
+			uint32_t rand_seed = idhash(p_step->random_seed + uint32_t(i));
+			p.seed = idhash(rand_seed);
 
-			p.angle_rand = Math::randf();
-			p.scale_rand = Math::randf();
-			p.hue_rot_rand = Math::randf();
-			p.anim_offset_rand = Math::randf();
+			p.angle_rand = rand_from_seed(rand_seed);
+			p.scale_rand = rand_from_seed(rand_seed);
+			p.hue_rot_rand = rand_from_seed(rand_seed);
+			p.anim_offset_rand = rand_from_seed(rand_seed);
 
 			if (flags[FLAG_DISABLE_Z]) {
-				float angle1_rad = Math::atan2(direction.y, direction.x) + (Math::randf() * 2.0 - 1.0) * Math_PI * spread / 180.0;
+				float angle1_rad = Math::atan2(direction.y, direction.x) + (rand_from_seed(rand_seed) * 2.0 - 1.0) * Math_PI * spread / 180.0;
 				Vector3 rot = Vector3(Math::cos(angle1_rad), Math::sin(angle1_rad), 0.0);
-				p.velocity = rot * parameters[PARAM_INITIAL_LINEAR_VELOCITY] * Math::lerp(1.0f, float(Math::randf()), randomness[PARAM_INITIAL_LINEAR_VELOCITY]);
+				p.velocity = rot * parameters[PARAM_INITIAL_LINEAR_VELOCITY] * Math::lerp(1.0f, rand_from_seed(rand_seed), randomness[PARAM_INITIAL_LINEAR_VELOCITY]);
 			} else {
 				//initiate velocity spread in 3D
-				float angle1_rad = Math::atan2(direction.x, direction.z) + (Math::randf() * 2.0 - 1.0) * Math_PI * spread / 180.0;
-				float angle2_rad = Math::atan2(direction.y, Math::abs(direction.z)) + (Math::randf() * 2.0 - 1.0) * (1.0 - flatness) * Math_PI * spread / 180.0;
+				float angle1_rad = Math::atan2(direction.x, direction.z) + (rand_from_seed(rand_seed) * 2.0 - 1.0) * Math_PI * spread / 180.0;
+				float angle2_rad = Math::atan2(direction.y, Math::abs(direction.z)) + (rand_from_seed(rand_seed) * 2.0 - 1.0) * (1.0 - flatness) * Math_PI * spread / 180.0;
 
 				Vector3 direction_xz = Vector3(Math::sin(angle1_rad), 0, Math::cos(angle1_rad));
 				Vector3 direction_yz = Vector3(0, Math::sin(angle2_rad), Math::cos(angle2_rad));
 				direction_yz.z = direction_yz.z / MAX(0.0001, Math::sqrt(ABS(direction_yz.z))); //better uniform distribution
 				Vector3 direction = Vector3(direction_xz.x * direction_yz.z, direction_yz.y, direction_xz.z * direction_yz.z);
 				direction.normalize();
-				p.velocity = direction * parameters[PARAM_INITIAL_LINEAR_VELOCITY] * Math::lerp(1.0f, float(Math::randf()), randomness[PARAM_INITIAL_LINEAR_VELOCITY]);
+				p.velocity = direction * parameters[PARAM_INITIAL_LINEAR_VELOCITY] * Math::lerp(1.0f, rand_from_seed(rand_seed), randomness[PARAM_INITIAL_LINEAR_VELOCITY]);
 			}
 
 			float base_angle = (parameters[PARAM_ANGLE] + tex_angle) * Math::lerp(1.0f, p.angle_rand, randomness[PARAM_ANGLE]);
@@ -698,7 +734,7 @@ void CPUParticles3D::_particles_process(float p_delta) {
 			p.custom[2] = (parameters[PARAM_ANIM_OFFSET] + tex_anim_offset) * Math::lerp(1.0f, p.anim_offset_rand, randomness[PARAM_ANIM_OFFSET]); //animation offset (0-1)
 			p.transform = Transform();
 			p.time = 0;
-			p.lifetime = lifetime * (1.0 - Math::randf() * lifetime_randomness);
+			p.lifetime = lifetime * (1.0 - rand_from_seed(rand_seed) * lifetime_randomness);
 			p.base_color = Color(1, 1, 1, 1);
 
 			switch (emission_shape) {
@@ -706,12 +742,12 @@ void CPUParticles3D::_particles_process(float p_delta) {
 					//do none
 				} break;
 				case EMISSION_SHAPE_SPHERE: {
-					float s = 2.0 * Math::randf() - 1.0, t = 2.0 * Math_PI * Math::randf();
+					float s = 2.0 * rand_from_seed(rand_seed) - 1.0, t = 2.0 * Math_PI * rand_from_seed(rand_seed);
 					float radius = emission_sphere_radius * Math::sqrt(1.0 - s * s);
 					p.transform.origin = Vector3(radius * Math::cos(t), radius * Math::sin(t), emission_sphere_radius * s);
 				} break;
 				case EMISSION_SHAPE_BOX: {
-					p.transform.origin = Vector3(Math::randf() * 2.0 - 1.0, Math::randf() * 2.0 - 1.0, Math::randf() * 2.0 - 1.0) * emission_box_extents;
+					p.transform.origin = Vector3(rand_from_seed(rand_seed) * 2.0 - 1.0, rand_from_seed(rand_seed) * 2.0 - 1.0, rand_from_seed(rand_seed) * 2.0 - 1.0) * emission_box_extents;
 				} break;
 				case EMISSION_SHAPE_POINTS:
 				case EMISSION_SHAPE_DIRECTED_POINTS: {
@@ -720,7 +756,7 @@ void CPUParticles3D::_particles_process(float p_delta) {
 						break;
 					}
 
-					int random_idx = Math::rand() % pc;
+					int random_idx = idhash(rand_seed) % uint32_t(pc);
 
 					p.transform.origin = emission_points.get(random_idx);
 
@@ -756,8 +792,8 @@ void CPUParticles3D::_particles_process(float p_delta) {
 			}
 
 			if (!local_coords) {
-				p.velocity = velocity_xform.xform(p.velocity);
-				p.transform = emission_xform * p.transform;
+				p.velocity = p_step->velocity_xform.xform(p.velocity);
+				p.transform = p_step->emission_xform * p.transform;
 			}
 
 			if (flags[FLAG_DISABLE_Z]) {
@@ -834,7 +870,7 @@ void CPUParticles3D::_particles_process(float p_delta) {
 			//apply linear acceleration
 			force += p.velocity.length() > 0.0 ? p.velocity.normalized() * (parameters[PARAM_LINEAR_ACCEL] + tex_linear_accel) * Math::lerp(1.0f, rand_from_seed(alt_seed), randomness[PARAM_LINEAR_ACCEL]) : Vector3();
 			//apply radial acceleration
-			Vector3 org = emission_xform.origin;
+			Vector3 org = p_step->emission_xform.origin;
 			Vector3 diff = position - org;
 			force += diff.length() > 0.0 ? diff.normalized() * (parameters[PARAM_RADIAL_ACCEL] + tex_radial_accel) * Math::lerp(1.0f, rand_from_seed(alt_seed), randomness[PARAM_RADIAL_ACCEL]) : Vector3();
 			//apply tangential acceleration;
@@ -980,29 +1016,32 @@ void CPUParticles3D::_particles_process(float p_delta) {
 	}
 }
 
-void CPUParticles3D::_update_particle_data_buffer() {
+void CPUParticles3D::_update_particle_data_buffer(ThreadWorkPool *p_pool) {
 	MutexLock lock(update_mutex);
 
 	int pc = particles.size();
 
-	int *ow;
-	int *order = nullptr;
-
-	float *w = particle_data.ptrw();
-	const Particle *r = particles.ptr();
-	float *ptr = w;
+	BufferFill fill;
+	fill.particles = particles.ptr();
+	fill.data = particle_data.ptrw();
 
 	if (draw_order != DRAW_ORDER_INDEX) {
-		ow = particle_order.ptrw();
-		order = ow;
+		int *order = particle_order.ptrw();
 
 		for (int i = 0; i < pc; i++) {
 			order[i] = i;
 		}
+
+		// Sort on keys gathered up front instead of reading the particles in every comparison.
+		particle_sort_keys.resize(pc);
+		float *keys = particle_sort_keys.ptr();
+		bool sort = false;
+
 		if (draw_order == DRAW_ORDER_LIFETIME) {
-			SortArray<int, SortLifetime> sorter;
-			sorter.compare.particles = r;
-			sorter.sort(order, pc);
+			for (int i = 0; i < pc; i++) {
+				keys[i] = -fill.particles[i].time;
+			}
+			sort = true;
 		} else if (draw_order == DRAW_ORDER_VIEW_DEPTH) {
 			Camera3D *c = get_viewport()->get_camera();
 			if (c) {
@@ -1016,16 +1055,44 @@ void CPUParticles3D::_update_particle_data_buffer() {
 					dir = dir.normalized();
 				}
 
-				SortArray<int, SortAxis> sorter;
-				sorter.compare.particles = r;
-				sorter.compare.axis = dir;
-				sorter.sort(order, pc);
+				for (int i = 0; i < pc; i++) {
+					keys[i] = dir.dot(fill.particles[i].transform.origin);
+				}
+				sort = true;
 			}
 		}
+
+		if (sort) {
+			SortArray<int, SortKey> sorter;
+			sorter.compare.keys = keys;
+			sorter.sort(order, pc);
+		}
+
+		fill.order = order;
+	}
+
+	uint32_t block_count = (pc + PROCESS_BLOCK_SIZE - 1) / PROCESS_BLOCK_SIZE;
+	if (p_pool && block_count > 1) {
+		p_pool->do_work(block_count, this, &CPUParticles3D::_update_particle_data_block, (const BufferFill *)&fill);
+	} else {
+		for (uint32_t i = 0; i < block_count; i++) {
+			_update_particle_data_block(i, &fill);
+		}
 	}
 
-	for (int i = 0; i < pc; i++) {
-		int idx = order ? order[i] : i;
+	can_update = true;
+}
+
+void CPUParticles3D::_update_particle_data_block(uint32_t p_block, const BufferFill *p_fill) {
+	int pc = particles.size();
+	int from = p_block * PROCESS_BLOCK_SIZE;
+	int to = MIN(from + PROCESS_BLOCK_SIZE, pc);
+
+	const Particle *r = p_fill->particles;
+	float *ptr = p_fill->data + from * 20;
+
+	for (int i = from; i < to; i++) {
+		int idx = p_fill->order ? p_fill->order[i] : i;
 
 		Transform t = r[idx].transform;
 
@@ -1064,8 +1131,6 @@ void CPUParticles3D::_update_particle_data_buffer() {
 
 		ptr += 20;
 	}
-
-	can_update = true;
 }
 
 void CPUParticles3D::_set_redraw(bool p_redraw) {
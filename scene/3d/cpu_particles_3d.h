@@ -31,9 +31,16 @@
 #ifndef CPU_PARTICLES_H
 #define CPU_PARTICLES_H
 
+#include "core/local_vector.h"
 #include "core/rid.h"
 #include "scene/3d/visual_instance_3d.h"
 
+class ThreadWorkPool;
+
+namespace TestCPUParticles {
+class Simulator;
+}
+
 class CPUParticles3D : public GeometryInstance3D {
 private:
 	GDCLASS(CPUParticles3D, GeometryInstance3D);
@@ -79,6 +86,8 @@ public:
 	};
 
 private:
+	friend class TestCPUParticles::Simulator; // Steps emitters on a given pool in tests.
+
 	bool emitting;
 
 	struct Particle {
@@ -110,21 +119,15 @@ private:
 	Vector<float> particle_data;
 	Vector<int> particle_order;
 
-	struct SortLifetime {
-		const Particle *particles;
+	struct SortKey {
+		const float *keys;
 
 		bool operator()(int p_a, int p_b) const {
-			return particles[p_a].time > particles[p_b].time;
+			return keys[p_a] < keys[p_b];
 		}
 	};
 
-	struct SortAxis {
-		const Particle *particles;
-		Vector3 axis;
-		bool operator()(int p_a, int p_b) const {
-			return axis.dot(particles[p_a].transform.origin) < axis.dot(particles[p_b].transform.origin);
-		}
-	};
+	LocalVector<float> particle_sort_keys;
 
 	//
 
@@ -173,9 +176,34 @@ private:
 
 	Vector3 gravity;
 
+	// Particles are simulated and copied to the buffer in blocks of this size,
+	// which are spread over the SceneTree process threads.
+	enum {
+		PROCESS_BLOCK_SIZE = 1024
+	};
+
+	struct ProcessStep {
+		Particle *particles = nullptr;
+		float delta = 0.0;
+		float prev_time = 0.0;
+		float system_phase = 0.0;
+		uint32_t random_seed = 0;
+		Transform emission_xform;
+		Basis velocity_xform;
+	};
+
+	struct BufferFill {
+		const Particle *particles = nullptr;
+		const int *order = nullptr;
+		float *data = nullptr;
+	};
+
 	void _update_internal();
-	void _particles_process(float p_delta);
-	void _update_particle_data_buffer();
+	ThreadWorkPool *_get_process_thread_pool() const;
+	void _particles_process(float p_delta, ThreadWorkPool *p_pool);
+	void _particles_process_block(uint32_t p_block, const ProcessStep *p_step);
+	void _update_particle_data_buffer(ThreadWorkPool *p_pool);
+	void _update_particle_data_block(uint32_t p_block, const BufferFill *p_fill);
 
 	Mutex update_mutex;
 
@@ -80,7 +80,7 @@ void Node3D::_notify_dirty() {
 	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
 
 #endif
-		get_tree()->xform_change_list.add(&xform_change);
+		get_tree()->_add_xform_change(&xform_change);
 	}
 }
 
@@ -95,25 +95,30 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
-	/*
-	if (data.dirty&DIRTY_GLOBAL)
-		return; //already dirty
-	*/
+#ifdef TOOLS_ENABLED
+	bool notify = (data.gizmo.is_valid() || data.notify_transform) && !data.ignore_notification;
+#else
+	bool notify = data.notify_transform && !data.ignore_notification;
+#endif
+
+	// A global transform only becomes clean by computing it, which cleans all parents first, and transform
+	// notifications always compute it (see NOTIFICATION_TRANSFORM_CHANGED). So while this node is dirty, the
+	// whole subtree is dirty and already queued for notification, there is nothing left to propagate.
+	if ((data.dirty & DIRTY_GLOBAL) && (!notify || xform_change.in_list())) {
+		return;
+	}
 
 	data.children_lock++;
 
-	for (List<Node3D *>::Element *E = data.children.front(); E; E = E->next()) {
-		if (E->get()->data.toplevel_active) {
+	for (uint32_t i = 0; i < data.children.size(); i++) {
+		Node3D *c = data.children[i];
+		if (c->data.toplevel_active) {
 			continue; //don't propagate to a toplevel
 		}
-		E->get()->_propagate_transform_changed(p_origin);
+		c->_propagate_transform_changed(p_origin);
 	}
-#ifdef TOOLS_ENABLED
-	if ((data.gizmo.is_valid() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
-#else
-	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
-#endif
-		get_tree()->xform_change_list.add(&xform_change);
+	if (notify && !xform_change.in_list()) {
+		get_tree()->_add_xform_change(&xform_change);
 	}
 	data.dirty |= DIRTY_GLOBAL;
 
@@ -131,9 +136,10 @@ void Node3D::_notification(int p_what) {
 			}
 
 			if (data.parent) {
-				data.C = data.parent->data.children.push_back(this);
+				data.child_index = data.parent->data.children.size();
+				data.parent->data.children.push_back(this);
 			} else {
-				data.C = nullptr;
+				data.child_index = -1;
 			}
 
 			if (data.toplevel && !Engine::get_singleton()->is_editor_hint()) {
@@ -155,11 +161,15 @@ void Node3D::_notification(int p_what) {
 			if (xform_change.in_list()) {
 				get_tree()->xform_change_list.remove(&xform_change);
 			}
-			if (data.C) {
-				data.parent->data.children.erase(data.C);
+			if (data.child_index != -1) {
+				LocalVector<Node3D *> &siblings = data.parent->data.children;
+				Node3D *last = siblings[siblings.size() - 1];
+				siblings[data.child_index] = last;
+				last->data.child_index = data.child_index;
+				siblings.resize(siblings.size() - 1);
 			}
 			data.parent = nullptr;
-			data.C = nullptr;
+			data.child_index = -1;
 			data.toplevel_active = false;
 		} break;
 		case NOTIFICATION_ENTER_WORLD: {
@@ -211,6 +221,10 @@ void Node3D::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_TRANSFORM_CHANGED: {
+			// Resolve the global transform now, _propagate_transform_changed() relies on notified nodes being clean.
+			if (is_inside_tree()) {
+				get_global_transform();
+			}
 #ifdef TOOLS_ENABLED
 			if (data.gizmo.is_valid()) {
 				data.gizmo->transform();
@@ -407,6 +421,9 @@ void Node3D::set_gizmo(const Ref<Node3DGizmo> &p_gizmo) {
 		data.gizmo->free();
 	}
 	data.gizmo = p_gizmo;
+	if (data.gizmo.is_valid() && is_inside_tree()) {
+		get_global_transform(); //resolve, so gizmo transform notifications can be received
+	}
 	if (data.gizmo.is_valid() && is_inside_world()) {
 		data.gizmo->create();
 		if (is_visible_in_tree()) {
@@ -502,8 +519,8 @@ void Node3D::_propagate_visibility_changed() {
 	}
 #endif
 
-	for (List<Node3D *>::Element *E = data.children.front(); E; E = E->next()) {
-		Node3D *c = E->get();
+	for (uint32_t i = 0; i < data.children.size(); i++) {
+		Node3D *c = data.children[i];
 		if (!c || !c->data.visible) {
 			continue;
 		}
@@ -674,8 +691,21 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 	return get_global_transform().xform(p_local);
 }
 
+void Node3D::set_ignore_transform_notification(bool p_ignore) {
+	data.ignore_notification = p_ignore;
+	if (!p_ignore && is_inside_tree() && (data.dirty & DIRTY_GLOBAL)) {
+		// Propagation stops at dirty nodes, resolve so the next change reaches this one again.
+		// Changes made while ignoring are not notified.
+		get_global_transform();
+	}
+}
+
 void Node3D::set_notify_transform(bool p_enable) {
 	data.notify_transform = p_enable;
+	if (p_enable && is_inside_tree()) {
+		//this ensures that invalid globals get resolved, so notifications can be received
+		get_global_transform();
+	}
 }
 
 bool Node3D::is_transform_notification_enabled() const {
@@ -803,7 +833,7 @@ Node3D::Node3D() :
 	data.notify_local_transform = false;
 	data.notify_transform = false;
 	data.parent = nullptr;
-	data.C = nullptr;
+	data.child_index = -1;
 }
 
 Node3D::~Node3D() {
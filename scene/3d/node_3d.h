@@ -31,6 +31,7 @@
 #ifndef NODE_3D_H
 #define NODE_3D_H
 
+#include "core/local_vector.h"
 #include "scene/main/node.h"
 #include "scene/main/scene_tree.h"
 
@@ -77,8 +78,8 @@ class Node3D : public Node {
 
 		int children_lock;
 		Node3D *parent;
-		List<Node3D *> children;
-		List<Node3D *>::Element *C;
+		LocalVector<Node3D *> children; // Unordered, removal swaps the last child into the freed slot.
+		int child_index; // Position in the parent's children, -1 if none.
 
 		bool ignore_notification;
 		bool notify_local_transform;
@@ -102,7 +103,7 @@ class Node3D : public Node {
 	void _propagate_visibility_changed();
 
 protected:
-	_FORCE_INLINE_ void set_ignore_transform_notification(bool p_ignore) { data.ignore_notification = p_ignore; }
+	void set_ignore_transform_notification(bool p_ignore);
 
 	_FORCE_INLINE_ void _update_local_transform() const;
 
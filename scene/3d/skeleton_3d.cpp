@@ -175,18 +175,20 @@ void Skeleton3D::_update_process_order() {
 	}
 
 	Bone *bonesptr = bones.ptrw();
+	int *parents = bone_parents.ptr();
 	int len = bones.size();
 
 	process_order.resize(len);
 	int *order = process_order.ptrw();
 	for (int i = 0; i < len; i++) {
-		if (bonesptr[i].parent >= len) {
+		if (parents[i] >= len) {
 			//validate this just in case
-			ERR_PRINT("Bone " + itos(i) + " has invalid parent: " + itos(bonesptr[i].parent));
-			bonesptr[i].parent = -1;
+			ERR_PRINT("Bone " + itos(i) + " has invalid parent: " + itos(parents[i]));
+			parents[i] = -1;
 		}
 		order[i] = i;
 		bonesptr[i].sort_index = i;
+		pose_changed[i] |= 1;
 	}
 	//now check process order
 	int pass_count = 0;
@@ -195,7 +197,7 @@ void Skeleton3D::_update_process_order() {
 		//bublesort worst case is O(n^2), and this may be an infinite loop if cyclic
 		bool swapped = false;
 		for (int i = 0; i < len; i++) {
-			int parent_idx = bonesptr[order[i]].parent;
+			int parent_idx = parents[order[i]];
 			if (parent_idx < 0) {
 				continue; //do nothing because it has no parent
 			}
@@ -223,77 +225,103 @@ void Skeleton3D::_update_process_order() {
 	process_order_dirty = false;
 }
 
+void Skeleton3D::_update_global_poses() {
+	_update_process_order();
+
+	Bone *bonesptr = bones.ptrw();
+	const int len = bones.size();
+	const int *order = process_order.ptr();
+	const int *parents = bone_parents.ptr();
+	const Vector3 *positions = pose_positions.ptr();
+	const Quat *rotations = pose_rotations.ptr();
+	const Vector3 *scales = pose_scales.ptr();
+	Transform *globals = global_poses.ptr();
+	uint8_t *changed = pose_changed.ptr();
+
+	// Parents come first in process order, so a change is propagated down
+	// to every descendant before it is visited.
+	for (int i = 0; i < len; i++) {
+		const int idx = order[i];
+		const int parent = parents[idx];
+		if (parent >= 0) {
+			changed[idx] |= changed[parent] & 1;
+		}
+		if (!(changed[idx] & 1)) {
+			continue;
+		}
+
+		Bone &b = bonesptr[idx];
+		Transform &global = globals[idx];
+
+		if (b.global_pose_override_amount >= 0.999) {
+			global = b.global_pose_override;
+		} else {
+			Transform pose;
+			if (b.enabled) {
+				if (b.pose_basis_enable) {
+					pose.basis = b.pose_basis;
+				} else {
+					// Same as Basis::set_quat_scale(), without the matrix product.
+					const Vector3 &scale = scales[idx];
+					pose.basis.set_quat(rotations[idx]);
+					for (int j = 0; j < 3; j++) {
+						pose.basis.elements[j].x *= scale.x;
+						pose.basis.elements[j].y *= scale.y;
+						pose.basis.elements[j].z *= scale.z;
+					}
+				}
+				pose.origin = positions[idx];
+				if (b.custom_pose_enable) {
+					pose = b.custom_pose * pose;
+				}
+				if (!b.disable_rest) {
+					pose = b.rest * pose;
+				}
+			} else if (!b.disable_rest) {
+				pose = b.rest;
+			}
+
+			if (parent >= 0) {
+				global = globals[parent] * pose;
+			} else {
+				global = pose;
+			}
+
+			if (b.global_pose_override_amount >= CMP_EPSILON) {
+				global = global.interpolate_with(b.global_pose_override, b.global_pose_override_amount);
+			}
+		}
+
+		if (b.global_pose_override_reset && b.global_pose_override_amount != 0.0) {
+			b.global_pose_override_amount = 0.0;
+			// The override is gone, so the next update has to undo it.
+			changed[idx] |= 2;
+		}
+	}
+}
+
 void Skeleton3D::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_UPDATE_SKELETON: {
 			RenderingServer *rs = RenderingServer::get_singleton();
-			Bone *bonesptr = bones.ptrw();
+			const Bone *bonesptr = bones.ptr();
 			int len = bones.size();
 
-			_update_process_order();
+			_update_global_poses();
 
-			const int *order = process_order.ptr();
+			const Transform *globals = global_poses.ptr();
+			const uint8_t *changed = pose_changed.ptr();
 
 			for (int i = 0; i < len; i++) {
-				Bone &b = bonesptr[order[i]];
-
-				if (b.global_pose_override_amount >= 0.999) {
-					b.pose_global = b.global_pose_override;
-				} else {
-					if (b.disable_rest) {
-						if (b.enabled) {
-							Transform pose = b.pose;
-							if (b.custom_pose_enable) {
-								pose = b.custom_pose * pose;
-							}
-							if (b.parent >= 0) {
-								b.pose_global = bonesptr[b.parent].pose_global * pose;
-							} else {
-								b.pose_global = pose;
-							}
-						} else {
-							if (b.parent >= 0) {
-								b.pose_global = bonesptr[b.parent].pose_global;
-							} else {
-								b.pose_global = Transform();
-							}
-						}
-
-					} else {
-						if (b.enabled) {
-							Transform pose = b.pose;
-							if (b.custom_pose_enable) {
-								pose = b.custom_pose * pose;
-							}
-							if (b.parent >= 0) {
-								b.pose_global = bonesptr[b.parent].pose_global * (b.rest * pose);
-							} else {
-								b.pose_global = b.rest * pose;
-							}
-						} else {
-							if (b.parent >= 0) {
-								b.pose_global = bonesptr[b.parent].pose_global * b.rest;
-							} else {
-								b.pose_global = b.rest;
-							}
-						}
-					}
-
-					if (b.global_pose_override_amount >= CMP_EPSILON) {
-						b.pose_global = b.pose_global.interpolate_with(b.global_pose_override, b.global_pose_override_amount);
-					}
+				if (!(changed[i] & 1)) {
+					continue;
 				}
-
-				if (b.global_pose_override_reset) {
-					b.global_pose_override_amount = 0.0;
-				}
-
-				for (List<ObjectID>::Element *E = b.nodes_bound.front(); E; E = E->next()) {
+				for (const List<ObjectID>::Element *E = bonesptr[i].nodes_bound.front(); E; E = E->next()) {
 					Object *obj = ObjectDB::get_instance(E->get());
 					ERR_CONTINUE(!obj);
 					Node3D *node_3d = Object::cast_to<Node3D>(obj);
 					ERR_CONTINUE(!node_3d);
-					node_3d->set_transform(b.pose_global);
+					node_3d->set_transform(globals[i]);
 				}
 			}
 
@@ -310,7 +338,11 @@ void Skeleton3D::_notification(int p_what) {
 					E->get()->skin_bone_indices_ptrs = E->get()->skin_bone_indices.ptrw();
 				}
 
+				// Binds only need uploading when their bone moved, unless the
+				// skin or the bone list changed since the last upload.
+				bool upload_all = false;
 				if (E->get()->skeleton_version != version) {
+					upload_all = true;
 					for (uint32_t i = 0; i < bind_count; i++) {
 						StringName bind_name = skin->get_bind_name(i);
 
@@ -349,15 +381,23 @@ void Skeleton3D::_notification(int p_what) {
 				for (uint32_t i = 0; i < bind_count; i++) {
 					uint32_t bone_index = E->get()->skin_bone_indices_ptrs[i];
 					ERR_CONTINUE(bone_index >= (uint32_t)len);
-					rs->skeleton_bone_set_transform(skeleton, i, bonesptr[bone_index].pose_global * skin->get_bind_pose(i));
+					if (upload_all || (changed[bone_index] & 1)) {
+						rs->skeleton_bone_set_transform(skeleton, i, globals[bone_index] * skin->get_bind_pose(i));
+					}
 				}
 			}
 
+			uint8_t *changedw = pose_changed.ptr();
+			for (int i = 0; i < len; i++) {
+				changedw[i] >>= 1;
+			}
+
 			dirty = false;
 
-#ifdef TOOLS_ENABLED
-			emit_signal(SceneStringNames::get_singleton()->pose_updated);
-#endif // TOOLS_ENABLED
+			// Usually only the skeleton editor listens, skip the emission otherwise.
+			if (has_connections(SceneStringNames::get_singleton()->pose_updated)) {
+				emit_signal(SceneStringNames::get_singleton()->pose_updated);
+			}
 
 		} break;
 
@@ -386,7 +426,10 @@ void Skeleton3D::_notification(int p_what) {
 
 void Skeleton3D::clear_bones_global_pose_override() {
 	for (int i = 0; i < bones.size(); i += 1) {
-		bones.write[i].global_pose_override_amount = 0;
+		if (bones[i].global_pose_override_amount != 0) {
+			bones.write[i].global_pose_override_amount = 0;
+			_bone_changed(i);
+		}
 	}
 	_make_dirty();
 }
@@ -396,6 +439,7 @@ void Skeleton3D::set_bone_global_pose_override(int p_bone, const Transform &p_po
 	bones.write[p_bone].global_pose_override_amount = p_amount;
 	bones.write[p_bone].global_pose_override = p_pose;
 	bones.write[p_bone].global_pose_override_reset = !p_persistent;
+	_bone_changed(p_bone);
 	_make_dirty();
 }
 
@@ -404,7 +448,7 @@ Transform Skeleton3D::get_bone_global_pose(int p_bone) const {
 	if (dirty) {
 		const_cast<Skeleton3D *>(this)->notification(NOTIFICATION_UPDATE_SKELETON);
 	}
-	return bones[p_bone].pose_global;
+	return global_poses[p_bone];
 }
 
 // skeleton creation api
@@ -418,6 +462,12 @@ void Skeleton3D::add_bone(const String &p_name) {
 	Bone b;
 	b.name = p_name;
 	bones.push_back(b);
+	bone_parents.push_back(-1);
+	pose_positions.push_back(Vector3());
+	pose_rotations.push_back(Quat());
+	pose_scales.push_back(Vector3(1, 1, 1));
+	global_poses.push_back(Transform());
+	pose_changed.push_back(1);
 	process_order_dirty = true;
 	version++;
 	_make_dirty();
@@ -462,7 +512,7 @@ void Skeleton3D::set_bone_parent(int p_bone, int p_parent) {
 	ERR_FAIL_INDEX(p_bone, bones.size());
 	ERR_FAIL_COND(p_parent != -1 && (p_parent < 0));
 
-	bones.write[p_bone].parent = p_parent;
+	bone_parents[p_bone] = p_parent;
 	process_order_dirty = true;
 	_make_dirty();
 }
@@ -472,13 +522,13 @@ void Skeleton3D::unparent_bone_and_rest(int p_bone) {
 
 	_update_process_order();
 
-	int parent = bones[p_bone].parent;
+	int parent = bone_parents[p_bone];
 	while (parent >= 0) {
 		bones.write[p_bone].rest = bones[parent].rest * bones[p_bone].rest;
-		parent = bones[parent].parent;
+		parent = bone_parents[parent];
 	}
 
-	bones.write[p_bone].parent = -1;
+	bone_parents[p_bone] = -1;
 	process_order_dirty = true;
 
 	_make_dirty();
@@ -487,6 +537,7 @@ void Skeleton3D::unparent_bone_and_rest(int p_bone) {
 void Skeleton3D::set_bone_disable_rest(int p_bone, bool p_disable) {
 	ERR_FAIL_INDEX(p_bone, bones.size());
 	bones.write[p_bone].disable_rest = p_disable;
+	_bone_changed(p_bone);
 }
 
 bool Skeleton3D::is_bone_rest_disabled(int p_bone) const {
@@ -497,13 +548,14 @@ bool Skeleton3D::is_bone_rest_disabled(int p_bone) const {
 int Skeleton3D::get_bone_parent(int p_bone) const {
 	ERR_FAIL_INDEX_V(p_bone, bones.size(), -1);
 
-	return bones[p_bone].parent;
+	return bone_parents[p_bone];
 }
 
 void Skeleton3D::set_bone_rest(int p_bone, const Transform &p_rest) {
 	ERR_FAIL_INDEX(p_bone, bones.size());
 
 	bones.write[p_bone].rest = p_rest;
+	_bone_changed(p_bone);
 	_make_dirty();
 }
 
@@ -517,6 +569,7 @@ void Skeleton3D::set_bone_enabled(int p_bone, bool p_enabled) {
 	ERR_FAIL_INDEX(p_bone, bones.size());
 
 	bones.write[p_bone].enabled = p_enabled;
+	_bone_changed(p_bone);
 	_make_dirty();
 }
 
@@ -538,6 +591,9 @@ void Skeleton3D::bind_child_node_to_bone(int p_bone, Node *p_node) {
 	}
 
 	bones.write[p_bone].nodes_bound.push_back(id);
+	// Only changed bones move their nodes, so the new node gets placed too.
+	_bone_changed(p_bone);
+	_make_dirty();
 }
 
 void Skeleton3D::unbind_child_node_from_bone(int p_bone, Node *p_node) {
@@ -560,6 +616,12 @@ void Skeleton3D::get_bound_child_nodes_to_bone(int p_bone, List<Node *> *p_bound
 
 void Skeleton3D::clear_bones() {
 	bones.clear();
+	bone_parents.clear();
+	pose_positions.clear();
+	pose_rotations.clear();
+	pose_scales.clear();
+	global_poses.clear();
+	pose_changed.clear();
 	process_order_dirty = true;
 	version++;
 	_make_dirty();
@@ -570,7 +632,17 @@ void Skeleton3D::clear_bones() {
 void Skeleton3D::set_bone_pose(int p_bone, const Transform &p_pose) {
 	ERR_FAIL_INDEX(p_bone, bones.size());
 
-	bones.write[p_bone].pose = p_pose;
+	pose_positions[p_bone] = p_pose.origin;
+	pose_rotations[p_bone] = p_pose.basis.get_rotation_quat();
+	pose_scales[p_bone] = p_pose.basis.get_scale();
+
+	// Rotation and scale can't represent shear, keep such a basis as is.
+	Bone &bone = bones.write[p_bone];
+	bone.pose_basis_enable = !Basis(pose_rotations[p_bone], pose_scales[p_bone]).is_equal_approx(p_pose.basis);
+	if (bone.pose_basis_enable) {
+		bone.pose_basis = p_pose.basis;
+	}
+	_bone_changed(p_bone);
 	if (is_inside_tree()) {
 		_make_dirty();
 	}
@@ -578,7 +650,57 @@ void Skeleton3D::set_bone_pose(int p_bone, const Transform &p_pose) {
 
 Transform Skeleton3D::get_bone_pose(int p_bone) const {
 	ERR_FAIL_INDEX_V(p_bone, bones.size(), Transform());
-	return bones[p_bone].pose;
+	if (bones[p_bone].pose_basis_enable) {
+		return Transform(bones[p_bone].pose_basis, pose_positions[p_bone]);
+	}
+	return Transform(Basis(pose_rotations[p_bone], pose_scales[p_bone]), pose_positions[p_bone]);
+}
+
+void Skeleton3D::set_bone_pose_position(int p_bone, const Vector3 &p_position) {
+	ERR_FAIL_INDEX(p_bone, bones.size());
+
+	pose_positions[p_bone] = p_position;
+	_bone_changed(p_bone);
+	if (is_inside_tree()) {
+		_make_dirty();
+	}
+}
+
+Vector3 Skeleton3D::get_bone_pose_position(int p_bone) const {
+	ERR_FAIL_INDEX_V(p_bone, bones.size(), Vector3());
+	return pose_positions[p_bone];
+}
+
+void Skeleton3D::set_bone_pose_rotation(int p_bone, const Quat &p_rotation) {
+	ERR_FAIL_INDEX(p_bone, bones.size());
+
+	pose_rotations[p_bone] = p_rotation;
+	bones.write[p_bone].pose_basis_enable = false;
+	_bone_changed(p_bone);
+	if (is_inside_tree()) {
+		_make_dirty();
+	}
+}
+
+Quat Skeleton3D::get_bone_pose_rotation(int p_bone) const {
+	ERR_FAIL_INDEX_V(p_bone, bones.size(), Quat());
+	return pose_rotations[p_bone];
+}
+
+void Skeleton3D::set_bone_pose_scale(int p_bone, const Vector3 &p_scale) {
+	ERR_FAIL_INDEX(p_bone, bones.size());
+
+	pose_scales[p_bone] = p_scale;
+	bones.write[p_bone].pose_basis_enable = false;
+	_bone_changed(p_bone);
+	if (is_inside_tree()) {
+		_make_dirty();
+	}
+}
+
+Vector3 Skeleton3D::get_bone_pose_scale(int p_bone) const {
+	ERR_FAIL_INDEX_V(p_bone, bones.size(), Vector3());
+	return pose_scales[p_bone];
 }
 
 void Skeleton3D::set_bone_custom_pose(int p_bone, const Transform &p_custom_pose) {
@@ -587,6 +709,7 @@ void Skeleton3D::set_bone_custom_pose(int p_bone, const Transform &p_custom_pose
 
 	bones.write[p_bone].custom_pose_enable = (p_custom_pose != Transform());
 	bones.write[p_bone].custom_pose = p_custom_pose;
+	_bone_changed(p_bone);
 
 	_make_dirty();
 }
@@ -621,8 +744,8 @@ void Skeleton3D::localize_rests() {
 
 	for (int i = bones.size() - 1; i >= 0; i--) {
 		int idx = process_order[i];
-		if (bones[idx].parent >= 0) {
-			set_bone_rest(idx, bones[bones[idx].parent].rest.affine_inverse() * bones[idx].rest);
+		if (bone_parents[idx] >= 0) {
+			set_bone_rest(idx, bones[bone_parents[idx]].rest.affine_inverse() * bones[idx].rest);
 		}
 	}
 }
@@ -685,7 +808,7 @@ PhysicalBone3D *Skeleton3D::get_physical_bone_parent(int p_bone) {
 PhysicalBone3D *Skeleton3D::_get_physical_bone_parent(int p_bone) {
 	ERR_FAIL_INDEX_V(p_bone, bones.size(), nullptr);
 
-	const int parent_bone = bones[p_bone].parent;
+	const int parent_bone = bone_parents[p_bone];
 	if (0 > parent_bone) {
 		return nullptr;
 	}
@@ -821,8 +944,9 @@ Ref<SkinReference> Skeleton3D::register_skin(const Ref<Skin> &p_skin) {
 		// calculate global rests and invert them
 		for (int i = 0; i < len; i++) {
 			const Bone &b = bonesptr[order[i]];
-			if (b.parent >= 0) {
-				skin->set_bind_pose(order[i], skin->get_bind_pose(b.parent) * b.rest);
+			const int parent = bone_parents[order[i]];
+			if (parent >= 0) {
+				skin->set_bind_pose(order[i], skin->get_bind_pose(parent) * b.rest);
 			} else {
 				skin->set_bind_pose(order[i], b.rest);
 			}
@@ -895,6 +1019,12 @@ void Skeleton3D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_bone_pose", "bone_idx"), &Skeleton3D::get_bone_pose);
 	ClassDB::bind_method(D_METHOD("set_bone_pose", "bone_idx", "pose"), &Skeleton3D::set_bone_pose);
+	ClassDB::bind_method(D_METHOD("get_bone_pose_position", "bone_idx"), &Skeleton3D::get_bone_pose_position);
+	ClassDB::bind_method(D_METHOD("set_bone_pose_position", "bone_idx", "position"), &Skeleton3D::set_bone_pose_position);
+	ClassDB::bind_method(D_METHOD("get_bone_pose_rotation", "bone_idx"), &Skeleton3D::get_bone_pose_rotation);
+	ClassDB::bind_method(D_METHOD("set_bone_pose_rotation", "bone_idx", "rotation"), &Skeleton3D::set_bone_pose_rotation);
+	ClassDB::bind_method(D_METHOD("get_bone_pose_scale", "bone_idx"), &Skeleton3D::get_bone_pose_scale);
+	ClassDB::bind_method(D_METHOD("set_bone_pose_scale", "bone_idx", "scale"), &Skeleton3D::set_bone_pose_scale);
 
 	ClassDB::bind_method(D_METHOD("clear_bones_global_pose_override"), &Skeleton3D::clear_bones_global_pose_override);
 	ClassDB::bind_method(D_METHOD("set_bone_global_pose_override", "bone_idx", "pose", "amount", "persistent"), &Skeleton3D::set_bone_global_pose_override, DEFVAL(false));
@@ -919,9 +1049,7 @@ void Skeleton3D::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "animate_physical_bones"), "set_animate_physical_bones", "get_animate_physical_bones");
 #endif // _3D_DISABLED
 
-#ifdef TOOLS_ENABLED
 	ADD_SIGNAL(MethodInfo("pose_updated"));
-#endif // TOOLS_ENABLED
 
 	BIND_CONSTANT(NOTIFICATION_UPDATE_SKELETON);
 }
@@ -31,6 +31,7 @@
 #ifndef SKELETON_3D_H
 #define SKELETON_3D_H
 
+#include "core/local_vector.h"
 #include "core/rid.h"
 #include "scene/3d/node_3d.h"
 #include "scene/resources/skin.h"
@@ -75,18 +76,18 @@ private:
 		String name;
 
 		bool enabled;
-		int parent;
 		int sort_index; //used for re-sorting process order
 
 		bool disable_rest;
 		Transform rest;
 
-		Transform pose;
-		Transform pose_global;
-
 		bool custom_pose_enable;
 		Transform custom_pose;
 
+		// Set when the pose basis has shear, so it can't be stored as rotation and scale.
+		bool pose_basis_enable;
+		Basis pose_basis;
+
 		float global_pose_override_amount;
 		bool global_pose_override_reset;
 		Transform global_pose_override;
@@ -99,10 +100,10 @@ private:
 		List<ObjectID> nodes_bound;
 
 		Bone() {
-			parent = -1;
 			enabled = true;
 			disable_rest = false;
 			custom_pose_enable = false;
+			pose_basis_enable = false;
 			global_pose_override_amount = 0;
 			global_pose_override_reset = false;
 #ifndef _3D_DISABLED
@@ -118,6 +119,17 @@ private:
 
 	bool animate_physical_bones;
 	Vector<Bone> bones;
+
+	// Data touched by every pose update is kept out of Bone, in arrays indexed
+	// by bone, so the global pose pass walks contiguous memory.
+	LocalVector<int> bone_parents;
+	LocalVector<Vector3> pose_positions;
+	LocalVector<Quat> pose_rotations;
+	LocalVector<Vector3> pose_scales;
+	LocalVector<Transform> global_poses;
+	// Bit 0: recompute on the next update. Bit 1: recompute on the one after.
+	LocalVector<uint8_t> pose_changed;
+
 	Vector<int> process_order;
 	bool process_order_dirty;
 
@@ -139,6 +151,8 @@ private:
 	}
 
 	void _update_process_order();
+	void _update_global_poses();
+	_FORCE_INLINE_ void _bone_changed(int p_bone) { pose_changed[p_bone] |= 1; }
 
 protected:
 	bool _get(const StringName &p_path, Variant &r_ret) const;
@@ -191,6 +205,13 @@ public:
 	void set_bone_pose(int p_bone, const Transform &p_pose);
 	Transform get_bone_pose(int p_bone) const;
 
+	void set_bone_pose_position(int p_bone, const Vector3 &p_position);
+	Vector3 get_bone_pose_position(int p_bone) const;
+	void set_bone_pose_rotation(int p_bone, const Quat &p_rotation);
+	Quat get_bone_pose_rotation(int p_bone) const;
+	void set_bone_pose_scale(int p_bone, const Vector3 &p_scale);
+	Vector3 get_bone_pose_scale(int p_bone) const;
+
 	void set_bone_custom_pose(int p_bone, const Transform &p_custom_pose);
 	Transform get_bone_custom_pose(int p_bone) const;
 
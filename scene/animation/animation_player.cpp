@@ -213,6 +213,49 @@ void AnimationPlayer::_notification(int p_what) {
 	}
 }
 
+// Looks up the setter behind a single property name once, so playback can call it
+// directly instead of resolving the name through ClassDB on every write.
+static void _resolve_property_setter(Object *p_object, const Vector<StringName> &p_subpath, MethodBind *&r_setter, int &r_index) {
+	r_setter = nullptr;
+	r_index = -1;
+
+	// Nested properties need set_indexed(), and the editor relies on set() to flag edited objects.
+	if (p_subpath.size() != 1 || Engine::get_singleton()->is_editor_hint()) {
+		return;
+	}
+
+	StringName class_name = p_object->get_class_name();
+	StringName setter = ClassDB::get_property_setter(class_name, p_subpath[0]);
+	if (setter == StringName()) {
+		return;
+	}
+
+	r_setter = ClassDB::get_method(class_name, setter);
+	r_index = ClassDB::get_property_index(class_name, p_subpath[0]);
+}
+
+static void _set_animated_property(Object *p_object, const Vector<StringName> &p_subpath, MethodBind *p_setter, int p_setter_index, const Variant &p_value, bool *r_valid = nullptr) {
+	// Scripts may override any property, so objects with one take the generic path.
+	if (!p_setter || p_object->get_script_instance()) {
+		p_object->set_indexed(p_subpath, p_value, r_valid);
+		return;
+	}
+
+	Callable::CallError ce;
+	if (p_setter_index >= 0) {
+		Variant index = p_setter_index;
+		const Variant *args[2] = { &index, &p_value };
+		p_setter->call(p_object, args, 2, ce);
+	} else {
+		const Variant *args[1] = { &p_value };
+		p_setter->call(p_object, args, 1, ce);
+	}
+
+	if (r_valid) {
+		*r_valid = ce.error == Callable::CallError::CALL_OK;
+	}
+}
+
 void AnimationPlayer::_ensure_node_caches(AnimationData *p_anim) {
 	// Already cached?
 	if (p_anim->node_cache.size() == p_anim->animation->get_track_count()) {
@@ -226,9 +269,15 @@ void AnimationPlayer::_ensure_node_caches(AnimationData *p_anim) {
 	Animation *a = p_anim->animation.operator->();
 
 	p_anim->node_cache.resize(a->get_track_count());
+	p_anim->track_cursors.resize(a->get_track_count());
+	p_anim->track_properties.resize(a->get_track_count());
+	p_anim->track_beziers.resize(a->get_track_count());
 
 	for (int i = 0; i < a->get_track_count(); i++) {
 		p_anim->node_cache.write[i] = nullptr;
+		p_anim->track_cursors[i] = Animation::TransformTrackCursor();
+		p_anim->track_properties[i] = nullptr;
+		p_anim->track_beziers[i] = nullptr;
 		RES resource;
 		Vector<StringName> leftover_path;
 		Node *child = parent->get_node_and_resource(a->track_get_path(i), resource, leftover_path);
@@ -289,12 +338,14 @@ void AnimationPlayer::_ensure_node_caches(AnimationData *p_anim) {
 		}
 
 		if (a->track_get_type(i) == Animation::TYPE_VALUE) {
-			if (!p_anim->node_cache[i]->property_anim.has(a->track_get_path(i).get_concatenated_subnames())) {
+			StringName subnames = a->track_get_path(i).get_concatenated_subnames();
+			if (!p_anim->node_cache[i]->property_anim.has(subnames)) {
 				TrackNodeCache::PropertyAnim pa;
 				pa.subpath = leftover_path;
 				pa.object = resource.is_valid() ? (Object *)resource.ptr() : (Object *)child;
 				pa.special = SP_NONE;
 				pa.owner = p_anim->node_cache[i];
+				_resolve_property_setter(pa.object, pa.subpath, pa.setter, pa.setter_index);
 				if (false && p_anim->node_cache[i]->node_2d) {
 					if (leftover_path.size() == 1 && leftover_path[0] == SceneStringNames::get_singleton()->transform_pos) {
 						pa.special = SP_NODE2D_POS;
@@ -304,19 +355,23 @@ void AnimationPlayer::_ensure_node_caches(AnimationData *p_anim) {
 						pa.special = SP_NODE2D_SCALE;
 					}
 				}
-				p_anim->node_cache[i]->property_anim[a->track_get_path(i).get_concatenated_subnames()] = pa;
+				p_anim->node_cache[i]->property_anim[subnames] = pa;
 			}
+			p_anim->track_properties[i] = &p_anim->node_cache[i]->property_anim[subnames];
 		}
 
 		if (a->track_get_type(i) == Animation::TYPE_BEZIER && leftover_path.size()) {
-			if (!p_anim->node_cache[i]->bezier_anim.has(a->track_get_path(i).get_concatenated_subnames())) {
+			StringName subnames = a->track_get_path(i).get_concatenated_subnames();
+			if (!p_anim->node_cache[i]->bezier_anim.has(subnames)) {
 				TrackNodeCache::BezierAnim ba;
 				ba.bezier_property = leftover_path;
 				ba.object = resource.is_valid() ? (Object *)resource.ptr() : (Object *)child;
 				ba.owner = p_anim->node_cache[i];
+				_resolve_property_setter(ba.object, ba.bezier_property, ba.setter, ba.setter_index);
 
-				p_anim->node_cache[i]->bezier_anim[a->track_get_path(i).get_concatenated_subnames()] = ba;
+				p_anim->node_cache[i]->bezier_anim[subnames] = ba;
 			}
+			p_anim->track_beziers[i] = &p_anim->node_cache[i]->bezier_anim[subnames];
 		}
 	}
 }
@@ -359,7 +414,7 @@ void AnimationPlayer::_animation_process_animation(AnimationData *p_anim, float
 				Quat rot;
 				Vector3 scale;
 
-				Error err = a->transform_track_interpolate(i, p_time, &loc, &rot, &scale);
+				Error err = a->transform_track_interpolate(i, p_time, &loc, &rot, &scale, &p_anim->track_cursors[i]);
 				//ERR_CONTINUE(err!=OK); //used for testing, should be removed
 
 				if (err != OK) {
@@ -388,10 +443,8 @@ void AnimationPlayer::_animation_process_animation(AnimationData *p_anim, float
 
 				//StringName property=a->track_get_path(i).get_property();
 
-				Map<StringName, TrackNodeCache::PropertyAnim>::Element *E = nc->property_anim.find(a->track_get_path(i).get_concatenated_subnames());
-				ERR_CONTINUE(!E); //should it continue, or create a new one?
-
-				TrackNodeCache::PropertyAnim *pa = &E->get();
+				TrackNodeCache::PropertyAnim *pa = p_anim->track_properties[i];
+				ERR_CONTINUE(!pa); //should it continue, or create a new one?
 
 				Animation::UpdateMode update_mode = a->value_track_get_update_mode(i);
 
@@ -469,7 +522,7 @@ void AnimationPlayer::_animation_process_animation(AnimationData *p_anim, float
 						switch (pa->special) {
 							case SP_NONE: {
 								bool valid;
-								pa->object->set_indexed(pa->subpath, value, &valid); //you are not speshul
+								_set_animated_property(pa->object, pa->subpath, pa->setter, pa->setter_index, value, &valid); //you are not speshul
 #ifdef DEBUG_ENABLED
 								if (!valid) {
 									ERR_PRINT("Failed setting track value '" + String(pa->owner->path) + "'. Check if property exists or the type of key is valid. Animation '" + a->get_name() + "' at node '" + get_path() + "'.");
@@ -564,10 +617,8 @@ void AnimationPlayer::_animation_process_animation(AnimationData *p_anim, float
 					continue;
 				}
 
-				Map<StringName, TrackNodeCache::BezierAnim>::Element *E = nc->bezier_anim.find(a->track_get_path(i).get_concatenated_subnames());
-				ERR_CONTINUE(!E); //should it continue, or create a new one?
-
-				TrackNodeCache::BezierAnim *ba = &E->get();
+				TrackNodeCache::BezierAnim *ba = p_anim->track_beziers[i];
+				ERR_CONTINUE(!ba); //should it continue, or create a new one?
 
 				float bezier = a->bezier_track_interpolate(i, p_time);
 				if (ba->accum_pass != accum_pass) {
@@ -830,12 +881,14 @@ void AnimationPlayer::_animation_update_transforms() {
 
 			ERR_CONTINUE(nc->accum_pass != accum_pass);
 
-			t.origin = nc->loc_accum;
-			t.basis.set_quat_scale(nc->rot_accum, nc->scale_accum);
 			if (nc->skeleton && nc->bone_idx >= 0) {
-				nc->skeleton->set_bone_pose(nc->bone_idx, t);
+				nc->skeleton->set_bone_pose_position(nc->bone_idx, nc->loc_accum);
+				nc->skeleton->set_bone_pose_rotation(nc->bone_idx, nc->rot_accum);
+				nc->skeleton->set_bone_pose_scale(nc->bone_idx, nc->scale_accum);
 
 			} else if (nc->spatial) {
+				t.origin = nc->loc_accum;
+				t.basis.set_quat_scale(nc->rot_accum, nc->scale_accum);
 				nc->spatial->set_transform(t);
 			}
 		}
@@ -851,7 +904,7 @@ void AnimationPlayer::_animation_update_transforms() {
 		switch (pa->special) {
 			case SP_NONE: {
 				bool valid;
-				pa->object->set_indexed(pa->subpath, pa->value_accum, &valid); //you are not speshul
+				_set_animated_property(pa->object, pa->subpath, pa->setter, pa->setter_index, pa->value_accum, &valid); //you are not speshul
 #ifdef DEBUG_ENABLED
 				if (!valid) {
 					ERR_PRINT("Failed setting key at time " + rtos(playback.current.pos) + " in Animation '" + get_current_animation() + "' at Node '" + get_path() + "', Track '" + String(pa->owner->path) + "'. Check if property exists or the type of key is right for the property");
@@ -894,7 +947,7 @@ void AnimationPlayer::_animation_update_transforms() {
 		TrackNodeCache::BezierAnim *ba = cache_update_bezier[i];
 
 		ERR_CONTINUE(ba->accum_pass != accum_pass);
-		ba->object->set_indexed(ba->bezier_property, ba->bezier_accum);
+		_set_animated_property(ba->object, ba->bezier_property, ba->setter, ba->setter_index, ba->bezier_accum);
 	}
 
 	cache_update_bezier_size = 0;
@@ -1339,6 +1392,8 @@ void AnimationPlayer::clear_caches() {
 
 	for (Map<StringName, AnimationData>::Element *E = animation_set.front(); E; E = E->next()) {
 		E->get().node_cache.clear();
+		E->get().track_properties.clear();
+		E->get().track_beziers.clear();
 	}
 
 	cache_update_size = 0;
@@ -114,6 +114,8 @@ private:
 			Variant value_accum;
 			uint64_t accum_pass = 0;
 			Variant capture;
+			MethodBind *setter = nullptr; // Resolved property setter, if any.
+			int setter_index = -1;
 
 			PropertyAnim() {}
 		};
@@ -126,6 +128,8 @@ private:
 			float bezier_accum = 0.0;
 			Object *object = nullptr;
 			uint64_t accum_pass = 0;
+			MethodBind *setter = nullptr;
+			int setter_index = -1;
 
 			BezierAnim() {}
 		};
@@ -166,6 +170,10 @@ private:
 		String name;
 		StringName next;
 		Vector<TrackNodeCache *> node_cache;
+		LocalVector<Animation::TransformTrackCursor> track_cursors; // Sampling cursors for compressed tracks.
+		// Per track targets of value and bezier tracks, so playback doesn't look them up by path.
+		LocalVector<TrackNodeCache::PropertyAnim *> track_properties;
+		LocalVector<TrackNodeCache::BezierAnim *> track_beziers;
 		Ref<Animation> animation;
 	};
 
@@ -33,6 +33,8 @@
 #include "animation_blend_tree.h"
 #include "core/engine.h"
 #include "core/method_bind_ext.gen.inc"
+#include "core/project_settings.h"
+#include "scene/main/scene_tree.h"
 #include "scene/scene_string_names.h"
 #include "servers/audio/audio_stream.h"
 
@@ -718,6 +720,13 @@ void AnimationTree::_clear_caches() {
 }
 
 void AnimationTree::_process_graph(float p_delta) {
+	if (_evaluate_graph(p_delta)) {
+		_blend_tracks(BLEND_TRACKS_ALL);
+		_apply_tracks();
+	}
+}
+
+bool AnimationTree::_evaluate_graph(float p_delta) {
 	_update_properties(); //if properties need updating, update them
 
 	//check all tracks, see if they need modification
@@ -728,14 +737,14 @@ void AnimationTree::_process_graph(float p_delta) {
 		ERR_PRINT("AnimationTree: root AnimationNode is not set, disabling playback.");
 		set_active(false);
 		cache_valid = false;
-		return;
+		return false;
 	}
 
 	if (!has_node(animation_player)) {
 		ERR_PRINT("AnimationTree: no valid AnimationPlayer path set, disabling playback");
 		set_active(false);
 		cache_valid = false;
-		return;
+		return false;
 	}
 
 	AnimationPlayer *player = Object::cast_to<AnimationPlayer>(get_node(animation_player));
@@ -765,12 +774,12 @@ void AnimationTree::_process_graph(float p_delta) {
 		ERR_PRINT("AnimationTree: path points to a node not an AnimationPlayer, disabling playback");
 		set_active(false);
 		cache_valid = false;
-		return;
+		return false;
 	}
 
 	if (!cache_valid) {
 		if (!_update_caches(player)) {
-			return;
+			return false;
 		}
 	}
 
@@ -807,9 +816,10 @@ void AnimationTree::_process_graph(float p_delta) {
 		root->_pre_process(SceneStringNames::get_singleton()->parameters_base_path, nullptr, &state, p_delta, false, Vector<StringName>());
 	}
 
-	if (!state.valid) {
-		return; //state is not valid. do nothing.
-	}
+	return state.valid; //if state is not valid, do nothing.
+}
+
+void AnimationTree::_blend_tracks(BlendTracks p_tracks) {
 	//apply value/transform/bezier blends to track caches and execute method/audio/animation tracks
 
 	{
@@ -833,6 +843,17 @@ void AnimationTree::_process_graph(float p_delta) {
 					continue; //may happen should not
 				}
 
+				if (p_tracks != BLEND_TRACKS_ALL) {
+					bool event = track->type != Animation::TYPE_TRANSFORM && track->type != Animation::TYPE_BEZIER;
+					if (track->type == Animation::TYPE_VALUE) {
+						Animation::UpdateMode update_mode = a->value_track_get_update_mode(i);
+						event = update_mode != Animation::UPDATE_CONTINUOUS && update_mode != Animation::UPDATE_CAPTURE;
+					}
+					if (event != (p_tracks == BLEND_TRACKS_EVENTS)) {
+						continue; //handled by the other pass
+					}
+				}
+
 				track->root_motion = root_motion_track == path;
 
 				ERR_CONTINUE(!state.track_map.has(path));
@@ -1180,7 +1201,9 @@ void AnimationTree::_process_graph(float p_delta) {
 			}
 		}
 	}
+}
 
+void AnimationTree::_apply_tracks() {
 	{
 		// finally, set the tracks
 		const NodePath *K = nullptr;
@@ -1206,7 +1229,9 @@ void AnimationTree::_process_graph(float p_delta) {
 							root_motion_transform = (t->skeleton->get_bone_rest(t->bone_idx) * root_motion_transform) * t->skeleton->get_bone_rest(t->bone_idx).affine_inverse();
 						}
 					} else if (t->skeleton && t->bone_idx >= 0) {
-						t->skeleton->set_bone_pose(t->bone_idx, xform);
+						t->skeleton->set_bone_pose_position(t->bone_idx, t->loc);
+						t->skeleton->set_bone_pose_rotation(t->bone_idx, t->rot);
+						t->skeleton->set_bone_pose_scale(t->bone_idx, t->scale);
 
 					} else {
 						t->spatial->set_transform(xform);
@@ -1236,16 +1261,103 @@ void AnimationTree::advance(float p_time) {
 	_process_graph(p_time);
 }
 
+bool AnimationTree::parallel_evaluation = false;
+Mutex AnimationTree::evaluation_mutex;
+SelfList<AnimationTree>::List *AnimationTree::evaluation_list = nullptr;
+LocalVector<AnimationTree *> AnimationTree::evaluating_trees;
+LocalVector<ObjectID> AnimationTree::evaluating_ids;
+
+struct AnimationTree::ParallelBlend {
+	void blend(uint32_t p_index, AnimationTree *const *p_trees) {
+		p_trees[p_index]->_blend_tracks(BLEND_TRACKS_CACHES);
+	}
+};
+
+void AnimationTree::init_evaluation() {
+	parallel_evaluation = GLOBAL_DEF("animation/tree/parallel_evaluation", false);
+	evaluation_list = memnew(SelfList<AnimationTree>::List);
+}
+
+void AnimationTree::finish_evaluation() {
+	while (evaluation_list->first()) {
+		evaluation_list->remove(evaluation_list->first());
+	}
+	memdelete(evaluation_list);
+	evaluation_list = nullptr;
+}
+
+void AnimationTree::_queue_graph(float p_delta) {
+	if (!parallel_evaluation) {
+		_process_graph(p_delta);
+		return;
+	}
+
+	if (!_evaluate_graph(p_delta)) {
+		return;
+	}
+
+	MutexLock lock(evaluation_mutex);
+	if (!evaluation_element.in_list()) {
+		evaluation_list->add(&evaluation_element);
+	}
+}
+
+void AnimationTree::flush_evaluations() {
+	{
+		MutexLock lock(evaluation_mutex);
+		while (evaluation_list->first()) {
+			evaluating_trees.push_back(evaluation_list->first()->self());
+			evaluating_ids.push_back(evaluation_list->first()->self()->get_instance_id());
+			evaluation_list->remove(evaluation_list->first());
+		}
+	}
+
+	if (evaluating_trees.size() == 0) {
+		return;
+	}
+
+	// Sampling and blending only touch each tree's own caches, so trees run in parallel.
+	// Everything that reaches other objects stays on the main thread.
+	SceneTree *scene_tree = SceneTree::get_singleton();
+	if (evaluating_trees.size() > 1 && scene_tree) {
+		ParallelBlend blend;
+		scene_tree->get_process_thread_pool().do_work(evaluating_trees.size(), &blend, &ParallelBlend::blend, (AnimationTree *const *)evaluating_trees.ptr());
+	} else {
+		evaluating_trees[0]->_blend_tracks(BLEND_TRACKS_CACHES);
+	}
+
+	for (uint32_t i = 0; i < evaluating_trees.size(); i++) {
+		// Method tracks and setters of an earlier tree may have freed this one.
+		if (!ObjectDB::get_instance(evaluating_ids[i])) {
+			continue;
+		}
+		evaluating_trees[i]->_blend_tracks(BLEND_TRACKS_EVENTS);
+		if (!ObjectDB::get_instance(evaluating_ids[i])) {
+			continue;
+		}
+		evaluating_trees[i]->_apply_tracks();
+	}
+
+	evaluating_trees.clear();
+	evaluating_ids.clear();
+}
+
 void AnimationTree::_notification(int p_what) {
 	if (active && p_what == NOTIFICATION_INTERNAL_PHYSICS_PROCESS && process_mode == ANIMATION_PROCESS_PHYSICS) {
-		_process_graph(get_physics_process_delta_time());
+		_queue_graph(get_physics_process_delta_time());
 	}
 
 	if (active && p_what == NOTIFICATION_INTERNAL_PROCESS && process_mode == ANIMATION_PROCESS_IDLE) {
-		_process_graph(get_process_delta_time());
+		_queue_graph(get_process_delta_time());
 	}
 
 	if (p_what == NOTIFICATION_EXIT_TREE) {
+		{
+			MutexLock lock(evaluation_mutex);
+			if (evaluation_element.in_list()) {
+				evaluation_list->remove(&evaluation_element);
+			}
+		}
 		_clear_caches();
 		if (last_animation_player.is_valid()) {
 			Object *player = ObjectDB::get_instance(last_animation_player);
@@ -1514,7 +1626,8 @@ void AnimationTree::_bind_methods() {
 	BIND_ENUM_CONSTANT(ANIMATION_PROCESS_MANUAL);
 }
 
-AnimationTree::AnimationTree() {
+AnimationTree::AnimationTree() :
+		evaluation_element(this) {
 	process_mode = ANIMATION_PROCESS_IDLE;
 	active = false;
 	cache_valid = false;
@@ -32,6 +32,9 @@
 #define ANIMATION_GRAPH_PLAYER_H
 
 #include "animation_player.h"
+#include "core/local_vector.h"
+#include "core/os/mutex.h"
+#include "core/self_list.h"
 #include "scene/3d/node_3d.h"
 #include "scene/3d/skeleton_3d.h"
 #include "scene/resources/animation.h"
@@ -263,6 +266,29 @@ private:
 	bool _update_caches(AnimationPlayer *player);
 	void _process_graph(float p_delta);
 
+	enum BlendTracks {
+		BLEND_TRACKS_ALL,
+		BLEND_TRACKS_CACHES, // Only blends into the track caches, safe on a worker thread.
+		BLEND_TRACKS_EVENTS, // Discrete values, methods, audio and animations, which act on other objects right away.
+	};
+
+	bool _evaluate_graph(float p_delta);
+	void _blend_tracks(BlendTracks p_tracks);
+	void _apply_tracks();
+
+	// Trees processed during the internal process pass are blended together on the
+	// scene tree's thread pool once the pass is over, see flush_evaluations().
+	struct ParallelBlend;
+
+	static bool parallel_evaluation;
+	static Mutex evaluation_mutex;
+	static SelfList<AnimationTree>::List *evaluation_list;
+	static LocalVector<AnimationTree *> evaluating_trees;
+	static LocalVector<ObjectID> evaluating_ids;
+	SelfList<AnimationTree> evaluation_element;
+
+	void _queue_graph(float p_delta);
+
 	uint64_t setup_pass;
 	uint64_t process_pass;
 
@@ -328,6 +354,11 @@ public:
 	void rename_parameter(const String &p_base, const String &p_new_base);
 
 	uint64_t get_last_process_pass() const;
+
+	static void init_evaluation();
+	static void finish_evaluation();
+	static void flush_evaluations();
+
 	AnimationTree();
 	~AnimationTree();
 };
@@ -35,7 +35,7 @@
 void Tween::_add_pending_command(StringName p_key, const Variant &p_arg1, const Variant &p_arg2, const Variant &p_arg3, const Variant &p_arg4, const Variant &p_arg5, const Variant &p_arg6, const Variant &p_arg7, const Variant &p_arg8, const Variant &p_arg9, const Variant &p_arg10) {
 	// Add a new pending command and reference it
 	pending_commands.push_back(PendingCommand());
-	PendingCommand &cmd = pending_commands.back()->get();
+	PendingCommand &cmd = pending_commands[pending_commands.size() - 1];
 
 	// Update the command with the target key
 	cmd.key = p_key;
@@ -101,9 +101,9 @@ void Tween::_add_pending_command(StringName p_key, const Variant &p_arg1, const
 
 void Tween::_process_pending_commands() {
 	// For each pending command...
-	for (List<PendingCommand>::Element *E = pending_commands.front(); E; E = E->next()) {
+	for (uint32_t i = 0; i < pending_commands.size(); i++) {
 		// Get the command
-		PendingCommand &cmd = E->get();
+		PendingCommand &cmd = pending_commands[i];
 		Callable::CallError err;
 
 		// Grab all of the arguments for the command
@@ -437,7 +437,80 @@ Variant &Tween::_get_delta_val(InterpolateData &p_data) {
 	return p_data.initial_val;
 }
 
+void Tween::_cache_typed_values(InterpolateData &p_data) {
+	p_data.typed_components = 0;
+
+	// Following and targeting tweens recompute their delta every step
+	if (p_data.type != INTER_PROPERTY && p_data.type != INTER_METHOD) {
+		return;
+	}
+
+	switch (p_data.initial_val.get_type()) {
+		case Variant::FLOAT: {
+			p_data.typed_components = 1;
+			p_data.typed_initial[0] = p_data.initial_val;
+			p_data.typed_delta[0] = p_data.delta_val;
+		} break;
+
+		case Variant::VECTOR2: {
+			Vector2 i = p_data.initial_val;
+			Vector2 d = p_data.delta_val;
+			p_data.typed_components = 2;
+			p_data.typed_initial[0] = i.x;
+			p_data.typed_initial[1] = i.y;
+			p_data.typed_delta[0] = d.x;
+			p_data.typed_delta[1] = d.y;
+		} break;
+
+		case Variant::VECTOR3: {
+			Vector3 i = p_data.initial_val;
+			Vector3 d = p_data.delta_val;
+			p_data.typed_components = 3;
+			p_data.typed_initial[0] = i.x;
+			p_data.typed_initial[1] = i.y;
+			p_data.typed_initial[2] = i.z;
+			p_data.typed_delta[0] = d.x;
+			p_data.typed_delta[1] = d.y;
+			p_data.typed_delta[2] = d.z;
+		} break;
+
+		case Variant::COLOR: {
+			Color i = p_data.initial_val;
+			Color d = p_data.delta_val;
+			p_data.typed_components = 4;
+			for (int j = 0; j < 4; j++) {
+				p_data.typed_initial[j] = i.components[j];
+				p_data.typed_delta[j] = d.components[j];
+			}
+		} break;
+
+		default: {
+		} break;
+	}
+}
+
 Variant Tween::_run_equation(InterpolateData &p_data) {
+	if (p_data.typed_components) {
+		// Every easing equation is linear in its initial and delta values, so the
+		// equation only runs once to get the weight of the delta for all components
+		real_t weight = _run_equation(p_data.trans_type, p_data.ease_type, p_data.elapsed - p_data.delay, 0, 1, p_data.duration);
+		real_t r[4];
+		for (int j = 0; j < p_data.typed_components; j++) {
+			r[j] = p_data.typed_initial[j] + p_data.typed_delta[j] * weight;
+		}
+
+		switch (p_data.typed_components) {
+			case 1:
+				return r[0];
+			case 2:
+				return Vector2(r[0], r[1]);
+			case 3:
+				return Vector3(r[0], r[1], r[2]);
+			default:
+				return Color(r[0], r[1], r[2], r[3]);
+		}
+	}
+
 	// Get the initial and delta values from the data
 	Variant initial_val = _get_initial_val(p_data);
 	Variant &delta_val = _get_delta_val(p_data);
@@ -682,9 +755,9 @@ void Tween::_tween_process(float p_delta) {
 	if (repeat) {
 		// For each interpolation...
 		bool repeats_finished = true;
-		for (List<InterpolateData>::Element *E = interpolates.front(); E; E = E->next()) {
+		for (uint32_t i = 0; i < interpolates.size(); i++) {
 			// Get the data from it
-			InterpolateData &data = E->get();
+			InterpolateData &data = interpolates[i];
 
 			// Is not finished?
 			if (!data.finish) {
@@ -704,9 +777,9 @@ void Tween::_tween_process(float p_delta) {
 	int any_unfinished = 0;
 
 	// For each tween we wish to interpolate...
-	for (List<InterpolateData>::Element *E = interpolates.front(); E; E = E->next()) {
+	for (uint32_t i = 0; i < interpolates.size(); i++) {
 		// Get the data from it
-		InterpolateData &data = E->get();
+		InterpolateData &data = interpolates[i];
 
 		// Is the data not active or already finished? No need to go any further
 		if (!data.active || data.finish) {
@@ -730,7 +803,7 @@ void Tween::_tween_process(float p_delta) {
 		} else if (prev_delaying) {
 			// We can apply the tween's value to the data and emit that the tween has started
 			_apply_tween_value(data, data.initial_val);
-			emit_signal("tween_started", object, NodePath(Vector<StringName>(), data.key, false));
+			emit_signal("tween_started", object, data.key_path);
 		}
 
 		// Are we at the end of the tween?
@@ -786,7 +859,7 @@ void Tween::_tween_process(float p_delta) {
 			_apply_tween_value(data, result);
 
 			// Emit that the tween has taken a step
-			emit_signal("tween_step", object, NodePath(Vector<StringName>(), data.key, false), data.elapsed, result);
+			emit_signal("tween_step", object, data.key_path, data.elapsed, result);
 		}
 
 		// Is the tween now finished?
@@ -797,11 +870,11 @@ void Tween::_tween_process(float p_delta) {
 
 			// Mark the tween as completed and emit the signal
 			data.elapsed = 0;
-			emit_signal("tween_completed", object, NodePath(Vector<StringName>(), data.key, false));
+			emit_signal("tween_completed", object, data.key_path);
 
-			// If we are not repeating the tween, remove it
+			// If we are not repeating the tween, remove it once we are done iterating
 			if (!repeat) {
-				call_deferred("_remove_by_uid", data.uid);
+				data.removed = true;
 				any_unfinished--;
 			}
 		}
@@ -809,6 +882,11 @@ void Tween::_tween_process(float p_delta) {
 	// One less update left to go
 	pending_update--;
 
+	// Drop the completed tweens
+	if (pending_update == 0) {
+		_erase_removed_interpolates();
+	}
+
 	// If all tweens are completed, we no longer need to be active
 	if (any_unfinished == 0) {
 		set_active(false);
@@ -878,9 +956,9 @@ void Tween::start() {
 void Tween::reset(Object *p_object, StringName p_key) {
 	// Find all interpolations that use the same object and target string
 	pending_update++;
-	for (List<InterpolateData>::Element *E = interpolates.front(); E; E = E->next()) {
+	for (uint32_t i = 0; i < interpolates.size(); i++) {
 		// Get the target object
-		InterpolateData &data = E->get();
+		InterpolateData &data = interpolates[i];
 		Object *object = ObjectDB::get_instance(data.id);
 		if (object == nullptr) {
 			continue;
@@ -904,9 +982,9 @@ void Tween::reset(Object *p_object, StringName p_key) {
 void Tween::reset_all() {
 	// Go through all interpolations
 	pending_update++;
-	for (List<InterpolateData>::Element *E = interpolates.front(); E; E = E->next()) {
+	for (uint32_t i = 0; i < interpolates.size(); i++) {
 		// Get the target data and set it back to the initial state
-		InterpolateData &data = E->get();
+		InterpolateData &data = interpolates[i];
 		data.elapsed = 0;
 		data.finish = false;
 
@@ -921,9 +999,9 @@ void Tween::reset_all() {
 void Tween::stop(Object *p_object, StringName p_key) {
 	// Find the tween that has the given target object and string key
 	pending_update++;
-	for (List<InterpolateData>::Element *E = interpolates.front(); E; E = E->next()) {
+	for (uint32_t i = 0; i < interpolates.size(); i++) {
 		// Get the object the tween is targeting
-		InterpolateData &data = E->get();
+		InterpolateData &data = interpolates[i];
 		Object *object = ObjectDB::get_instance(data.id);
 		if (object == nullptr) {
 			continue;
@@ -944,9 +1022,9 @@ void Tween::stop_all() {
 
 	// For each interpolation...
 	pending_update++;
-	for (List<InterpolateData>::Element *E = interpolates.front(); E; E = E->next()) {
+	for (uint32_t i = 0; i < interpolates.size(); i++) {
 		// Simply set it inactive
-		InterpolateData &data = E->get();
+		InterpolateData &data = interpolates[i];
 		data.active = false;
 	}
 	pending_update--;
@@ -959,9 +1037,9 @@ void Tween::resume(Object *p_object, StringName p_key) {
 
 	// Find the tween that uses the given target object and string key
 	pending_update++;
-	for (List<InterpolateData>::Element *E = interpolates.front(); E; E = E->next()) {
+	for (uint32_t i = 0; i < interpolates.size(); i++) {
 		// Grab the object
-		InterpolateData &data = E->get();
+		InterpolateData &data = interpolates[i];
 		Object *object = ObjectDB::get_instance(data.id);
 		if (object == nullptr) {
 			continue;
@@ -982,9 +1060,9 @@ void Tween::resume_all() {
 
 	// For each interpolation...
 	pending_update++;
-	for (List<InterpolateData>::Element *E = interpolates.front(); E; E = E->next()) {
+	for (uint32_t i = 0; i < interpolates.size(); i++) {
 		// Simply grab it and set it to active
-		InterpolateData &data = E->get();
+		InterpolateData &data = interpolates[i];
 		data.active = true;
 	}
 	pending_update--;
@@ -998,10 +1076,9 @@ void Tween::remove(Object *p_object, StringName p_key) {
 	}
 
 	// For each interpolation...
-	List<List<InterpolateData>::Element *> for_removal;
-	for (List<InterpolateData>::Element *E = interpolates.front(); E; E = E->next()) {
+	for (uint32_t i = 0; i < interpolates.size(); i++) {
 		// Get the target object
-		InterpolateData &data = E->get();
+		InterpolateData &data = interpolates[i];
 		Object *object = ObjectDB::get_instance(data.id);
 		if (object == nullptr) {
 			continue;
@@ -1009,15 +1086,12 @@ void Tween::remove(Object *p_object, StringName p_key) {
 
 		// If the target object and string key match, queue it for removal
 		if (object == p_object && (data.concatenated_key == p_key || p_key == "")) {
-			for_removal.push_back(E);
+			data.removed = true;
 		}
 	}
 
-	// For each interpolation we wish to remove...
-	for (List<List<InterpolateData>::Element *>::Element *E = for_removal.front(); E; E = E->next()) {
-		// Erase it
-		interpolates.erase(E->get());
-	}
+	// Erase the interpolations we wish to remove
+	_erase_removed_interpolates();
 }
 
 void Tween::_remove_by_uid(int uid) {
@@ -1028,20 +1102,48 @@ void Tween::_remove_by_uid(int uid) {
 	}
 
 	// Find the interpolation that matches the given UID
-	for (List<InterpolateData>::Element *E = interpolates.front(); E; E = E->next()) {
-		if (uid == E->get().uid) {
+	for (uint32_t i = 0; i < interpolates.size(); i++) {
+		if (uid == interpolates[i].uid) {
 			// It matches, erase it and stop looking
-			E->erase();
+			interpolates.remove(i);
 			break;
 		}
 	}
 }
 
+void Tween::_erase_removed_interpolates() {
+	// Compact the remaining interpolations in place, keeping their order.
+	// The storage is kept, so new tweens don't allocate once it has grown.
+	uint32_t count = 0;
+	for (uint32_t i = 0; i < interpolates.size(); i++) {
+		if (interpolates[i].removed) {
+			continue;
+		}
+		if (count != i) {
+			interpolates[count] = interpolates[i];
+		}
+		count++;
+	}
+	interpolates.resize(count);
+	_prune_key_paths();
+}
+
 void Tween::_push_interpolate_data(InterpolateData &p_data) {
 	pending_update++;
 
 	// Add the new interpolation
 	p_data.uid = ++uid;
+
+	// Share the signal key path between the tweens animating the same key
+	if (p_data.key_path.is_empty()) {
+		NodePath *key_path = key_paths.getptr(p_data.concatenated_key);
+		if (!key_path) {
+			key_path = key_paths.set(p_data.concatenated_key, NodePath(Vector<StringName>(), p_data.key, false));
+		}
+		p_data.key_path = *key_path;
+	}
+
+	_cache_typed_values(p_data);
 	interpolates.push_back(p_data);
 
 	pending_update--;
@@ -1059,14 +1161,43 @@ void Tween::remove_all() {
 	// Clear out all interpolations and reset the uid
 	interpolates.clear();
 	uid = 0;
+	_prune_key_paths();
+}
+
+const NodePath &Tween::_get_key_path(const StringName &p_key) {
+	NodePath *key_path = key_paths.getptr(p_key);
+	if (!key_path) {
+		Vector<StringName> key;
+		key.push_back(p_key);
+		key_path = key_paths.set(p_key, NodePath(Vector<StringName>(), key, false));
+	}
+	return *key_path;
+}
+
+const NodePath &Tween::_get_property_path(const NodePath &p_property) {
+	NodePath *property_path = property_paths.getptr(p_property);
+	if (!property_path) {
+		property_path = property_paths.set(p_property, p_property.get_as_property_path());
+	}
+	return *property_path;
+}
+
+void Tween::_prune_key_paths() {
+	// Live interpolations hold their own references to the paths, so the
+	// caches can be dropped whenever they outgrow what is being tweened.
+	uint32_t limit = MAX(64u, interpolates.size() * 2);
+	if (key_paths.size() + property_paths.size() > limit) {
+		key_paths.clear();
+		property_paths.clear();
+	}
 }
 
 void Tween::seek(real_t p_time) {
 	// Go through each interpolation...
 	pending_update++;
-	for (List<InterpolateData>::Element *E = interpolates.front(); E; E = E->next()) {
+	for (uint32_t i = 0; i < interpolates.size(); i++) {
 		// Get the target data
-		InterpolateData &data = E->get();
+		InterpolateData &data = interpolates[i];
 
 		// Update the elapsed data to be set to the target time
 		data.elapsed = p_time;
@@ -1103,9 +1234,9 @@ real_t Tween::tell() const {
 	real_t pos = 0;
 
 	// For each interpolation...
-	for (const List<InterpolateData>::Element *E = interpolates.front(); E; E = E->next()) {
+	for (uint32_t i = 0; i < interpolates.size(); i++) {
 		// Get the data and figure out if it's position is further along than the previous ones
-		const InterpolateData &data = E->get();
+		const InterpolateData &data = interpolates[i];
 		if (data.elapsed > pos) {
 			// Save it if so
 			pos = data.elapsed;
@@ -1125,9 +1256,9 @@ real_t Tween::get_runtime() const {
 
 	// For each interpolation...
 	real_t runtime = 0;
-	for (const List<InterpolateData>::Element *E = interpolates.front(); E; E = E->next()) {
+	for (uint32_t i = 0; i < interpolates.size(); i++) {
 		// Get the tween data and see if it's runtime is greater than the previous tweens
-		const InterpolateData &data = E->get();
+		const InterpolateData &data = interpolates[i];
 		real_t t = data.delay + data.duration;
 		if (t > runtime) {
 			// This is the longest running tween
@@ -1278,7 +1409,7 @@ bool Tween::_calc_delta_val(const Variant &p_initial_val, const Variant &p_final
 	return true;
 }
 
-void Tween::_build_interpolation(InterpolateType p_interpolation_type, Object *p_object, NodePath *p_property, StringName *p_method, Variant p_initial_val, Variant p_final_val, real_t p_duration, TransitionType p_trans_type, EaseType p_ease_type, real_t p_delay) {
+void Tween::_build_interpolation(InterpolateType p_interpolation_type, Object *p_object, const NodePath &p_key_path, Variant p_initial_val, Variant p_final_val, real_t p_duration, TransitionType p_trans_type, EaseType p_ease_type, real_t p_delay) {
 	// TODO: Add initialization+implementation for remaining interpolation types
 	// TODO: Fix this method's organization to take advantage of the type
 
@@ -1316,24 +1447,19 @@ void Tween::_build_interpolation(InterpolateType p_interpolation_type, Object *p
 	ERR_FAIL_COND_MSG(p_ease_type < 0 || p_ease_type >= EASE_COUNT, "Invalid easing type provided to Tween.");
 	data.ease_type = p_ease_type;
 
-	// Is the property defined?
-	if (p_property) {
+	// The key path holds the property's subnames, or the method name
+	data.key = p_key_path.get_subnames();
+	data.concatenated_key = p_key_path.get_concatenated_subnames();
+	data.key_path = p_key_path;
+
+	if (p_interpolation_type == INTER_PROPERTY) {
 		// Check that the object actually contains the given property
 		bool prop_valid = false;
-		p_object->get_indexed(p_property->get_subnames(), &prop_valid);
-		ERR_FAIL_COND_MSG(!prop_valid, "Tween target object has no property named: " + p_property->get_concatenated_subnames() + ".");
-
-		data.key = p_property->get_subnames();
-		data.concatenated_key = p_property->get_concatenated_subnames();
-	}
-
-	// Is the method defined?
-	if (p_method) {
+		p_object->get_indexed(data.key, &prop_valid);
+		ERR_FAIL_COND_MSG(!prop_valid, "Tween target object has no property named: " + data.concatenated_key + ".");
+	} else {
 		// Does the object even have the requested method?
-		ERR_FAIL_COND_MSG(!p_object->has_method(*p_method), "Tween target object has no method named: " + *p_method + ".");
-
-		data.key.push_back(*p_method);
-		data.concatenated_key = *p_method;
+		ERR_FAIL_COND_MSG(!p_object->has_method(data.concatenated_key), "Tween target object has no method named: " + data.concatenated_key + ".");
 	}
 
 	// Is there not a valid delta?
@@ -1353,12 +1479,12 @@ void Tween::interpolate_property(Object *p_object, NodePath p_property, Variant
 	}
 
 	// Get the property from the node path
-	p_property = p_property.get_as_property_path();
+	const NodePath &property = _get_property_path(p_property);
 
 	// If no initial value given, grab the initial value from the object
 	// TODO: Is this documented? This is very useful and removes a lot of clutter from tweens!
 	if (p_initial_val.get_type() == Variant::NIL) {
-		p_initial_val = p_object->get_indexed(p_property.get_subnames());
+		p_initial_val = p_object->get_indexed(property.get_subnames());
 	}
 
 	// Convert any integers into REALs as they are better for interpolation
@@ -1370,7 +1496,7 @@ void Tween::interpolate_property(Object *p_object, NodePath p_property, Variant
 	}
 
 	// Build the interpolation data
-	_build_interpolation(INTER_PROPERTY, p_object, &p_property, nullptr, p_initial_val, p_final_val, p_duration, p_trans_type, p_ease_type, p_delay);
+	_build_interpolation(INTER_PROPERTY, p_object, property, p_initial_val, p_final_val, p_duration, p_trans_type, p_ease_type, p_delay);
 }
 
 void Tween::interpolate_method(Object *p_object, StringName p_method, Variant p_initial_val, Variant p_final_val, real_t p_duration, TransitionType p_trans_type, EaseType p_ease_type, real_t p_delay) {
@@ -1389,7 +1515,7 @@ void Tween::interpolate_method(Object *p_object, StringName p_method, Variant p_
 	}
 
 	// Build the interpolation data
-	_build_interpolation(INTER_METHOD, p_object, nullptr, &p_method, p_initial_val, p_final_val, p_duration, p_trans_type, p_ease_type, p_delay);
+	_build_interpolation(INTER_METHOD, p_object, _get_key_path(p_method), p_initial_val, p_final_val, p_duration, p_trans_type, p_ease_type, p_delay);
 }
 
 void Tween::interpolate_callback(Object *p_object, real_t p_duration, String p_callback, VARIANT_ARG_DECLARE) {
@@ -31,6 +31,8 @@
 #ifndef TWEEN_H
 #define TWEEN_H
 
+#include "core/dense_hash_map.h"
+#include "core/local_vector.h"
 #include "scene/main/node.h"
 
 class Tween : public Node {
@@ -100,11 +102,22 @@ private:
 		int args;
 		Variant arg[5];
 		int uid;
+		bool removed;
+		NodePath key_path; // Passed to the signals, shared by tweens of the same key.
+
+		// Components of float, Vector2, Vector3 and Color values when the delta is fixed,
+		// so they can be interpolated without going through Variant.
+		int typed_components;
+		real_t typed_initial[4];
+		real_t typed_delta[4];
+
 		InterpolateData() {
 			active = false;
 			finish = false;
 			call_deferred = false;
 			uid = 0;
+			removed = false;
+			typed_components = 0;
 		}
 	};
 
@@ -115,14 +128,19 @@ private:
 	mutable int pending_update;
 	int uid;
 
-	List<InterpolateData> interpolates;
+	LocalVector<InterpolateData> interpolates;
+	// Signal key paths shared by the tweens animating the same key, and the
+	// property paths resolved from the paths given to interpolate_property().
+	// Both are dropped once they hold many more keys than are being tweened.
+	DenseHashMap<StringName, NodePath> key_paths;
+	DenseHashMap<NodePath, NodePath> property_paths;
 
 	struct PendingCommand {
 		StringName key;
 		int args;
 		Variant arg[10];
 	};
-	List<PendingCommand> pending_commands;
+	LocalVector<PendingCommand> pending_commands;
 
 	void _add_pending_command(StringName p_key, const Variant &p_arg1 = Variant(), const Variant &p_arg2 = Variant(), const Variant &p_arg3 = Variant(), const Variant &p_arg4 = Variant(), const Variant &p_arg5 = Variant(), const Variant &p_arg6 = Variant(), const Variant &p_arg7 = Variant(), const Variant &p_arg8 = Variant(), const Variant &p_arg9 = Variant(), const Variant &p_arg10 = Variant());
 	void _process_pending_commands();
@@ -140,8 +158,13 @@ private:
 
 	void _tween_process(float p_delta);
 	void _remove_by_uid(int uid);
+	void _erase_removed_interpolates();
+	void _cache_typed_values(InterpolateData &p_data);
 	void _push_interpolate_data(InterpolateData &p_data);
-	void _build_interpolation(InterpolateType p_interpolation_type, Object *p_object, NodePath *p_property, StringName *p_method, Variant p_initial_val, Variant p_final_val, real_t p_duration, TransitionType p_trans_type, EaseType p_ease_type, real_t p_delay);
+	const NodePath &_get_key_path(const StringName &p_key);
+	const NodePath &_get_property_path(const NodePath &p_property);
+	void _prune_key_paths();
+	void _build_interpolation(InterpolateType p_interpolation_type, Object *p_object, const NodePath &p_key_path, Variant p_initial_val, Variant p_final_val, real_t p_duration, TransitionType p_trans_type, EaseType p_ease_type, real_t p_delay);
 
 protected:
 	bool _set(const StringName &p_name, const Variant &p_value);
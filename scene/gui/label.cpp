@@ -156,6 +156,9 @@ void Label::_notification(int p_what) {
 		int line = 0;
 		int line_to = lines_skipped + (lines_visible > 0 ? lines_visible : 1);
 		FontDrawer drawer(font, font_outline_modulate);
+		// Whole words go through the font's shaped line cache. Outlined fonts keep
+		// drawing each character, so every outline is drawn below all the glyphs.
+		bool draw_words = !font->has_outline();
 		while (wc) {
 			/* handle lines not meant to be drawn quickly */
 			if (line >= line_to) {
@@ -230,11 +233,55 @@ void Label::_notification(int p_what) {
 					}
 				}
 
-				if (font_color_shadow.a > 0) {
-					int chars_total_shadow = chars_total; //save chars drawn
-					float x_ofs_shadow = x_ofs;
+				if (draw_words) {
+					int word_chars = from->word_len;
+					if (visible_chars >= 0) {
+						word_chars = CLAMP(visible_chars - chars_total, 0, word_chars);
+					}
+					if (word_chars > 0) {
+						String word = xl_text.substr(pos, word_chars);
+						if (uppercase) {
+							word = word.to_upper();
+						}
+
+						if (font_color_shadow.a > 0) {
+							font->draw(ci, Point2(x_ofs, y_ofs) + shadow_ofs, word, font_color_shadow);
+							if (use_outline) {
+								font->draw(ci, Point2(x_ofs, y_ofs) + Vector2(-shadow_ofs.x, shadow_ofs.y), word, font_color_shadow);
+								font->draw(ci, Point2(x_ofs, y_ofs) + Vector2(shadow_ofs.x, -shadow_ofs.y), word, font_color_shadow);
+								font->draw(ci, Point2(x_ofs, y_ofs) + Vector2(-shadow_ofs.x, -shadow_ofs.y), word, font_color_shadow);
+							}
+						}
+						font->draw(ci, Point2(x_ofs, y_ofs), word, font_color);
+						x_ofs += font->get_string_size(word).width;
+						chars_total += word_chars;
+					}
+				} else {
+					if (font_color_shadow.a > 0) {
+						int chars_total_shadow = chars_total; //save chars drawn
+						float x_ofs_shadow = x_ofs;
+						for (int i = 0; i < from->word_len; i++) {
+							if (visible_chars < 0 || chars_total_shadow < visible_chars) {
+								CharType c = xl_text[i + pos];
+								CharType n = xl_text[i + pos + 1];
+								if (uppercase) {
+									c = String::char_uppercase(c);
+									n = String::char_uppercase(n);
+								}
+
+								float move = drawer.draw_char(ci, Point2(x_ofs_shadow, y_ofs) + shadow_ofs, c, n, font_color_shadow);
+								if (use_outline) {
+									drawer.draw_char(ci, Point2(x_ofs_shadow, y_ofs) + Vector2(-shadow_ofs.x, shadow_ofs.y), c, n, font_color_shadow);
+									drawer.draw_char(ci, Point2(x_ofs_shadow, y_ofs) + Vector2(shadow_ofs.x, -shadow_ofs.y), c, n, font_color_shadow);
+									drawer.draw_char(ci, Point2(x_ofs_shadow, y_ofs) + Vector2(-shadow_ofs.x, -shadow_ofs.y), c, n, font_color_shadow);
+								}
+								x_ofs_shadow += move;
+								chars_total_shadow++;
+							}
+						}
+					}
 					for (int i = 0; i < from->word_len; i++) {
-						if (visible_chars < 0 || chars_total_shadow < visible_chars) {
+						if (visible_chars < 0 || chars_total < visible_chars) {
 							CharType c = xl_text[i + pos];
 							CharType n = xl_text[i + pos + 1];
 							if (uppercase) {
@@ -242,30 +289,11 @@ void Label::_notification(int p_what) {
 								n = String::char_uppercase(n);
 							}
 
-							float move = drawer.draw_char(ci, Point2(x_ofs_shadow, y_ofs) + shadow_ofs, c, n, font_color_shadow);
-							if (use_outline) {
-								drawer.draw_char(ci, Point2(x_ofs_shadow, y_ofs) + Vector2(-shadow_ofs.x, shadow_ofs.y), c, n, font_color_shadow);
-								drawer.draw_char(ci, Point2(x_ofs_shadow, y_ofs) + Vector2(shadow_ofs.x, -shadow_ofs.y), c, n, font_color_shadow);
-								drawer.draw_char(ci, Point2(x_ofs_shadow, y_ofs) + Vector2(-shadow_ofs.x, -shadow_ofs.y), c, n, font_color_shadow);
-							}
-							x_ofs_shadow += move;
-							chars_total_shadow++;
+							x_ofs += drawer.draw_char(ci, Point2(x_ofs, y_ofs), c, n, font_color);
+							chars_total++;
 						}
 					}
 				}
-				for (int i = 0; i < from->word_len; i++) {
-					if (visible_chars < 0 || chars_total < visible_chars) {
-						CharType c = xl_text[i + pos];
-						CharType n = xl_text[i + pos + 1];
-						if (uppercase) {
-							c = String::char_uppercase(c);
-							n = String::char_uppercase(n);
-						}
-
-						x_ofs += drawer.draw_char(ci, Point2(x_ofs, y_ofs), c, n, font_color);
-						chars_total++;
-					}
-				}
 				from = from->next;
 			}
 
@@ -175,6 +175,7 @@ int RichTextLabel::_process_line(ItemFrame *p_frame, const Vector2 &p_ofs, int &
 		l.height_caches.clear();
 		l.ascent_caches.clear();
 		l.descent_caches.clear();
+		l.space_caches.clear();
 		l.char_count = 0;
 		l.minimum_width = 0;
 		l.maximum_width = 0;
@@ -960,7 +961,14 @@ void RichTextLabel::_notification(int p_what) {
 			}
 		} break;
 		case NOTIFICATION_RESIZED: {
-			main->first_invalid_line = 0; //invalidate ALL
+			int width = _get_text_rect().get_size().width - scroll_w;
+			if (width != line_cache_width) {
+				main->first_invalid_line = 0; //invalidate ALL
+			} else if (main->first_invalid_accum == main->lines.size()) {
+				// Line layout only depends on the width, so the caches are still valid.
+				// Revalidating the last offset is enough to update the scroll page.
+				main->first_invalid_accum = main->lines.size() - 1;
+			}
 			update();
 
 		} break;
@@ -996,21 +1004,12 @@ void RichTextLabel::_notification(int p_what) {
 
 			int ofs = vscroll->get_value();
 
-			//todo, change to binary search
-
-			int from_line = 0;
-			int total_chars = 0;
-			while (from_line < main->lines.size()) {
-				if (main->lines[from_line].height_accum_cache + _get_text_rect().get_position().y >= ofs) {
-					break;
-				}
-				total_chars += main->lines[from_line].char_count;
-				from_line++;
-			}
+			int from_line = _find_first_line(main, ofs - text_rect.get_position().y);
 
 			if (from_line >= main->lines.size()) {
 				break; //nothing to draw
 			}
+			int total_chars = main->lines[from_line].char_accum_cache - main->lines[from_line].char_count;
 			int y = (main->lines[from_line].height_accum_cache - main->lines[from_line].height_cache) - ofs;
 			Ref<Font> base_font = get_theme_font("normal_font");
 			Color base_color = get_theme_color("default_color");
@@ -1047,15 +1046,7 @@ void RichTextLabel::_find_click(ItemFrame *p_frame, const Point2i &p_click, Item
 	bool use_outline = get_theme_constant("shadow_as_outline");
 	Point2 shadow_ofs(get_theme_constant("shadow_offset_x"), get_theme_constant("shadow_offset_y"));
 
-	//todo, change to binary search
-	int from_line = 0;
-
-	while (from_line < p_frame->lines.size()) {
-		if (p_frame->lines[from_line].height_accum_cache >= ofs) {
-			break;
-		}
-		from_line++;
-	}
+	int from_line = _find_first_line(p_frame, ofs);
 
 	if (from_line >= p_frame->lines.size()) {
 		return;
@@ -1529,7 +1520,8 @@ bool RichTextLabel::_find_layout_subitem(Item *from, Item *to) {
 }
 
 void RichTextLabel::_validate_line_caches(ItemFrame *p_frame) {
-	if (p_frame->first_invalid_line == p_frame->lines.size()) {
+	int line_count = p_frame->lines.size();
+	if (p_frame->first_invalid_line == line_count && p_frame->first_invalid_accum >= line_count) {
 		return;
 	}
 
@@ -1545,23 +1537,33 @@ void RichTextLabel::_validate_line_caches(ItemFrame *p_frame) {
 
 	Ref<Font> base_font = get_theme_font("normal_font");
 
-	for (int i = p_frame->first_invalid_line; i < p_frame->lines.size(); i++) {
+	line_cache_width = text_rect.get_size().width - scroll_w;
+
+	// Only lines whose content changed are laid out again; appending text touches the last lines alone.
+	for (int i = p_frame->first_invalid_line; i < line_count; i++) {
 		int y = 0;
-		_process_line(p_frame, text_rect.get_position(), y, text_rect.get_size().width - scroll_w, i, PROCESS_CACHE, base_font, Color(), font_color_shadow, use_outline, shadow_ofs);
+		_process_line(p_frame, text_rect.get_position(), y, line_cache_width, i, PROCESS_CACHE, base_font, Color(), font_color_shadow, use_outline, shadow_ofs);
 		p_frame->lines.write[i].height_cache = y;
-		p_frame->lines.write[i].height_accum_cache = y;
+	}
+
+	Line *lines = p_frame->lines.ptrw();
+	for (int i = MIN(p_frame->first_invalid_line, p_frame->first_invalid_accum); i < line_count; i++) {
+		lines[i].height_accum_cache = lines[i].height_cache;
+		lines[i].char_accum_cache = lines[i].char_count;
 
 		if (i > 0) {
-			p_frame->lines.write[i].height_accum_cache += p_frame->lines[i - 1].height_accum_cache;
+			lines[i].height_accum_cache += lines[i - 1].height_accum_cache;
+			lines[i].char_accum_cache += lines[i - 1].char_accum_cache;
 		}
 	}
 
 	int total_height = 0;
-	if (p_frame->lines.size()) {
-		total_height = p_frame->lines[p_frame->lines.size() - 1].height_accum_cache + get_theme_stylebox("normal")->get_minimum_size().height;
+	if (line_count) {
+		total_height = lines[line_count - 1].height_accum_cache + get_theme_stylebox("normal")->get_minimum_size().height;
 	}
 
-	main->first_invalid_line = p_frame->lines.size();
+	main->first_invalid_line = line_count;
+	main->first_invalid_accum = line_count;
 
 	updating_scroll = true;
 	vscroll->set_max(total_height);
@@ -1577,6 +1579,22 @@ void RichTextLabel::_validate_line_caches(ItemFrame *p_frame) {
 	}
 }
 
+int RichTextLabel::_find_first_line(ItemFrame *p_frame, int p_y) const {
+	// Accumulated heights grow with the line index, so the first line reaching p_y can be bisected.
+	int low = 0;
+	int high = p_frame->lines.size();
+	while (low < high) {
+		int mid = (low + high) / 2;
+		if (p_frame->lines[mid].height_accum_cache >= p_y) {
+			high = mid;
+		} else {
+			low = mid + 1;
+		}
+	}
+
+	return low;
+}
+
 void RichTextLabel::_invalidate_current_line(ItemFrame *p_frame) {
 	if (p_frame->lines.size() - 1 <= p_frame->first_invalid_line) {
 		p_frame->first_invalid_line = p_frame->lines.size() - 1;
@@ -1667,21 +1685,23 @@ void RichTextLabel::_add_item(Item *p_item, bool p_enter, bool p_ensure_newline)
 	}
 }
 
-void RichTextLabel::_remove_item(Item *p_item, const int p_line, const int p_subitem_line) {
+void RichTextLabel::_remove_item(Item *p_item, const int p_line) {
 	int size = p_item->subitems.size();
 	if (size == 0) {
-		p_item->parent->subitems.erase(p_item);
+		// Only the items after a removed newline move up a line.
+		List<Item *>::Element *E = p_item->parent == current ? p_item->E->next() : current->subitems.front();
+		p_item->parent->subitems.erase(p_item->E);
 		if (p_item->type == ITEM_NEWLINE) {
 			current_frame->lines.remove(p_line);
-			for (int i = p_subitem_line; i < current->subitems.size(); i++) {
-				if (current->subitems[i]->line > 0) {
-					current->subitems[i]->line--;
+			for (; E; E = E->next()) {
+				if (E->get()->line > p_line) {
+					E->get()->line--;
 				}
 			}
 		}
 	} else {
 		for (int i = 0; i < size; i++) {
-			_remove_item(p_item->subitems.front()->get(), p_line, p_subitem_line);
+			_remove_item(p_item->subitems.front()->get(), p_line);
 		}
 	}
 }
@@ -1739,15 +1759,23 @@ bool RichTextLabel::remove_line(const int p_line) {
 		return false;
 	}
 
-	int i = 0;
-	while (i < current->subitems.size() && current->subitems[i]->line < p_line) {
-		i++;
+	List<Item *>::Element *E = current->subitems.front();
+	while (E && E->get()->line < p_line) {
+		E = E->next();
 	}
 
 	bool was_newline = false;
-	while (i < current->subitems.size()) {
-		was_newline = current->subitems[i]->type == ITEM_NEWLINE;
-		_remove_item(current->subitems[i], current->subitems[i]->line, p_line);
+	bool removed_nested = false;
+	while (E) {
+		Item *item = E->get();
+		was_newline = item->type == ITEM_NEWLINE;
+		if (item->subitems.size()) {
+			// Emptied first and removed on the next pass, like any other item.
+			removed_nested = true;
+		} else {
+			E = E->next();
+		}
+		_remove_item(item, item->line);
 		if (was_newline) {
 			break;
 		}
@@ -1755,16 +1783,26 @@ bool RichTextLabel::remove_line(const int p_line) {
 
 	if (!was_newline) {
 		current_frame->lines.remove(p_line);
-		if (current_frame->lines.size() == 0) {
-			current_frame->lines.resize(1);
-		}
+		// Without a newline the line's content merges with what is left, so lay it out again.
+		main->first_invalid_line = MIN(main->first_invalid_line, MIN(p_line, main->lines.size() - 1));
+	}
+	if (current_frame->lines.size() == 0) {
+		// Nor has a fresh empty line been laid out yet.
+		current_frame->lines.resize(1);
+		main->first_invalid_line = 0;
 	}
 
 	if (p_line == 0 && current->subitems.size() > 0) {
 		main->lines.write[0].from = main;
 	}
 
-	main->first_invalid_line = 0;
+	if (removed_nested) {
+		main->first_invalid_line = 0;
+	} else {
+		// The other lines keep their layout, only the ones below move up.
+		main->first_invalid_accum = MIN(main->first_invalid_accum, MIN(p_line, main->lines.size() - 1));
+	}
+	update();
 
 	return true;
 }
@@ -2924,6 +2962,7 @@ RichTextLabel::RichTextLabel() {
 	main->lines.write[0].from = main;
 	main->first_invalid_line = 0;
 	current_frame = main;
+	line_cache_width = -1;
 	tab_size = 4;
 	default_align = ALIGN_LEFT;
 	underline_meta = true;
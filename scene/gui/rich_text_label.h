@@ -92,12 +92,14 @@ private:
 		int height_cache;
 		int height_accum_cache;
 		int char_count;
+		int char_accum_cache;
 		int minimum_width;
 		int maximum_width;
 
 		Line() {
 			from = nullptr;
 			char_count = 0;
+			char_accum_cache = 0;
 		}
 	};
 
@@ -131,6 +133,7 @@ private:
 		bool cell;
 		Vector<Line> lines;
 		int first_invalid_line;
+		int first_invalid_accum; // Lines from here on keep their layout but need their accumulated offsets updated.
 		ItemFrame *parent_frame;
 
 		ItemFrame() {
@@ -138,6 +141,7 @@ private:
 			parent_frame = nullptr;
 			cell = false;
 			parent_line = 0;
+			first_invalid_accum = 0;
 		}
 	};
 
@@ -321,6 +325,7 @@ private:
 	bool updating_scroll;
 	int current_idx;
 	int visible_line_count;
+	int line_cache_width;
 
 	int tab_size;
 	bool underline_meta;
@@ -335,9 +340,10 @@ private:
 
 	void _invalidate_current_line(ItemFrame *p_frame);
 	void _validate_line_caches(ItemFrame *p_frame);
+	int _find_first_line(ItemFrame *p_frame, int p_y) const;
 
 	void _add_item(Item *p_item, bool p_enter = false, bool p_ensure_newline = false);
-	void _remove_item(Item *p_item, const int p_line, const int p_subitem_line);
+	void _remove_item(Item *p_item, const int p_line);
 
 	struct ProcessState {
 		int line_width;
@@ -128,7 +128,7 @@ void TextEdit::Text::_update_line_cache(int p_line) const {
 	}
 
 	text.write[p_line].width_cache = w;
-	text.write[p_line].wrap_amount_cache = -1;
+	text.write[p_line].wrap_columns_cache.clear();
 }
 
 int TextEdit::Text::get_line_width(int p_line) const {
@@ -141,16 +141,27 @@ int TextEdit::Text::get_line_width(int p_line) const {
 	return text[p_line].width_cache;
 }
 
-void TextEdit::Text::set_line_wrap_amount(int p_line, int p_wrap_amount) const {
+void TextEdit::Text::set_line_wrap_columns(int p_line, const Vector<int> &p_columns) const {
 	ERR_FAIL_INDEX(p_line, text.size());
 
-	text.write[p_line].wrap_amount_cache = p_wrap_amount;
+	text.write[p_line].wrap_columns_cache = p_columns;
+}
+
+const Vector<int> &TextEdit::Text::get_line_wrap_columns(int p_line) const {
+	return text[p_line].wrap_columns_cache;
 }
 
 int TextEdit::Text::get_line_wrap_amount(int p_line) const {
 	ERR_FAIL_INDEX_V(p_line, text.size(), -1);
 
-	return text[p_line].wrap_amount_cache;
+	// -1 when the wrap has not been computed yet.
+	return text[p_line].wrap_columns_cache.size() - 1;
+}
+
+void TextEdit::Text::clear_line_wrap_cache(int p_line) const {
+	ERR_FAIL_INDEX(p_line, text.size());
+
+	text.write[p_line].wrap_columns_cache.clear();
 }
 
 void TextEdit::Text::clear_width_cache() {
@@ -161,7 +172,7 @@ void TextEdit::Text::clear_width_cache() {
 
 void TextEdit::Text::clear_wrap_cache() {
 	for (int i = 0; i < text.size(); i++) {
-		text.write[i].wrap_amount_cache = -1;
+		text.write[i].wrap_columns_cache.clear();
 	}
 }
 
@@ -192,7 +203,7 @@ void TextEdit::Text::set(int p_line, const String &p_text) {
 	ERR_FAIL_INDEX(p_line, text.size());
 
 	text.write[p_line].width_cache = -1;
-	text.write[p_line].wrap_amount_cache = -1;
+	text.write[p_line].wrap_columns_cache.clear();
 	text.write[p_line].data = p_text;
 }
 
@@ -205,7 +216,6 @@ void TextEdit::Text::insert(int p_at, const String &p_text) {
 	line.hidden = false;
 	line.has_info = false;
 	line.width_cache = -1;
-	line.wrap_amount_cache = -1;
 	line.data = p_text;
 	text.insert(p_at, line);
 }
@@ -491,7 +501,7 @@ void TextEdit::_notification(int p_what) {
 			if (text_changed_dirty) {
 				MessageQueue::get_singleton()->push_call(this, "_text_changed_emit");
 			}
-			_update_wrap_at();
+			_update_wrap_at(true);
 		} break;
 		case NOTIFICATION_RESIZED: {
 			_update_scrollbars();
@@ -505,7 +515,7 @@ void TextEdit::_notification(int p_what) {
 		} break;
 		case NOTIFICATION_THEME_CHANGED: {
 			_update_caches();
-			_update_wrap_at();
+			_update_wrap_at(true);
 		} break;
 		case NOTIFICATION_WM_WINDOW_FOCUS_IN: {
 			window_has_focus = true;
@@ -517,6 +527,11 @@ void TextEdit::_notification(int p_what) {
 			draw_caret = false;
 			update();
 		} break;
+		case NOTIFICATION_INTERNAL_PROCESS: {
+			if (rewrap_line != -1) {
+				_rewrap_step();
+			}
+		} break;
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
 			if (scrolling && get_v_scroll() != target_v_scroll) {
 				double target_y = target_v_scroll - get_v_scroll();
@@ -3826,7 +3841,7 @@ void TextEdit::_base_insert_text(int p_line, int p_char, const String &p_text, i
 		text.set_info_icon(p_line, nullptr, "");
 	}
 
-	text.set_line_wrap_amount(p_line, -1);
+	text.clear_line_wrap_cache(p_line);
 
 	r_end_line = p_line + substrings.size() - 1;
 	r_end_column = text[r_end_line].length() - postinsert_text.length();
@@ -3892,7 +3907,7 @@ void TextEdit::_base_remove_text(int p_from_line, int p_from_column, int p_to_li
 	}
 	text.set(p_from_line, pre_text + post_text);
 
-	text.set_line_wrap_amount(p_from_line, -1);
+	text.clear_line_wrap_cache(p_from_line);
 
 	if (!text_changed_dirty && !setting_text) {
 		if (is_inside_tree()) {
@@ -4087,25 +4102,50 @@ int TextEdit::get_total_visible_rows() const {
 	for (int i = 0; i < text.size(); i++) {
 		if (!text.is_hidden(i)) {
 			total_rows++;
-			total_rows += times_line_wraps(i);
+			total_rows += _get_line_wraps_estimate(i);
 		}
 	}
 	return total_rows;
 }
 
-void TextEdit::_update_wrap_at() {
-	wrap_at = get_size().width - cache.style_normal->get_minimum_size().width - cache.line_number_w - cache.breakpoint_gutter_width - cache.fold_gutter_width - cache.info_gutter_width - cache.minimap_width - wrap_right_offset;
-	update_cursor_wrap_offset();
+void TextEdit::_update_wrap_at(bool p_force) {
+	int new_wrap_at = get_size().width - cache.style_normal->get_minimum_size().width - cache.line_number_w - cache.breakpoint_gutter_width - cache.fold_gutter_width - cache.info_gutter_width - cache.minimap_width - wrap_right_offset;
+	if (!p_force && new_wrap_at == wrap_at) {
+		// Cached wraps are still valid.
+		return;
+	}
+
+	wrap_at = new_wrap_at;
 	text.clear_wrap_cache();
 
-	for (int i = 0; i < text.size(); i++) {
-		// Update all values that wrap.
-		if (!line_wraps(i)) {
-			continue;
+	if (is_wrap_enabled()) {
+		// Visible lines are wrapped on demand when drawn; the rest of the document
+		// is re-wrapped over the next frames so resizing stays responsive on long files.
+		// Until then, scrolling estimates the row count of lines not yet wrapped.
+		rewrap_line = 0;
+		set_process_internal(true);
+	}
+	update_cursor_wrap_offset();
+}
+
+void TextEdit::_rewrap_step() {
+	const uint64_t budget_usec = 2000;
+	uint64_t start = OS::get_singleton()->get_ticks_usec();
+
+	while (rewrap_line < text.size()) {
+		times_line_wraps(rewrap_line);
+		rewrap_line++;
+		if ((rewrap_line & 63) == 0 && OS::get_singleton()->get_ticks_usec() - start > budget_usec) {
+			return;
 		}
-		Vector<String> rows = get_wrap_rows_text(i);
-		text.set_line_wrap_amount(i, rows.size() - 1);
 	}
+
+	rewrap_line = -1;
+	set_process_internal(false);
+
+	// Row counts are exact now; keep the same line at the top of the view.
+	_update_scrollbars();
+	set_line_as_first_visible(cursor.line_ofs, cursor.wrap_ofs);
 }
 
 void TextEdit::adjust_viewport_to_cursor() {
@@ -4216,31 +4256,42 @@ int TextEdit::times_line_wraps(int line) const {
 	int wrap_amount = text.get_line_wrap_amount(line);
 	if (wrap_amount == -1) {
 		// Update the value.
-		Vector<String> rows = get_wrap_rows_text(line);
-		wrap_amount = rows.size() - 1;
-		text.set_line_wrap_amount(line, wrap_amount);
+		wrap_amount = _get_wrap_columns(line).size() - 1;
 	}
 
 	return wrap_amount;
 }
 
-Vector<String> TextEdit::get_wrap_rows_text(int p_line) const {
-	ERR_FAIL_INDEX_V(p_line, text.size(), Vector<String>());
+int TextEdit::_get_line_wraps_estimate(int p_line) const {
+	if (rewrap_line == -1 || !line_wraps(p_line)) {
+		return times_line_wraps(p_line);
+	}
 
-	Vector<String> lines;
-	if (!line_wraps(p_line)) {
-		lines.push_back(text[p_line]);
-		return lines;
+	int wrap_amount = text.get_line_wrap_amount(p_line);
+	if (wrap_amount == -1) {
+		// Not re-wrapped yet, assume the rows are filled up to wrap_at.
+		wrap_amount = text.get_line_width(p_line) / MAX(wrap_at, 1);
 	}
+	return wrap_amount;
+}
+
+Vector<int> TextEdit::_get_wrap_columns(int p_line) const {
+	ERR_FAIL_INDEX_V(p_line, text.size(), Vector<int>());
+
+	const Vector<int> &cached = text.get_line_wrap_columns(p_line);
+	if (!cached.empty()) {
+		return cached;
+	}
+
+	Vector<int> columns;
+	columns.push_back(0);
 
 	int px = 0;
 	int col = 0;
-	String line_text = text[p_line];
-	String wrap_substring = "";
+	const String &line_text = text[p_line];
 
 	int word_px = 0;
-	String word_str = "";
-	int cur_wrap_index = 0;
+	int word_len = 0;
 
 	int tab_offset_px = get_indent_level(p_line) * cache.font->get_char_size(' ').width;
 	if (tab_offset_px >= wrap_at) {
@@ -4251,47 +4302,55 @@ Vector<String> TextEdit::get_wrap_rows_text(int p_line) const {
 		CharType c = line_text[col];
 		int w = text.get_char_width(c, line_text[col + 1], px + word_px);
 
-		int indent_ofs = (cur_wrap_index != 0 ? tab_offset_px : 0);
+		int indent_ofs = (columns.size() > 1 ? tab_offset_px : 0);
 
 		if (indent_ofs + word_px + w > wrap_at) {
-			// Not enough space to add this char; start next line.
-			wrap_substring += word_str;
-			lines.push_back(wrap_substring);
-			cur_wrap_index++;
-			wrap_substring = "";
+			// Not enough space to add this char; start next row with it.
+			columns.push_back(col);
 			px = 0;
 
-			word_str = "";
-			word_str += c;
+			word_len = 1;
 			word_px = w;
 		} else {
-			word_str += c;
+			word_len++;
 			word_px += w;
 			if (c == ' ') {
-				// End of a word; add this word to the substring.
-				wrap_substring += word_str;
+				// End of a word; add this word to the row.
 				px += word_px;
-				word_str = "";
+				word_len = 0;
 				word_px = 0;
 			}
 
 			if (indent_ofs + px + word_px > wrap_at) {
-				// This word will be moved to the next line.
-				lines.push_back(wrap_substring);
-				// Reset for next wrap.
-				cur_wrap_index++;
-				wrap_substring = "";
+				// This word will be moved to the next row.
+				columns.push_back(col + 1 - word_len);
 				px = 0;
 			}
 		}
 		col++;
 	}
-	// Line ends before hit wrap_at; add this word to the substring.
-	wrap_substring += word_str;
-	lines.push_back(wrap_substring);
 
-	// Update cache.
-	text.set_line_wrap_amount(p_line, lines.size() - 1);
+	text.set_line_wrap_columns(p_line, columns);
+
+	return columns;
+}
+
+Vector<String> TextEdit::get_wrap_rows_text(int p_line) const {
+	ERR_FAIL_INDEX_V(p_line, text.size(), Vector<String>());
+
+	Vector<String> lines;
+	if (!line_wraps(p_line)) {
+		lines.push_back(text[p_line]);
+		return lines;
+	}
+
+	const String &line_text = text[p_line];
+	Vector<int> columns = _get_wrap_columns(p_line);
+	lines.resize(columns.size());
+	for (int i = 0; i < columns.size(); i++) {
+		int end = i + 1 < columns.size() ? columns[i + 1] : line_text.length();
+		lines.write[i] = line_text.substr(columns[i], end - columns[i]);
+	}
 
 	return lines;
 }
@@ -4309,13 +4368,11 @@ int TextEdit::get_line_wrap_index_at_col(int p_line, int p_column) const {
 
 	// Loop through wraps in the line text until we get to the column.
 	int wrap_index = 0;
-	int col = 0;
-	Vector<String> rows = get_wrap_rows_text(p_line);
-	for (int i = 0; i < rows.size(); i++) {
+	Vector<int> columns = _get_wrap_columns(p_line);
+	for (int i = 0; i < columns.size(); i++) {
 		wrap_index = i;
-		String s = rows[wrap_index];
-		col += s.length();
-		if (col > p_column) {
+		int end = i + 1 < columns.size() ? columns[i + 1] : text[p_line].length();
+		if (end > p_column) {
 			break;
 		}
 	}
@@ -4477,16 +4534,15 @@ void TextEdit::_scroll_moved(double p_to_val) {
 		for (n_line = 0; n_line < text.size(); n_line++) {
 			if (!is_line_hidden(n_line)) {
 				sc++;
-				sc += times_line_wraps(n_line);
+				sc += _get_line_wraps_estimate(n_line);
 				if (sc > v_scroll_i) {
 					break;
 				}
 			}
 		}
 		n_line = MIN(n_line, text.size() - 1);
-		int line_wrap_amount = times_line_wraps(n_line);
-		int wi = line_wrap_amount - (sc - v_scroll_i - 1);
-		wi = CLAMP(wi, 0, line_wrap_amount);
+		int wi = _get_line_wraps_estimate(n_line) - (sc - v_scroll_i - 1);
+		wi = CLAMP(wi, 0, times_line_wraps(n_line));
 
 		cursor.line_ofs = n_line;
 		cursor.wrap_ofs = wi;
@@ -5996,7 +6052,7 @@ double TextEdit::get_scroll_pos_for_line(int p_line, int p_wrap_index) const {
 	for (int i = 0; i < to; i++) {
 		if (!text.is_hidden(i)) {
 			new_line_scroll_pos++;
-			new_line_scroll_pos += times_line_wraps(i);
+			new_line_scroll_pos += _get_line_wraps_estimate(i);
 		}
 	}
 	new_line_scroll_pos += p_wrap_index;
@@ -6719,7 +6775,7 @@ void TextEdit::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("_gui_input"), &TextEdit::_gui_input);
 	ClassDB::bind_method(D_METHOD("_cursor_changed_emit"), &TextEdit::_cursor_changed_emit);
 	ClassDB::bind_method(D_METHOD("_text_changed_emit"), &TextEdit::_text_changed_emit);
-	ClassDB::bind_method(D_METHOD("_update_wrap_at"), &TextEdit::_update_wrap_at);
+	ClassDB::bind_method(D_METHOD("_update_wrap_at", "force"), &TextEdit::_update_wrap_at, DEFVAL(false));
 
 	BIND_ENUM_CONSTANT(SEARCH_MATCH_CASE);
 	BIND_ENUM_CONSTANT(SEARCH_WHOLE_WORDS);
@@ -6909,6 +6965,7 @@ TextEdit::TextEdit() {
 	wrap_enabled = false;
 	wrap_at = 0;
 	wrap_right_offset = 10;
+	rewrap_line = -1;
 	set_focus_mode(FOCUS_ALL);
 	_update_caches();
 	cache.row_height = 1;
@@ -37,6 +37,10 @@
 #include "scene/main/timer.h"
 #include "scene/resources/syntax_highlighter.h"
 
+namespace TestTextEdit {
+class WrapRows;
+}
+
 class TextEdit : public Control {
 	GDCLASS(TextEdit, Control);
 
@@ -51,7 +55,7 @@ public:
 			bool hidden : 1;
 			bool safe : 1;
 			bool has_info : 1;
-			int wrap_amount_cache : 24;
+			Vector<int> wrap_columns_cache; // Start column of each wrapped row, empty when not computed.
 			Ref<Texture2D> info_icon;
 			String info;
 			String data;
@@ -63,7 +67,6 @@ public:
 				hidden = false;
 				safe = false;
 				has_info = false;
-				wrap_amount_cache = 0;
 			}
 		};
 
@@ -80,8 +83,10 @@ public:
 		int get_line_width(int p_line) const;
 		int get_max_width(bool p_exclude_hidden = false) const;
 		int get_char_width(CharType c, CharType next_c, int px) const;
-		void set_line_wrap_amount(int p_line, int p_wrap_amount) const;
+		void set_line_wrap_columns(int p_line, const Vector<int> &p_columns) const;
+		const Vector<int> &get_line_wrap_columns(int p_line) const;
 		int get_line_wrap_amount(int p_line) const;
+		void clear_line_wrap_cache(int p_line) const;
 		void set(int p_line, const String &p_text);
 		void set_marked(int p_line, bool p_marked) { text.write[p_line].marked = p_marked; }
 		bool is_marked(int p_line) const { return text[p_line].marked; }
@@ -309,6 +314,7 @@ private:
 	bool wrap_enabled;
 	int wrap_at;
 	int wrap_right_offset;
+	int rewrap_line; // Next line to re-wrap in the background after a resize, -1 when idle.
 
 	bool first_draw;
 	bool setting_row;
@@ -396,10 +402,15 @@ private:
 	int _get_minimap_visible_rows() const;
 
 	void update_cursor_wrap_offset();
-	void _update_wrap_at();
+	void _update_wrap_at(bool p_force = false);
+	void _rewrap_step();
+
+	friend class TestTextEdit::WrapRows; // Checks the wrapped rows in tests.
 	bool line_wraps(int line) const;
 	int times_line_wraps(int line) const;
+	int _get_line_wraps_estimate(int p_line) const;
 	Vector<String> get_wrap_rows_text(int p_line) const;
+	Vector<int> _get_wrap_columns(int p_line) const;
 	int get_cursor_wrap_index() const;
 	int get_line_wrap_index_at_col(int p_line, int p_column) const;
 	int get_char_count();
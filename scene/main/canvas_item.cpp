@@ -621,8 +621,13 @@ void CanvasItem::_notification(int p_what) {
 			}
 			global_invalid = true;
 		} break;
-		case NOTIFICATION_DRAW:
+		case NOTIFICATION_DRAW: {
+		} break;
 		case NOTIFICATION_TRANSFORM_CHANGED: {
+			// Resolve the global transform now, _notify_transform() relies on notified items being valid.
+			if (is_inside_tree()) {
+				get_global_transform();
+			}
 		} break;
 		case NOTIFICATION_VISIBILITY_CHANGED: {
 			emit_signal(SceneStringNames::get_singleton()->visibility_changed);
@@ -951,7 +956,7 @@ void CanvasItem::_notify_transform(CanvasItem *p_node) {
 	 * notification anyway).
 	 */
 
-	if (/*p_node->xform_change.in_list() &&*/ p_node->global_invalid) {
+	if (p_node->global_invalid && (!p_node->notify_transform || p_node->block_transform_notify || p_node->xform_change.in_list())) {
 		return; //nothing to do
 	}
 
@@ -960,7 +965,7 @@ void CanvasItem::_notify_transform(CanvasItem *p_node) {
 	if (p_node->notify_transform && !p_node->xform_change.in_list()) {
 		if (!p_node->block_transform_notify) {
 			if (p_node->is_inside_tree()) {
-				get_tree()->xform_change_list.add(&p_node->xform_change);
+				get_tree()->_add_xform_change(&p_node->xform_change);
 			}
 		}
 	}
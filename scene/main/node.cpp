@@ -211,6 +211,19 @@ void Node::_propagate_enter_tree() {
 		E->get().group = data.tree->add_to_group(E->key(), this);
 	}
 
+	if (data.idle_process) {
+		data.tree->_add_to_process_list(this, SceneTree::PROCESS_LIST_IDLE);
+	}
+	if (data.idle_process_internal) {
+		data.tree->_add_to_process_list(this, SceneTree::PROCESS_LIST_IDLE_INTERNAL);
+	}
+	if (data.physics_process) {
+		data.tree->_add_to_process_list(this, SceneTree::PROCESS_LIST_PHYSICS);
+	}
+	if (data.physics_process_internal) {
+		data.tree->_add_to_process_list(this, SceneTree::PROCESS_LIST_PHYSICS_INTERNAL);
+	}
+
 	notification(NOTIFICATION_ENTER_TREE);
 
 	if (get_script_instance()) {
@@ -278,6 +291,10 @@ void Node::_propagate_exit_tree() {
 		E->get().group = nullptr;
 	}
 
+	for (int i = 0; i < SceneTree::PROCESS_LIST_MAX; i++) {
+		data.tree->_remove_from_process_list(this, SceneTree::ProcessListType(i));
+	}
+
 	data.viewport = nullptr;
 
 	if (data.tree) {
@@ -292,6 +309,10 @@ void Node::_propagate_exit_tree() {
 
 void Node::move_child(Node *p_child, int p_pos) {
 	ERR_FAIL_NULL(p_child);
+	if (data.tree && data.tree->_is_thread_group_call()) {
+		call_deferred("move_child", p_child, p_pos);
+		return;
+	}
 	ERR_FAIL_INDEX_MSG(p_pos, data.children.size() + 1, "Invalid new child position: " + itos(p_pos) + ".");
 	ERR_FAIL_COND_MSG(p_child->data.parent != this, "Child is not a child of this node.");
 	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy setting up children, move_child() failed. Consider using call_deferred(\"move_child\") instead (or \"popup\" if this is from a popup).");
@@ -331,6 +352,9 @@ void Node::move_child(Node *p_child, int p_pos) {
 			E->get().group->changed = true;
 		}
 	}
+	if (data.tree) {
+		data.tree->_make_process_lists_unsorted(p_child);
+	}
 
 	data.blocked--;
 }
@@ -360,6 +384,11 @@ void Node::set_physics_process(bool p_process) {
 		return;
 	}
 
+	if (data.tree && data.tree->_is_thread_group_call()) {
+		call_deferred("set_physics_process", p_process);
+		return;
+	}
+
 	data.physics_process = p_process;
 
 	if (data.physics_process) {
@@ -368,6 +397,14 @@ void Node::set_physics_process(bool p_process) {
 		remove_from_group("physics_process");
 	}
 
+	if (is_inside_tree()) {
+		if (data.physics_process) {
+			data.tree->_add_to_process_list(this, SceneTree::PROCESS_LIST_PHYSICS);
+		} else {
+			data.tree->_remove_from_process_list(this, SceneTree::PROCESS_LIST_PHYSICS);
+		}
+	}
+
 	_change_notify("physics_process");
 }
 
@@ -380,6 +417,11 @@ void Node::set_physics_process_internal(bool p_process_internal) {
 		return;
 	}
 
+	if (data.tree && data.tree->_is_thread_group_call()) {
+		call_deferred("set_physics_process_internal", p_process_internal);
+		return;
+	}
+
 	data.physics_process_internal = p_process_internal;
 
 	if (data.physics_process_internal) {
@@ -388,6 +430,14 @@ void Node::set_physics_process_internal(bool p_process_internal) {
 		remove_from_group("physics_process_internal");
 	}
 
+	if (is_inside_tree()) {
+		if (data.physics_process_internal) {
+			data.tree->_add_to_process_list(this, SceneTree::PROCESS_LIST_PHYSICS_INTERNAL);
+		} else {
+			data.tree->_remove_from_process_list(this, SceneTree::PROCESS_LIST_PHYSICS_INTERNAL);
+		}
+	}
+
 	_change_notify("physics_process_internal");
 }
 
@@ -405,6 +455,7 @@ void Node::set_pause_mode(PauseMode p_mode) {
 	if (!is_inside_tree()) {
 		return; //pointless
 	}
+	data.tree->_invalidate_process_pause_state(this);
 	if ((data.pause_mode == PAUSE_MODE_INHERIT) == prev_inherits) {
 		return; ///nothing changed
 	}
@@ -856,6 +907,11 @@ void Node::set_process(bool p_idle_process) {
 		return;
 	}
 
+	if (data.tree && data.tree->_is_thread_group_call()) {
+		call_deferred("set_process", p_idle_process);
+		return;
+	}
+
 	data.idle_process = p_idle_process;
 
 	if (data.idle_process) {
@@ -864,6 +920,14 @@ void Node::set_process(bool p_idle_process) {
 		remove_from_group("idle_process");
 	}
 
+	if (is_inside_tree()) {
+		if (data.idle_process) {
+			data.tree->_add_to_process_list(this, SceneTree::PROCESS_LIST_IDLE);
+		} else {
+			data.tree->_remove_from_process_list(this, SceneTree::PROCESS_LIST_IDLE);
+		}
+	}
+
 	_change_notify("idle_process");
 }
 
@@ -876,6 +940,11 @@ void Node::set_process_internal(bool p_idle_process_internal) {
 		return;
 	}
 
+	if (data.tree && data.tree->_is_thread_group_call()) {
+		call_deferred("set_process_internal", p_idle_process_internal);
+		return;
+	}
+
 	data.idle_process_internal = p_idle_process_internal;
 
 	if (data.idle_process_internal) {
@@ -884,6 +953,14 @@ void Node::set_process_internal(bool p_idle_process_internal) {
 		remove_from_group("idle_process_internal");
 	}
 
+	if (is_inside_tree()) {
+		if (data.idle_process_internal) {
+			data.tree->_add_to_process_list(this, SceneTree::PROCESS_LIST_IDLE_INTERNAL);
+		} else {
+			data.tree->_remove_from_process_list(this, SceneTree::PROCESS_LIST_IDLE_INTERNAL);
+		}
+	}
+
 	_change_notify("idle_process_internal");
 }
 
@@ -892,6 +969,11 @@ bool Node::is_processing_internal() const {
 }
 
 void Node::set_process_priority(int p_priority) {
+	if (data.tree && data.tree->_is_thread_group_call()) {
+		call_deferred("set_process_priority", p_priority);
+		return;
+	}
+
 	data.process_priority = p_priority;
 
 	// Make sure we are in SceneTree.
@@ -899,25 +981,24 @@ void Node::set_process_priority(int p_priority) {
 		return;
 	}
 
-	if (is_processing()) {
-		data.tree->make_group_changed("idle_process");
-	}
-
-	if (is_processing_internal()) {
-		data.tree->make_group_changed("idle_process_internal");
-	}
+	data.tree->_make_process_lists_unsorted(this);
+}
 
-	if (is_physics_processing()) {
-		data.tree->make_group_changed("physics_process");
-	}
+int Node::get_process_priority() const {
+	return data.process_priority;
+}
 
-	if (is_physics_processing_internal()) {
-		data.tree->make_group_changed("physics_process_internal");
+void Node::set_process_thread_group(int p_group) {
+	ERR_FAIL_COND_MSG(p_group < 0, "Process thread groups must be positive, or 0 to process on the main thread.");
+	if (data.tree && data.tree->_is_thread_group_call()) {
+		call_deferred("set_process_thread_group", p_group);
+		return;
 	}
+	data.process_thread_group = p_group;
 }
 
-int Node::get_process_priority() const {
-	return data.process_priority;
+int Node::get_process_thread_group() const {
+	return data.process_thread_group;
 }
 
 void Node::set_process_input(bool p_enable) {
@@ -1225,6 +1306,10 @@ void Node::add_child(Node *p_child, bool p_legible_unique_name) {
 	ERR_FAIL_COND_MSG(p_child == this, "Can't add child '" + p_child->get_name() + "' to itself."); // adding to itself!
 	ERR_FAIL_COND_MSG(p_child->data.parent, "Can't add child '" + p_child->get_name() + "' to '" + get_name() + "', already has a parent '" + p_child->data.parent->get_name() + "'."); //Fail if node has a parent
 	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy setting up children, add_node() failed. Consider using call_deferred(\"add_child\", child) instead.");
+	if (data.tree && data.tree->_is_thread_group_call()) {
+		call_deferred("add_child", p_child, p_legible_unique_name);
+		return;
+	}
 
 	/* Validate name */
 	_validate_child_name(p_child, p_legible_unique_name);
@@ -1268,6 +1353,10 @@ void Node::_propagate_validate_owner() {
 
 void Node::remove_child(Node *p_child) {
 	ERR_FAIL_NULL(p_child);
+	if (data.tree && data.tree->_is_thread_group_call()) {
+		call_deferred("remove_child", p_child);
+		return;
+	}
 	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy setting up children, remove_node() failed. Consider using call_deferred(\"remove_child\", child) instead.");
 
 	int child_count = data.children.size();
@@ -1695,6 +1784,10 @@ bool Node::is_in_group(const StringName &p_identifier) const {
 
 void Node::add_to_group(const StringName &p_identifier, bool p_persistent) {
 	ERR_FAIL_COND(!p_identifier.operator String().length());
+	if (data.tree && data.tree->_is_thread_group_call()) {
+		call_deferred("add_to_group", p_identifier, p_persistent);
+		return;
+	}
 
 	if (data.grouped.has(p_identifier)) {
 		return;
@@ -1714,6 +1807,10 @@ void Node::add_to_group(const StringName &p_identifier, bool p_persistent) {
 }
 
 void Node::remove_from_group(const StringName &p_identifier) {
+	if (data.tree && data.tree->_is_thread_group_call()) {
+		call_deferred("remove_from_group", p_identifier);
+		return;
+	}
 	ERR_FAIL_COND(!data.grouped.has(p_identifier));
 
 	Map<StringName, GroupData>::Element *E = data.grouped.find(p_identifier);
@@ -2606,6 +2703,10 @@ void Node::print_stray_nodes() {
 }
 
 void Node::queue_delete() {
+	if (data.tree && data.tree->_is_thread_group_call()) {
+		call_deferred("queue_free");
+		return;
+	}
 	if (is_inside_tree()) {
 		get_tree()->queue_delete(this);
 	} else {
@@ -2757,6 +2858,8 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_process", "enable"), &Node::set_process);
 	ClassDB::bind_method(D_METHOD("set_process_priority", "priority"), &Node::set_process_priority);
 	ClassDB::bind_method(D_METHOD("get_process_priority"), &Node::get_process_priority);
+	ClassDB::bind_method(D_METHOD("set_process_thread_group", "group"), &Node::set_process_thread_group);
+	ClassDB::bind_method(D_METHOD("get_process_thread_group"), &Node::get_process_thread_group);
 	ClassDB::bind_method(D_METHOD("is_processing"), &Node::is_processing);
 	ClassDB::bind_method(D_METHOD("set_process_input", "enable"), &Node::set_process_input);
 	ClassDB::bind_method(D_METHOD("is_processing_input"), &Node::is_processing_input);
@@ -2894,6 +2997,7 @@ void Node::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "multiplayer", PROPERTY_HINT_RESOURCE_TYPE, "MultiplayerAPI", 0), "", "get_multiplayer");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "custom_multiplayer", PROPERTY_HINT_RESOURCE_TYPE, "MultiplayerAPI", 0), "set_custom_multiplayer", "get_custom_multiplayer");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_priority"), "set_process_priority", "get_process_priority");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group", PROPERTY_HINT_RANGE, "0,1024,1,or_greater"), "set_process_thread_group", "get_process_thread_group");
 
 	BIND_VMETHOD(MethodInfo("_process", PropertyInfo(Variant::FLOAT, "delta")));
 	BIND_VMETHOD(MethodInfo("_physics_process", PropertyInfo(Variant::FLOAT, "delta")));
@@ -2929,6 +3033,10 @@ Node::Node() {
 	data.physics_process = false;
 	data.idle_process = false;
 	data.process_priority = 0;
+	data.process_thread_group = 0;
+	for (int i = 0; i < SceneTree::PROCESS_LIST_MAX; i++) {
+		data.process_list_index[i] = -1;
+	}
 	data.physics_process_internal = false;
 	data.idle_process_internal = false;
 	data.inside_tree = false;
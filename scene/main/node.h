@@ -127,6 +127,8 @@ private:
 		bool physics_process;
 		bool idle_process;
 		int process_priority;
+		int process_thread_group;
+		int process_list_index[SceneTree::PROCESS_LIST_MAX]; // Slot in each SceneTree process list, -1 if not listed.
 
 		bool physics_process_internal;
 		bool idle_process_internal;
@@ -357,6 +359,9 @@ public:
 	void set_process_priority(int p_priority);
 	int get_process_priority() const;
 
+	void set_process_thread_group(int p_group);
+	int get_process_thread_group() const;
+
 	void set_process_input(bool p_enable);
 	bool is_processing_input() const;
 
@@ -408,8 +408,9 @@ bool SceneTree::iteration(float p_time) {
 
 	emit_signal("physics_frame");
 
-	_notify_group_pause("physics_process_internal", Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
-	_notify_group_pause("physics_process", Node::NOTIFICATION_PHYSICS_PROCESS);
+	_notify_process_list(PROCESS_LIST_PHYSICS_INTERNAL, Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
+	_call_internal_process_callbacks();
+	_notify_process_list(PROCESS_LIST_PHYSICS, Node::NOTIFICATION_PHYSICS_PROCESS);
 	_flush_ugc();
 	MessageQueue::get_singleton()->flush(); //small little hack
 	flush_transform_notifications();
@@ -443,8 +444,9 @@ bool SceneTree::idle(float p_time) {
 
 	flush_transform_notifications();
 
-	_notify_group_pause("idle_process_internal", Node::NOTIFICATION_INTERNAL_PROCESS);
-	_notify_group_pause("idle_process", Node::NOTIFICATION_PROCESS);
+	_notify_process_list(PROCESS_LIST_IDLE_INTERNAL, Node::NOTIFICATION_INTERNAL_PROCESS);
+	_call_internal_process_callbacks();
+	_notify_process_list(PROCESS_LIST_IDLE, Node::NOTIFICATION_PROCESS);
 
 	_flush_ugc();
 	MessageQueue::get_singleton()->flush(); //small little hack
@@ -781,47 +783,190 @@ bool SceneTree::is_paused() const {
 	return pause;
 }
 
-void SceneTree::_notify_group_pause(const StringName &p_group, int p_notification) {
-	Map<StringName, Group>::Element *E = group_map.find(p_group);
-	if (!E) {
+void SceneTree::_add_to_process_list(Node *p_node, ProcessListType p_list) {
+	int &index = p_node->data.process_list_index[p_list];
+	if (index != -1) {
 		return;
 	}
-	Group &g = E->get();
-	if (g.nodes.empty()) {
+
+	ProcessList &list = process_lists[p_list];
+	if (list.sorted && list.entries.size()) {
+		//nodes added after the last one in processing order (e.g. new children of the same parent) don't need a sort
+		Node *last = list.entries[list.entries.size() - 1].node;
+		if (!last || !Node::ComparatorWithPriority()(last, p_node)) {
+			list.sorted = false;
+		}
+	}
+
+	index = list.entries.size();
+	ProcessListEntry entry;
+	entry.node = p_node;
+	entry.pause_state = PROCESS_PAUSE_UNRESOLVED;
+	list.entries.push_back(entry);
+}
+
+void SceneTree::_remove_from_process_list(Node *p_node, ProcessListType p_list) {
+	int &index = p_node->data.process_list_index[p_list];
+	if (index == -1) {
 		return;
 	}
 
-	_update_group_order(g, p_notification == Node::NOTIFICATION_PROCESS || p_notification == Node::NOTIFICATION_INTERNAL_PROCESS || p_notification == Node::NOTIFICATION_PHYSICS_PROCESS || p_notification == Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
+	ProcessList &list = process_lists[p_list];
+	list.entries[index].node = nullptr;
+	list.removed++;
+	index = -1;
+}
 
-	//copy, so copy on write happens in case something is removed from process while being called
-	//performance is not lost because only if something is added/removed the vector is copied.
-	Vector<Node *> nodes_copy = g.nodes;
+void SceneTree::_make_process_lists_unsorted(Node *p_node) {
+	for (int i = 0; i < PROCESS_LIST_MAX; i++) {
+		if (p_node->data.process_list_index[i] != -1) {
+			process_lists[i].sorted = false;
+		}
+	}
+}
 
-	int node_count = nodes_copy.size();
-	Node **nodes = nodes_copy.ptrw();
+void SceneTree::_invalidate_process_pause_state(Node *p_node) {
+	for (int i = 0; i < PROCESS_LIST_MAX; i++) {
+		int index = p_node->data.process_list_index[i];
+		if (index != -1) {
+			process_lists[i].entries[index].pause_state = PROCESS_PAUSE_UNRESOLVED;
+		}
+	}
 
-	call_lock++;
+	//inheriting children resolve through the pause owner, which may be this node or one above it
+	for (int i = 0; i < p_node->data.children.size(); i++) {
+		Node *child = p_node->data.children[i];
+		if (child->data.pause_mode == Node::PAUSE_MODE_INHERIT) {
+			_invalidate_process_pause_state(child);
+		}
+	}
+}
 
-	for (int i = 0; i < node_count; i++) {
-		Node *n = nodes[i];
-		if (call_lock && call_skip.has(n)) {
+bool SceneTree::_can_process_entry(ProcessListEntry &r_entry, int p_notification) {
+	Node *n = r_entry.node;
+	if (!n || !n->can_process_notification(p_notification)) {
+		return false;
+	}
+
+	//every node processes unless paused, so the pause mode is only resolved then
+	if (!pause) {
+		return true;
+	}
+
+	if (r_entry.pause_state == PROCESS_PAUSE_UNRESOLVED) {
+		r_entry.pause_state = n->can_process() ? PROCESS_PAUSE_PROCESS : PROCESS_PAUSE_STOP;
+	}
+	return r_entry.pause_state == PROCESS_PAUSE_PROCESS;
+}
+
+bool SceneTree::ProcessListEntryComparator::operator()(const ProcessListEntry &p_a, const ProcessListEntry &p_b) const {
+	return Node::ComparatorWithPriority()(p_a.node, p_b.node);
+}
+
+void SceneTree::_update_process_list(ProcessList &r_list, ProcessListType p_type) {
+	if (r_list.removed) {
+		uint32_t to = 0;
+		for (uint32_t i = 0; i < r_list.entries.size(); i++) {
+			Node *n = r_list.entries[i].node;
+			if (n) {
+				n->data.process_list_index[p_type] = to;
+				r_list.entries[to++] = r_list.entries[i];
+			}
+		}
+		r_list.entries.resize(to);
+		r_list.removed = 0;
+	}
+
+	if (!r_list.sorted) {
+		SortArray<ProcessListEntry, ProcessListEntryComparator> entry_sort;
+		entry_sort.sort(r_list.entries.ptr(), r_list.entries.size());
+		for (uint32_t i = 0; i < r_list.entries.size(); i++) {
+			r_list.entries[i].node->data.process_list_index[p_type] = i;
+		}
+		r_list.sorted = true;
+	}
+}
+
+void SceneTree::_notify_process_list(ProcessListType p_list, int p_notification) {
+	ProcessList &list = process_lists[p_list];
+	_update_process_list(list, p_list);
+
+	//nodes added while processing wait for the next pass, removed ones leave a null slot behind
+	uint32_t entry_count = list.entries.size();
+	if (entry_count == 0) {
+		return;
+	}
+
+	//process thread groups run first, then the remaining nodes on the main thread
+	bool threaded = _process_thread_groups(list, entry_count, p_notification);
+
+	for (uint32_t i = 0; i < entry_count; i++) {
+		ProcessListEntry &entry = list.entries[i];
+		if (threaded && entry.node && entry.node->data.process_thread_group != 0) {
 			continue;
 		}
 
-		if (!n->can_process()) {
+		if (!_can_process_entry(entry, p_notification)) {
+			continue;
+		}
+
+		entry.node->notification(p_notification);
+	}
+}
+
+bool SceneTree::_process_thread_groups(ProcessList &r_list, uint32_t p_count, int p_notification) {
+	if (process_thread_group_count) {
+		process_thread_group_indices.clear();
+		process_thread_group_count = 0;
+	}
+
+	//nodes arrive sorted by priority, so each group keeps that order
+	for (uint32_t i = 0; i < p_count; i++) {
+		ProcessListEntry &entry = r_list.entries[i];
+		if (!entry.node || entry.node->data.process_thread_group == 0) {
 			continue;
 		}
-		if (!n->can_process_notification(p_notification)) {
+		if (!_can_process_entry(entry, p_notification)) {
 			continue;
 		}
 
-		n->notification(p_notification);
-		//ERR_FAIL_COND(node_count != g.nodes.size());
+		Node *n = entry.node;
+		int group = n->data.process_thread_group;
+		uint32_t index;
+		if (!process_thread_group_indices.lookup(group, index)) {
+			index = process_thread_group_count++;
+			if (index == process_thread_groups.size()) {
+				process_thread_groups.push_back(ProcessThreadGroup());
+			}
+			process_thread_groups[index].nodes.clear();
+			process_thread_group_indices.insert(group, index);
+		}
+		process_thread_groups[index].nodes.push_back(n);
 	}
 
-	call_lock--;
-	if (call_lock == 0) {
-		call_skip.clear();
+	if (process_thread_group_count == 0) {
+		return false;
+	}
+
+	processing_thread_groups = true;
+	get_process_thread_pool().do_work(process_thread_group_count, this, &SceneTree::_process_thread_group, p_notification);
+	processing_thread_groups = false;
+
+	return true;
+}
+
+ThreadWorkPool &SceneTree::get_process_thread_pool() {
+	if (!process_thread_pool_initialized) {
+		process_thread_pool.init();
+		process_thread_pool_initialized = true;
+	}
+	return process_thread_pool;
+}
+
+void SceneTree::_process_thread_group(uint32_t p_index, int p_notification) {
+	const LocalVector<Node *> &nodes = process_thread_groups[p_index].nodes;
+	for (uint32_t i = 0; i < nodes.size(); i++) {
+		nodes[i]->notification(p_notification);
 	}
 }
 
@@ -1297,6 +1442,20 @@ void SceneTree::add_idle_callback(IdleCallback p_callback) {
 	idle_callbacks[idle_callback_count++] = p_callback;
 }
 
+SceneTree::IdleCallback SceneTree::internal_process_callbacks[SceneTree::MAX_IDLE_CALLBACKS];
+int SceneTree::internal_process_callback_count = 0;
+
+void SceneTree::_call_internal_process_callbacks() {
+	for (int i = 0; i < internal_process_callback_count; i++) {
+		internal_process_callbacks[i]();
+	}
+}
+
+void SceneTree::add_internal_process_callback(IdleCallback p_callback) {
+	ERR_FAIL_COND(internal_process_callback_count >= MAX_IDLE_CALLBACKS);
+	internal_process_callbacks[internal_process_callback_count++] = p_callback;
+}
+
 void SceneTree::get_argument_options(const StringName &p_function, int p_idx, List<String> *r_options) const {
 	if (p_function == "change_scene") {
 		DirAccessRef dir_access = DirAccess::create(DirAccess::ACCESS_RESOURCES);
@@ -1432,6 +1591,8 @@ SceneTree::SceneTree() {
 }
 
 SceneTree::~SceneTree() {
+	process_thread_pool.finish();
+
 	if (root) {
 		root->_set_tree(nullptr);
 		root->_propagate_after_exit_tree();
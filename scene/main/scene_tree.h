@@ -32,9 +32,13 @@
 #define SCENE_MAIN_LOOP_H
 
 #include "core/io/multiplayer_api.h"
+#include "core/local_vector.h"
+#include "core/oa_hash_map.h"
 #include "core/os/main_loop.h"
+#include "core/os/thread.h"
 #include "core/os/thread_safe.h"
 #include "core/self_list.h"
+#include "core/thread_work_pool.h"
 #include "scene/resources/mesh.h"
 #include "scene/resources/world_2d.h"
 #include "scene/resources/world_3d.h"
@@ -178,7 +182,65 @@ private:
 	void remove_from_group(const StringName &p_group, Node *p_node);
 	void make_group_changed(const StringName &p_group);
 
-	void _notify_group_pause(const StringName &p_group, int p_notification);
+	// Nodes with processing enabled are kept in dense lists, sorted by priority and tree order. Removing a
+	// node only clears its slot, the list is compacted (keeping its order) before the next pass.
+	enum ProcessListType {
+		PROCESS_LIST_IDLE,
+		PROCESS_LIST_IDLE_INTERNAL,
+		PROCESS_LIST_PHYSICS,
+		PROCESS_LIST_PHYSICS_INTERNAL,
+		PROCESS_LIST_MAX
+	};
+
+	// Whether a node processes while the tree is paused is resolved on the first paused pass after it
+	// joins the list, and again after a pause mode change above it. Reparenting re-adds the node.
+	enum ProcessPauseState {
+		PROCESS_PAUSE_UNRESOLVED,
+		PROCESS_PAUSE_STOP,
+		PROCESS_PAUSE_PROCESS,
+	};
+
+	struct ProcessListEntry {
+		Node *node;
+		ProcessPauseState pause_state;
+	};
+
+	struct ProcessListEntryComparator {
+		bool operator()(const ProcessListEntry &p_a, const ProcessListEntry &p_b) const;
+	};
+
+	struct ProcessList {
+		LocalVector<ProcessListEntry> entries;
+		uint32_t removed = 0;
+		bool sorted = true;
+	};
+
+	ProcessList process_lists[PROCESS_LIST_MAX];
+
+	void _add_to_process_list(Node *p_node, ProcessListType p_list);
+	void _remove_from_process_list(Node *p_node, ProcessListType p_list);
+	void _make_process_lists_unsorted(Node *p_node);
+	void _invalidate_process_pause_state(Node *p_node);
+	bool _can_process_entry(ProcessListEntry &r_entry, int p_notification);
+	void _update_process_list(ProcessList &r_list, ProcessListType p_type);
+	void _notify_process_list(ProcessListType p_list, int p_notification);
+
+	// Nodes with a non-zero process thread group have their process notifications sent from worker
+	// threads, one task per group. While these run, tree changes requested from the workers are deferred.
+	struct ProcessThreadGroup {
+		LocalVector<Node *> nodes;
+	};
+
+	LocalVector<ProcessThreadGroup> process_thread_groups;
+	uint32_t process_thread_group_count = 0;
+	OAHashMap<int, uint32_t> process_thread_group_indices;
+	ThreadWorkPool process_thread_pool;
+	bool process_thread_pool_initialized = false;
+	bool processing_thread_groups = false;
+
+	bool _process_thread_groups(ProcessList &r_list, uint32_t p_count, int p_notification);
+	void _process_thread_group(uint32_t p_index, int p_notification);
+	_FORCE_INLINE_ bool _is_thread_group_call() const { return processing_thread_groups && Thread::get_caller_id() != Thread::get_main_id(); }
 	Variant _call_group_flags(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	Variant _call_group(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
@@ -189,6 +251,19 @@ private:
 	friend class Viewport;
 
 	SelfList<Node>::List xform_change_list;
+	Mutex xform_change_mutex;
+
+	_FORCE_INLINE_ void _add_xform_change(SelfList<Node> *p_xform_change) {
+		if (processing_thread_groups) {
+			// Transforms can be set from process thread groups, the list is shared by the whole tree.
+			MutexLock lock(xform_change_mutex);
+			if (!p_xform_change->in_list()) {
+				xform_change_list.add(p_xform_change);
+			}
+		} else {
+			xform_change_list.add(p_xform_change);
+		}
+	}
 
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
@@ -202,6 +277,11 @@ private:
 	static int idle_callback_count;
 	void _call_idle_callbacks();
 
+	// Called once all nodes got their internal process (or internal physics process) notification.
+	static IdleCallback internal_process_callbacks[MAX_IDLE_CALLBACKS];
+	static int internal_process_callback_count;
+	void _call_internal_process_callbacks();
+
 	void _main_window_focus_in();
 	void _main_window_close();
 	void _main_window_go_back();
@@ -345,6 +425,9 @@ public:
 	bool is_refusing_new_network_connections() const;
 
 	static void add_idle_callback(IdleCallback p_callback);
+	static void add_internal_process_callback(IdleCallback p_callback);
+
+	ThreadWorkPool &get_process_thread_pool();
 
 	//default texture settings
 
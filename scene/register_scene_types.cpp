@@ -388,6 +388,8 @@ void register_scene_types() {
 	ClassDB::register_class<Tween>();
 
 	ClassDB::register_class<AnimationTree>();
+	SceneTree::add_internal_process_callback(AnimationTree::flush_evaluations);
+	AnimationTree::init_evaluation();
 	ClassDB::register_class<AnimationNode>();
 	ClassDB::register_class<AnimationRootNode>();
 	ClassDB::register_class<AnimationNodeBlendTree>();
@@ -966,5 +968,6 @@ void unregister_scene_types() {
 
 	ParticlesMaterial::finish_shaders();
 	CanvasItemMaterial::finish_shaders();
+	AnimationTree::finish_evaluation();
 	SceneStringNames::free();
 }
@@ -32,9 +32,12 @@
 #include "scene/scene_string_names.h"
 
 #include "core/math/geometry_3d.h"
+#include "core/safe_refcount.h"
 
 #define ANIM_MIN_LENGTH 0.001
 
+uint32_t Animation::compressed_version_counter = 0;
+
 bool Animation::_set(const StringName &p_name, const Variant &p_value) {
 	String name = p_name;
 
@@ -76,9 +79,19 @@ bool Animation::_set(const StringName &p_name, const Variant &p_value) {
 			track_set_imported(track, p_value);
 		} else if (what == "enabled") {
 			track_set_enabled(track, p_value);
+		} else if (what == "compressed") {
+			ERR_FAIL_COND_V(track_get_type(track) != TYPE_TRANSFORM, false);
+			TransformTrack *tt = static_cast<TransformTrack *>(tracks[track]);
+			tt->transforms.clear();
+			tt->compressed = p_value;
+			if (!_transform_track_build_page_index(tt)) {
+				tt->compressed.clear();
+				ERR_FAIL_V_MSG(false, "Invalid compressed data for transform track " + itos(track) + ".");
+			}
 		} else if (what == "keys" || what == "key_values") {
 			if (track_get_type(track) == TYPE_TRANSFORM) {
 				TransformTrack *tt = static_cast<TransformTrack *>(tracks[track]);
+				_transform_track_decompress(tt);
 				Vector<float> values = p_value;
 				int vcount = values.size();
 				ERR_FAIL_COND_V(vcount % 12, false); // should be multiple of 11
@@ -352,6 +365,9 @@ bool Animation::_get(const StringName &p_name, Variant &r_ret) const {
 			r_ret = track_is_imported(track);
 		} else if (what == "enabled") {
 			r_ret = track_is_enabled(track);
+		} else if (what == "compressed") {
+			ERR_FAIL_COND_V(!track_is_compressed(track), false);
+			r_ret = static_cast<const TransformTrack *>(tracks[track])->compressed;
 		} else if (what == "keys") {
 			if (track_get_type(track) == TYPE_TRANSFORM) {
 				Vector<float> keys;
@@ -578,7 +594,11 @@ void Animation::_get_property_list(List<PropertyInfo> *p_list) const {
 		p_list->push_back(PropertyInfo(Variant::BOOL, "tracks/" + itos(i) + "/loop_wrap", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::BOOL, "tracks/" + itos(i) + "/imported", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::BOOL, "tracks/" + itos(i) + "/enabled", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
-		p_list->push_back(PropertyInfo(Variant::ARRAY, "tracks/" + itos(i) + "/keys", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
+		if (track_is_compressed(i)) {
+			p_list->push_back(PropertyInfo(Variant::PACKED_BYTE_ARRAY, "tracks/" + itos(i) + "/compressed", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
+		} else {
+			p_list->push_back(PropertyInfo(Variant::ARRAY, "tracks/" + itos(i) + "/keys", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NOEDITOR | PROPERTY_USAGE_INTERNAL));
+		}
 	}
 }
 
@@ -780,16 +800,17 @@ Error Animation::transform_track_get_key(int p_track, int p_key, Vector3 *r_loc,
 
 	TransformTrack *tt = static_cast<TransformTrack *>(t);
 	ERR_FAIL_COND_V(t->type != TYPE_TRANSFORM, ERR_INVALID_PARAMETER);
-	ERR_FAIL_INDEX_V(p_key, tt->transforms.size(), ERR_INVALID_PARAMETER);
+	ERR_FAIL_INDEX_V(p_key, track_get_key_count(p_track), ERR_INVALID_PARAMETER);
 
+	TKey<TransformKey> key = _transform_track_get_key(tt, p_key);
 	if (r_loc) {
-		*r_loc = tt->transforms[p_key].value.loc;
+		*r_loc = key.value.loc;
 	}
 	if (r_rot) {
-		*r_rot = tt->transforms[p_key].value.rot;
+		*r_rot = key.value.rot;
 	}
 	if (r_scale) {
-		*r_scale = tt->transforms[p_key].value.scale;
+		*r_scale = key.value.scale;
 	}
 
 	return OK;
@@ -801,6 +822,7 @@ int Animation::transform_track_insert_key(int p_track, float p_time, const Vecto
 	ERR_FAIL_COND_V(t->type != TYPE_TRANSFORM, -1);
 
 	TransformTrack *tt = static_cast<TransformTrack *>(t);
+	_transform_track_decompress(tt);
 
 	TKey<TransformKey> tkey;
 	tkey.time = p_time;
@@ -826,6 +848,7 @@ void Animation::track_remove_key(int p_track, int p_idx) {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			_transform_track_decompress(tt);
 			ERR_FAIL_INDEX(p_idx, tt->transforms.size());
 			tt->transforms.remove(p_idx);
 
@@ -872,6 +895,17 @@ int Animation::track_find_key(int p_track, float p_time, bool p_exact) const {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			if (tt->compressed.size()) {
+				CompressedTransformKeys keys(tt);
+				int k = _find(keys, p_time);
+				if (k < 0 || k >= keys.size()) {
+					return -1;
+				}
+				if (keys.get_time(k) != p_time && p_exact) {
+					return -1;
+				}
+				return k;
+			}
 			int k = _find(tt->transforms, p_time);
 			if (k < 0 || k >= tt->transforms.size()) {
 				return -1;
@@ -1056,6 +1090,9 @@ int Animation::track_get_key_count(int p_track) const {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			if (tt->compressed.size()) {
+				return tt->compressed_key_count;
+			}
 			return tt->transforms.size();
 		} break;
 		case TYPE_VALUE: {
@@ -1091,12 +1128,13 @@ Variant Animation::track_get_key_value(int p_track, int p_key_idx) const {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
-			ERR_FAIL_INDEX_V(p_key_idx, tt->transforms.size(), Variant());
+			ERR_FAIL_INDEX_V(p_key_idx, track_get_key_count(p_track), Variant());
+			TKey<TransformKey> key = _transform_track_get_key(tt, p_key_idx);
 
 			Dictionary d;
-			d["location"] = tt->transforms[p_key_idx].value.loc;
-			d["rotation"] = tt->transforms[p_key_idx].value.rot;
-			d["scale"] = tt->transforms[p_key_idx].value.scale;
+			d["location"] = key.value.loc;
+			d["rotation"] = key.value.rot;
+			d["scale"] = key.value.scale;
 
 			return d;
 		} break;
@@ -1159,7 +1197,10 @@ float Animation::track_get_key_time(int p_track, int p_key_idx) const {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
-			ERR_FAIL_INDEX_V(p_key_idx, tt->transforms.size(), -1);
+			ERR_FAIL_INDEX_V(p_key_idx, track_get_key_count(p_track), -1);
+			if (tt->compressed.size()) {
+				return CompressedTransformKeys(tt).get_time(p_key_idx);
+			}
 			return tt->transforms[p_key_idx].time;
 		} break;
 		case TYPE_VALUE: {
@@ -1204,6 +1245,7 @@ void Animation::track_set_key_time(int p_track, int p_key_idx, float p_time) {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			_transform_track_decompress(tt);
 			ERR_FAIL_INDEX(p_key_idx, tt->transforms.size());
 			TKey<TransformKey> key = tt->transforms[p_key_idx];
 			key.time = p_time;
@@ -1268,8 +1310,8 @@ float Animation::track_get_key_transition(int p_track, int p_key_idx) const {
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
-			ERR_FAIL_INDEX_V(p_key_idx, tt->transforms.size(), -1);
-			return tt->transforms[p_key_idx].transition;
+			ERR_FAIL_INDEX_V(p_key_idx, track_get_key_count(p_track), -1);
+			return _transform_track_get_key(tt, p_key_idx).transition;
 		} break;
 		case TYPE_VALUE: {
 			ValueTrack *vt = static_cast<ValueTrack *>(t);
@@ -1304,6 +1346,7 @@ void Animation::track_set_key_value(int p_track, int p_key_idx, const Variant &p
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			_transform_track_decompress(tt);
 			ERR_FAIL_INDEX(p_key_idx, tt->transforms.size());
 
 			Dictionary d = p_value;
@@ -1387,6 +1430,7 @@ void Animation::track_set_key_transition(int p_track, int p_key_idx, float p_tra
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			TransformTrack *tt = static_cast<TransformTrack *>(t);
+			_transform_track_decompress(tt);
 			ERR_FAIL_INDEX(p_key_idx, tt->transforms.size());
 			tt->transforms.write[p_key_idx].transition = p_transition;
 		} break;
@@ -1450,6 +1494,72 @@ int Animation::_find(const Vector<K> &p_keys, float p_time) const {
 	return middle;
 }
 
+int Animation::_find(const CompressedTransformKeys &p_keys, float p_time) const {
+	const TransformTrack *tt = p_keys.track;
+	int page_count = tt->page_times.size();
+	if (page_count == 0) {
+		return -2;
+	}
+
+	// Try the page of the previous lookup and the one after it before searching.
+	const float *page_times = tt->page_times.ptr();
+	int page = CLAMP(p_keys.cursor->page, 0, page_count - 1);
+	if (p_time < page_times[page] || (page + 1 < page_count && p_time >= page_times[page + 1])) {
+		page++;
+		if (page >= page_count || p_time < page_times[page] || (page + 1 < page_count && p_time >= page_times[page + 1])) {
+			int low = 0;
+			int high = page_count - 1;
+			page = 0;
+			while (low <= high) {
+				int middle = (low + high) / 2;
+				if (page_times[middle] <= p_time) {
+					page = middle;
+					low = middle + 1;
+				} else {
+					high = middle - 1;
+				}
+			}
+		}
+	}
+	p_keys.cursor->page = page;
+
+	const CompressedPage *header = (const CompressedPage *)(tt->compressed.ptr() + tt->page_offsets[page]);
+	const float *times = (const float *)(header + 1);
+	int base = page * COMPRESSED_PAGE_KEYS;
+	int found = -1;
+	int low = 0;
+	int high = header->key_count - 1;
+	while (low <= high) {
+		int middle = (low + high) / 2;
+		if (Math::is_equal_approx(p_time, times[middle])) {
+			return base + middle;
+		} else if (times[middle] <= p_time) {
+			found = middle;
+			low = middle + 1;
+		} else {
+			high = middle - 1;
+		}
+	}
+
+	if (found == int(header->key_count) - 1 && page + 1 < page_count && Math::is_equal_approx(p_time, page_times[page + 1])) {
+		return base + COMPRESSED_PAGE_KEYS; // Matches the first key of the next page.
+	}
+	return found < 0 ? base - 1 : base + found;
+}
+
+int Animation::_find_keys_in_length(const CompressedTransformKeys &p_keys) const {
+	int count = p_keys.size();
+	if (count && p_keys.get_time(count - 1) < length && !Math::is_equal_approx(p_keys.get_time(count - 1), length)) {
+		return count; // The common case, no keys past the end.
+	}
+
+	// Looking up the end of the animation must not move the cursor away from the playback position.
+	int page = p_keys.cursor->page;
+	count = _find(p_keys, length) + 1;
+	p_keys.cursor->page = page;
+	return count;
+}
+
 Animation::TransformKey Animation::_interpolate(const Animation::TransformKey &p_a, const Animation::TransformKey &p_b, float p_c) const {
 	TransformKey ret;
 	ret.loc = _interpolate(p_a.loc, p_b.loc, p_c);
@@ -1584,9 +1694,9 @@ float Animation::_cubic_interpolate(const float &p_pre_a, const float &p_a, cons
 	return _interpolate(p_a, p_b, p_c);
 }
 
-template <class T>
-T Animation::_interpolate(const Vector<TKey<T>> &p_keys, float p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok) const {
-	int len = _find(p_keys, length) + 1; // try to find last key (there may be more past the end)
+template <class T, class C>
+T Animation::_interpolate_keys(const C &p_keys, float p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok) const {
+	int len = _find_keys_in_length(p_keys); // try to find last key (there may be more past the end)
 
 	if (len <= 0) {
 		// (-1 or -2 returned originally) (plus one above)
@@ -1729,7 +1839,7 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, float p_time, Interpola
 	// do a barrel roll
 }
 
-Error Animation::transform_track_interpolate(int p_track, float p_time, Vector3 *r_loc, Quat *r_rot, Vector3 *r_scale) const {
+Error Animation::transform_track_interpolate(int p_track, float p_time, Vector3 *r_loc, Quat *r_rot, Vector3 *r_scale, TransformTrackCursor *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_TRANSFORM, ERR_INVALID_PARAMETER);
@@ -1738,7 +1848,13 @@ Error Animation::transform_track_interpolate(int p_track, float p_time, Vector3
 
 	bool ok = false;
 
-	TransformKey tk = _interpolate(tt->transforms, p_time, tt->interpolation, tt->loop_wrap, &ok);
+	TransformKey tk;
+	if (tt->compressed.size()) {
+		CompressedTransformKeys keys(tt, r_cursor);
+		tk = _interpolate_keys<TransformKey>(keys, p_time, tt->interpolation, tt->loop_wrap, &ok);
+	} else {
+		tk = _interpolate(tt->transforms, p_time, tt->interpolation, tt->loop_wrap, &ok);
+	}
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -1875,8 +1991,8 @@ Animation::UpdateMode Animation::value_track_get_update_mode(int p_track) const
 	return vt->update_mode;
 }
 
-template <class T>
-void Animation::_track_get_key_indices_in_range(const Vector<T> &p_array, float from_time, float to_time, List<int> *p_indices) const {
+template <class C>
+void Animation::_track_get_key_indices_in_range(const C &p_array, float from_time, float to_time, List<int> *p_indices) const {
 	if (from_time != length && to_time == length) {
 		to_time = length * 1.01; //include a little more if at the end
 	}
@@ -1935,8 +2051,14 @@ void Animation::track_get_key_indices_in_range(int p_track, float p_time, float
 			switch (t->type) {
 				case TYPE_TRANSFORM: {
 					const TransformTrack *tt = static_cast<const TransformTrack *>(t);
-					_track_get_key_indices_in_range(tt->transforms, from_time, length, p_indices);
-					_track_get_key_indices_in_range(tt->transforms, 0, to_time, p_indices);
+					if (tt->compressed.size()) {
+						CompressedTransformKeys keys(tt);
+						_track_get_key_indices_in_range(keys, from_time, length, p_indices);
+						_track_get_key_indices_in_range(keys, 0, to_time, p_indices);
+					} else {
+						_track_get_key_indices_in_range(tt->transforms, from_time, length, p_indices);
+						_track_get_key_indices_in_range(tt->transforms, 0, to_time, p_indices);
+					}
 
 				} break;
 				case TYPE_VALUE: {
@@ -1991,7 +2113,11 @@ void Animation::track_get_key_indices_in_range(int p_track, float p_time, float
 	switch (t->type) {
 		case TYPE_TRANSFORM: {
 			const TransformTrack *tt = static_cast<const TransformTrack *>(t);
-			_track_get_key_indices_in_range(tt->transforms, from_time, to_time, p_indices);
+			if (tt->compressed.size()) {
+				_track_get_key_indices_in_range(CompressedTransformKeys(tt), from_time, to_time, p_indices);
+			} else {
+				_track_get_key_indices_in_range(tt->transforms, from_time, to_time, p_indices);
+			}
 
 		} break;
 		case TYPE_VALUE: {
@@ -2673,6 +2799,9 @@ void Animation::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("clear"), &Animation::clear);
 	ClassDB::bind_method(D_METHOD("copy_track", "track_idx", "to_animation"), &Animation::copy_track);
+	ClassDB::bind_method(D_METHOD("compress"), &Animation::compress);
+	ClassDB::bind_method(D_METHOD("track_is_compressed", "track_idx"), &Animation::track_is_compressed);
+	ClassDB::bind_method(D_METHOD("get_memory_usage"), &Animation::get_memory_usage);
 
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "length", PROPERTY_HINT_RANGE, "0.001,99999,0.001"), "set_length", "get_length");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "loop"), "set_loop", "has_loop");
@@ -2879,6 +3008,7 @@ void Animation::_transform_track_optimize(int p_idx, float p_allowed_linear_err,
 	ERR_FAIL_INDEX(p_idx, tracks.size());
 	ERR_FAIL_COND(tracks[p_idx]->type != TYPE_TRANSFORM);
 	TransformTrack *tt = static_cast<TransformTrack *>(tracks[p_idx]);
+	_transform_track_decompress(tt);
 	bool prev_erased = false;
 	TKey<TransformKey> first_erased;
 
@@ -2923,6 +3053,299 @@ void Animation::optimize(float p_allowed_linear_err, float p_allowed_angular_err
 	}
 }
 
+// Compressed transform tracks
+
+float Animation::CompressedTransformKeys::get_time(int p_index) const {
+	int page = p_index / COMPRESSED_PAGE_KEYS;
+	const CompressedPage *header = (const CompressedPage *)(track->compressed.ptr() + track->page_offsets[page]);
+	return ((const float *)(header + 1))[p_index - page * COMPRESSED_PAGE_KEYS];
+}
+
+Animation::TKey<Animation::TransformKey> Animation::CompressedTransformKeys::operator[](int p_index) const {
+	int slot = p_index & 3;
+	TKey<TransformKey> &key = cursor->keys[slot];
+	if (cursor->key_indices[slot] == p_index) {
+		return key;
+	}
+	cursor->key_indices[slot] = p_index;
+
+	int page = p_index / COMPRESSED_PAGE_KEYS;
+	int k = p_index - page * COMPRESSED_PAGE_KEYS;
+	const uint8_t *data = track->compressed.ptr() + track->page_offsets[page];
+	const CompressedPage *header = (const CompressedPage *)data;
+	const int count = header->key_count;
+	data += sizeof(CompressedPage);
+
+	key.time = ((const float *)data)[k];
+	data += count * sizeof(float);
+
+	if (header->flags & COMPRESSED_HAS_TRANSITIONS) {
+		key.transition = ((const float *)data)[k];
+		data += count * sizeof(float);
+	} else {
+		key.transition = 1.0;
+	}
+
+	if (header->flags & COMPRESSED_LOC_CONSTANT) {
+		key.value.loc = Vector3(header->loc_min[0], header->loc_min[1], header->loc_min[2]);
+	} else {
+		const uint16_t *q = &((const uint16_t *)data)[k * 3];
+		for (int i = 0; i < 3; i++) {
+			key.value.loc[i] = header->loc_min[i] + header->loc_extent[i] * (q[i] * (1.0f / 65535));
+		}
+		data += count * 3 * sizeof(uint16_t);
+	}
+
+	if (header->flags & COMPRESSED_ROT_CONSTANT) {
+		key.value.rot = Quat(header->rot[0], header->rot[1], header->rot[2], header->rot[3]);
+	} else {
+		const int16_t *q = &((const int16_t *)data)[k * 4];
+		const float x = q[0], y = q[1], z = q[2], w = q[3];
+		const float scale = 1.0f / Math::sqrt(x * x + y * y + z * z + w * w);
+		key.value.rot = Quat(x * scale, y * scale, z * scale, w * scale);
+		data += count * 4 * sizeof(int16_t);
+	}
+
+	if (header->flags & COMPRESSED_SCALE_CONSTANT) {
+		key.value.scale = Vector3(header->scale_min[0], header->scale_min[1], header->scale_min[2]);
+	} else {
+		const uint16_t *q = &((const uint16_t *)data)[k * 3];
+		for (int i = 0; i < 3; i++) {
+			key.value.scale[i] = header->scale_min[i] + header->scale_extent[i] * (q[i] * (1.0f / 65535));
+		}
+	}
+
+	return key;
+}
+
+uint32_t Animation::_get_compressed_page_size(uint32_t p_key_count, uint32_t p_flags) {
+	uint32_t size = sizeof(CompressedPage) + sizeof(float) * p_key_count;
+	if (p_flags & COMPRESSED_HAS_TRANSITIONS) {
+		size += sizeof(float) * p_key_count;
+	}
+	if (!(p_flags & COMPRESSED_LOC_CONSTANT)) {
+		size += sizeof(uint16_t) * 3 * p_key_count;
+	}
+	if (!(p_flags & COMPRESSED_ROT_CONSTANT)) {
+		size += sizeof(int16_t) * 4 * p_key_count;
+	}
+	if (!(p_flags & COMPRESSED_SCALE_CONSTANT)) {
+		size += sizeof(uint16_t) * 3 * p_key_count;
+	}
+	return (size + 3) & ~3; // Keep the next page header aligned.
+}
+
+bool Animation::_transform_track_build_page_index(TransformTrack *p_track) {
+	p_track->page_offsets.clear();
+	p_track->page_times.clear();
+	p_track->compressed_key_count = 0;
+	p_track->compressed_version = atomic_increment(&compressed_version_counter);
+
+	const uint32_t size = p_track->compressed.size();
+	uint32_t ofs = 0;
+	while (ofs < size) {
+		if (ofs + sizeof(CompressedPage) > size) {
+			return false;
+		}
+		const CompressedPage *header = (const CompressedPage *)&p_track->compressed[ofs];
+		if (header->key_count == 0 || header->key_count > COMPRESSED_PAGE_KEYS) {
+			return false;
+		}
+		// Only the last page may be partially filled, so key indices map to pages directly.
+		if (p_track->compressed_key_count % COMPRESSED_PAGE_KEYS != 0) {
+			return false;
+		}
+		const uint32_t page_size = _get_compressed_page_size(header->key_count, header->flags);
+		if (ofs + page_size > size) {
+			return false;
+		}
+		p_track->page_offsets.push_back(ofs);
+		p_track->page_times.push_back(((const float *)(header + 1))[0]);
+		p_track->compressed_key_count += header->key_count;
+		ofs += page_size;
+	}
+	return true;
+}
+
+void Animation::_transform_track_compress(TransformTrack *p_track) {
+	const int key_count = p_track->transforms.size();
+	if (key_count == 0) {
+		return;
+	}
+	const TKey<TransformKey> *keys = p_track->transforms.ptr();
+
+	Vector<uint8_t> data;
+	for (int from = 0; from < key_count; from += COMPRESSED_PAGE_KEYS) {
+		const int count = MIN(int(COMPRESSED_PAGE_KEYS), key_count - from);
+
+		CompressedPage header;
+		header.key_count = count;
+		header.flags = COMPRESSED_LOC_CONSTANT | COMPRESSED_ROT_CONSTANT | COMPRESSED_SCALE_CONSTANT;
+
+		AABB loc_bounds(keys[from].value.loc, Vector3());
+		AABB scale_bounds(keys[from].value.scale, Vector3());
+		for (int i = from; i < from + count; i++) {
+			const TransformKey &value = keys[i].value;
+			if (!value.loc.is_equal_approx(keys[from].value.loc)) {
+				header.flags &= ~COMPRESSED_LOC_CONSTANT;
+			}
+			if (!value.rot.is_equal_approx(keys[from].value.rot)) {
+				header.flags &= ~COMPRESSED_ROT_CONSTANT;
+			}
+			if (!value.scale.is_equal_approx(keys[from].value.scale)) {
+				header.flags &= ~COMPRESSED_SCALE_CONSTANT;
+			}
+			if (keys[i].transition != 1.0) {
+				header.flags |= COMPRESSED_HAS_TRANSITIONS;
+			}
+			loc_bounds.expand_to(value.loc);
+			scale_bounds.expand_to(value.scale);
+		}
+		for (int i = 0; i < 3; i++) {
+			header.loc_min[i] = loc_bounds.position[i];
+			header.loc_extent[i] = loc_bounds.size[i];
+			header.scale_min[i] = scale_bounds.position[i];
+			header.scale_extent[i] = scale_bounds.size[i];
+		}
+		if (header.flags & COMPRESSED_LOC_CONSTANT) {
+			for (int i = 0; i < 3; i++) {
+				header.loc_min[i] = keys[from].value.loc[i];
+			}
+		}
+		if (header.flags & COMPRESSED_SCALE_CONSTANT) {
+			for (int i = 0; i < 3; i++) {
+				header.scale_min[i] = keys[from].value.scale[i];
+			}
+		}
+		const Quat &rot = keys[from].value.rot;
+		header.rot[0] = rot.x;
+		header.rot[1] = rot.y;
+		header.rot[2] = rot.z;
+		header.rot[3] = rot.w;
+
+		const int ofs = data.size();
+		data.resize(ofs + _get_compressed_page_size(count, header.flags));
+		uint8_t *w = data.ptrw() + ofs;
+		zeromem(w, data.size() - ofs);
+		memcpy(w, &header, sizeof(CompressedPage));
+		w += sizeof(CompressedPage);
+
+		float *times = (float *)w;
+		for (int i = 0; i < count; i++) {
+			times[i] = keys[from + i].time;
+		}
+		w += count * sizeof(float);
+
+		if (header.flags & COMPRESSED_HAS_TRANSITIONS) {
+			float *transitions = (float *)w;
+			for (int i = 0; i < count; i++) {
+				transitions[i] = keys[from + i].transition;
+			}
+			w += count * sizeof(float);
+		}
+
+		if (!(header.flags & COMPRESSED_LOC_CONSTANT)) {
+			uint16_t *q = (uint16_t *)w;
+			for (int i = 0; i < count; i++) {
+				for (int j = 0; j < 3; j++) {
+					float n = header.loc_extent[j] > 0 ? (keys[from + i].value.loc[j] - header.loc_min[j]) / header.loc_extent[j] : 0;
+					q[i * 3 + j] = CLAMP(Math::fast_ftoi(n * 65535.0), 0, 65535);
+				}
+			}
+			w += count * 3 * sizeof(uint16_t);
+		}
+
+		if (!(header.flags & COMPRESSED_ROT_CONSTANT)) {
+			int16_t *q = (int16_t *)w;
+			for (int i = 0; i < count; i++) {
+				const Quat r = keys[from + i].value.rot.normalized();
+				const real_t components[4] = { r.x, r.y, r.z, r.w };
+				for (int j = 0; j < 4; j++) {
+					q[i * 4 + j] = CLAMP(Math::fast_ftoi(components[j] * 32767.0), -32767, 32767);
+				}
+			}
+			w += count * 4 * sizeof(int16_t);
+		}
+
+		if (!(header.flags & COMPRESSED_SCALE_CONSTANT)) {
+			uint16_t *q = (uint16_t *)w;
+			for (int i = 0; i < count; i++) {
+				for (int j = 0; j < 3; j++) {
+					float n = header.scale_extent[j] > 0 ? (keys[from + i].value.scale[j] - header.scale_min[j]) / header.scale_extent[j] : 0;
+					q[i * 3 + j] = CLAMP(Math::fast_ftoi(n * 65535.0), 0, 65535);
+				}
+			}
+		}
+	}
+
+	p_track->compressed = data;
+	p_track->transforms.clear();
+	_transform_track_build_page_index(p_track);
+}
+
+void Animation::_transform_track_decompress(TransformTrack *p_track) {
+	if (p_track->compressed.size() == 0) {
+		return;
+	}
+
+	CompressedTransformKeys keys(p_track);
+	p_track->transforms.resize(keys.size());
+	for (int i = 0; i < keys.size(); i++) {
+		p_track->transforms.write[i] = keys[i];
+	}
+
+	p_track->compressed.clear();
+	p_track->page_offsets.clear();
+	p_track->page_times.clear();
+	p_track->compressed_key_count = 0;
+}
+
+Animation::TKey<Animation::TransformKey> Animation::_transform_track_get_key(const TransformTrack *p_track, int p_key) const {
+	if (p_track->compressed.size()) {
+		return CompressedTransformKeys(p_track)[p_key];
+	}
+	return p_track->transforms[p_key];
+}
+
+void Animation::compress() {
+	for (int i = 0; i < tracks.size(); i++) {
+		if (tracks[i]->type == TYPE_TRANSFORM) {
+			TransformTrack *tt = static_cast<TransformTrack *>(tracks[i]);
+			if (tt->compressed.size() == 0) {
+				_transform_track_compress(tt);
+			}
+		}
+	}
+	emit_changed();
+}
+
+bool Animation::track_is_compressed(int p_track) const {
+	ERR_FAIL_INDEX_V(p_track, tracks.size(), false);
+	if (tracks[p_track]->type != TYPE_TRANSFORM) {
+		return false;
+	}
+	return static_cast<const TransformTrack *>(tracks[p_track])->compressed.size() > 0;
+}
+
+int Animation::get_memory_usage() const {
+	int usage = sizeof(Animation);
+	for (int i = 0; i < tracks.size(); i++) {
+		switch (tracks[i]->type) {
+			case TYPE_TRANSFORM: {
+				const TransformTrack *tt = static_cast<const TransformTrack *>(tracks[i]);
+				usage += sizeof(TransformTrack);
+				usage += tt->transforms.size() * sizeof(TKey<TransformKey>);
+				usage += tt->compressed.size() + tt->page_offsets.size() * sizeof(uint32_t) + tt->page_times.size() * sizeof(float);
+			} break;
+			default: {
+				// Rough estimate, the key payloads aren't counted.
+				usage += sizeof(Track) + track_get_key_count(i) * sizeof(TKey<Variant>);
+			}
+		}
+	}
+	return usage;
+}
+
 Animation::Animation() {
 	step = 0.1;
 	loop = false;
@@ -31,6 +31,7 @@
 #ifndef ANIMATION_H
 #define ANIMATION_H
 
+#include "core/local_vector.h"
 #include "core/resource.h"
 
 class Animation : public Resource {
@@ -104,9 +105,77 @@ private:
 	struct TransformTrack : public Track {
 		Vector<TKey<TransformKey>> transforms;
 
+		// Filled by compress(), which moves the keys out of transforms.
+		Vector<uint8_t> compressed;
+		LocalVector<uint32_t> page_offsets;
+		LocalVector<float> page_times; // Time of the first key of each page.
+		int compressed_key_count = 0;
+		uint32_t compressed_version = 0; // Changes whenever compressed does, so cursors drop stale keys.
+
 		TransformTrack() { type = TYPE_TRANSFORM; }
 	};
 
+	/* COMPRESSED TRANSFORM TRACK */
+
+	// Compressed keys are stored in pages of up to COMPRESSED_PAGE_KEYS keys.
+	// A page is a CompressedPage header followed by the key times, the
+	// transitions (only if one isn't 1.0) and then loc, rot and scale quantized
+	// against the page bounds. Channels that don't change within the page are
+	// kept once in the header instead.
+	enum {
+		COMPRESSED_PAGE_KEYS = 32,
+		COMPRESSED_LOC_CONSTANT = 1,
+		COMPRESSED_ROT_CONSTANT = 2,
+		COMPRESSED_SCALE_CONSTANT = 4,
+		COMPRESSED_HAS_TRANSITIONS = 8,
+	};
+
+public:
+	// Kept by the caller for each compressed transform track it samples: the page of the last lookup
+	// and the last keys decoded from it. Steady playback then neither searches for its page nor
+	// decodes the same key again on the next frame.
+	struct TransformTrackCursor {
+		uint32_t compressed_version = 0;
+		int page = 0;
+		int key_indices[4] = { -1, -1, -1, -1 };
+		TKey<TransformKey> keys[4];
+	};
+
+private:
+	struct CompressedPage {
+		uint32_t key_count;
+		uint32_t flags;
+		float loc_min[3];
+		float loc_extent[3];
+		float scale_min[3];
+		float scale_extent[3];
+		float rot[4]; // Only used if the rotation is constant.
+	};
+
+	// Lets the key search and interpolation templates read a compressed track
+	// as if it were a Vector<TKey<TransformKey>>. Decoded keys and the page of
+	// the last lookup go in the cursor, a local one if the caller has none.
+	struct CompressedTransformKeys {
+		const TransformTrack *track;
+		TransformTrackCursor *cursor;
+		mutable TransformTrackCursor local_cursor;
+
+		int size() const { return track->compressed_key_count; }
+		TKey<TransformKey> operator[](int p_index) const;
+		float get_time(int p_index) const;
+
+		CompressedTransformKeys(const TransformTrack *p_track, TransformTrackCursor *p_cursor = nullptr) {
+			track = p_track;
+			cursor = p_cursor ? p_cursor : &local_cursor;
+			if (cursor->compressed_version != track->compressed_version) {
+				*cursor = TransformTrackCursor();
+				cursor->compressed_version = track->compressed_version;
+			}
+		}
+	};
+
+	static uint32_t compressed_version_counter;
+
 	/* PROPERTY VALUE TRACK */
 
 	struct ValueTrack : public Track {
@@ -192,6 +261,10 @@ private:
 
 	template <class K>
 	inline int _find(const Vector<K> &p_keys, float p_time) const;
+	int _find(const CompressedTransformKeys &p_keys, float p_time) const;
+	template <class K>
+	int _find_keys_in_length(const Vector<K> &p_keys) const { return _find(p_keys, length) + 1; }
+	int _find_keys_in_length(const CompressedTransformKeys &p_keys) const;
 
 	_FORCE_INLINE_ Animation::TransformKey _interpolate(const Animation::TransformKey &p_a, const Animation::TransformKey &p_b, float p_c) const;
 
@@ -206,11 +279,21 @@ private:
 	_FORCE_INLINE_ Variant _cubic_interpolate(const Variant &p_pre_a, const Variant &p_a, const Variant &p_b, const Variant &p_post_b, float p_c) const;
 	_FORCE_INLINE_ float _cubic_interpolate(const float &p_pre_a, const float &p_a, const float &p_b, const float &p_post_b, float p_c) const;
 
+	template <class T, class C>
+	_FORCE_INLINE_ T _interpolate_keys(const C &p_keys, float p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok) const;
 	template <class T>
-	_FORCE_INLINE_ T _interpolate(const Vector<TKey<T>> &p_keys, float p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok) const;
+	_FORCE_INLINE_ T _interpolate(const Vector<TKey<T>> &p_keys, float p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok) const {
+		return _interpolate_keys<T>(p_keys, p_time, p_interp, p_loop_wrap, p_ok);
+	}
 
-	template <class T>
-	_FORCE_INLINE_ void _track_get_key_indices_in_range(const Vector<T> &p_array, float from_time, float to_time, List<int> *p_indices) const;
+	template <class C>
+	_FORCE_INLINE_ void _track_get_key_indices_in_range(const C &p_array, float from_time, float to_time, List<int> *p_indices) const;
+
+	static uint32_t _get_compressed_page_size(uint32_t p_key_count, uint32_t p_flags);
+	void _transform_track_compress(TransformTrack *p_track);
+	void _transform_track_decompress(TransformTrack *p_track);
+	bool _transform_track_build_page_index(TransformTrack *p_track);
+	TKey<TransformKey> _transform_track_get_key(const TransformTrack *p_track, int p_key) const;
 
 	_FORCE_INLINE_ void _value_track_get_key_indices_in_range(const ValueTrack *vt, float from_time, float to_time, List<int> *p_indices) const;
 	_FORCE_INLINE_ void _method_track_get_key_indices_in_range(const MethodTrack *mt, float from_time, float to_time, List<int> *p_indices) const;
@@ -329,7 +412,7 @@ public:
 	void track_set_interpolation_loop_wrap(int p_track, bool p_enable);
 	bool track_get_interpolation_loop_wrap(int p_track) const;
 
-	Error transform_track_interpolate(int p_track, float p_time, Vector3 *r_loc, Quat *r_rot, Vector3 *r_scale) const;
+	Error transform_track_interpolate(int p_track, float p_time, Vector3 *r_loc, Quat *r_rot, Vector3 *r_scale, TransformTrackCursor *r_cursor = nullptr) const;
 
 	Variant value_track_interpolate(int p_track, float p_time) const;
 	void value_track_get_key_indices(int p_track, float p_time, float p_delta, List<int> *p_indices) const;
@@ -357,6 +440,10 @@ public:
 
 	void optimize(float p_allowed_linear_err = 0.05, float p_allowed_angular_err = 0.01, float p_max_optimizable_angle = Math_PI * 0.125);
 
+	void compress();
+	bool track_is_compressed(int p_track) const;
+	int get_memory_usage() const;
+
 	Animation();
 	~Animation();
 };
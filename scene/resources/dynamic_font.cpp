@@ -356,6 +356,36 @@ float DynamicFontAtSize::draw_char(RID p_canvas_item, const Point2 &p_pos, CharT
 	return advance;
 }
 
+float DynamicFontAtSize::get_char_quad(CharType p_char, const Vector<Ref<DynamicFontAtSize>> &p_fallbacks, RID &r_texture, Rect2 &r_rect, Rect2 &r_uv_rect, bool &r_keep_color) const {
+	if (!valid) {
+		return 0;
+	}
+
+	const_cast<DynamicFontAtSize *>(this)->_update_char(p_char);
+
+	Pair<const Character *, DynamicFontAtSize *> char_pair_with_font = _find_char_with_font(p_char, p_fallbacks);
+	const Character *ch = char_pair_with_font.first;
+	DynamicFontAtSize *font = char_pair_with_font.second;
+
+	ERR_FAIL_COND_V(!ch, 0.0);
+
+	if (!ch->found) {
+		return 0;
+	}
+
+	ERR_FAIL_COND_V(ch->texture_idx < -1 || ch->texture_idx >= font->textures.size(), 0);
+
+	if (ch->texture_idx != -1) {
+		// Atlas textures are updated in place, so the RID stays valid until the glyphs are reloaded.
+		r_texture = font->textures[ch->texture_idx].texture->get_rid();
+		r_rect = Rect2(ch->h_align, ch->v_align - font->get_ascent(), ch->rect.size.x, ch->rect.size.y);
+		r_uv_rect = ch->rect_uv;
+		r_keep_color = FT_HAS_COLOR(face);
+	}
+
+	return ch->advance;
+}
+
 unsigned long DynamicFontAtSize::_ft_stream_io(FT_Stream stream, unsigned long offset, unsigned char *buffer, unsigned long count) {
 	FileAccess *f = (FileAccess *)stream->descriptor.pointer;
 
@@ -679,6 +709,7 @@ DynamicFontAtSize::~DynamicFontAtSize() {
 
 void DynamicFont::_reload_cache() {
 	ERR_FAIL_COND(cache_id.size < 1);
+	_clear_shape_cache();
 	if (!data.is_valid()) {
 		data_at_size.unref();
 		outline_data_at_size.unref();
@@ -805,6 +836,7 @@ void DynamicFont::set_spacing(int p_type, int p_value) {
 		spacing_space = p_value;
 	}
 
+	_clear_shape_cache();
 	emit_changed();
 	_change_notify();
 }
@@ -906,11 +938,25 @@ float DynamicFont::draw_char(RID p_canvas_item, const Point2 &p_pos, CharType p_
 	return font_at_size->draw_char(p_canvas_item, p_pos, p_char, p_next, color, fallbacks, advance_only, p_outline) + spacing_char;
 }
 
+bool DynamicFont::_can_shape() const {
+	return data_at_size.is_valid();
+}
+
+bool DynamicFont::_shape_char(CharType p_char, CharType p_next, ShapedGlyph &r_glyph) const {
+	if (!data_at_size.is_valid()) {
+		return false;
+	}
+
+	r_glyph.advance = data_at_size->get_char_quad(p_char, fallback_data_at_size, r_glyph.texture, r_glyph.rect, r_glyph.uv_rect, r_glyph.keep_color) + spacing_char;
+	return true;
+}
+
 void DynamicFont::set_fallback(int p_idx, const Ref<DynamicFontData> &p_data) {
 	ERR_FAIL_COND(p_data.is_null());
 	ERR_FAIL_INDEX(p_idx, fallbacks.size());
 	fallbacks.write[p_idx] = p_data;
 	fallback_data_at_size.write[p_idx] = fallbacks.write[p_idx]->_get_dynamic_font_at_size(cache_id);
+	_clear_shape_cache();
 }
 
 void DynamicFont::add_fallback(const Ref<DynamicFontData> &p_data) {
@@ -921,6 +967,7 @@ void DynamicFont::add_fallback(const Ref<DynamicFontData> &p_data) {
 		fallback_outline_data_at_size.push_back(fallbacks.write[fallbacks.size() - 1]->_get_dynamic_font_at_size(outline_cache_id));
 	}
 
+	_clear_shape_cache();
 	_change_notify();
 	emit_changed();
 	_change_notify();
@@ -940,6 +987,7 @@ void DynamicFont::remove_fallback(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, fallbacks.size());
 	fallbacks.remove(p_idx);
 	fallback_data_at_size.remove(p_idx);
+	_clear_shape_cache();
 	emit_changed();
 	_change_notify();
 }
@@ -1093,6 +1141,7 @@ void DynamicFont::update_oversampling() {
 					}
 				}
 
+				E->self()->_clear_shape_cache();
 				changed.push_back(Ref<DynamicFont>(E->self()));
 			}
 
@@ -192,6 +192,7 @@ public:
 	String get_available_chars() const;
 
 	float draw_char(RID p_canvas_item, const Point2 &p_pos, CharType p_char, CharType p_next, const Color &p_modulate, const Vector<Ref<DynamicFontAtSize>> &p_fallbacks, bool p_advance_only = false, bool p_outline = false) const;
+	float get_char_quad(CharType p_char, const Vector<Ref<DynamicFontAtSize>> &p_fallbacks, RID &r_texture, Rect2 &r_rect, Rect2 &r_uv_rect, bool &r_keep_color) const;
 
 	void set_texture_flags(uint32_t p_flags);
 	void update_oversampling();
@@ -242,6 +243,9 @@ protected:
 
 	static void _bind_methods();
 
+	virtual bool _can_shape() const override;
+	virtual bool _shape_char(CharType p_char, CharType p_next, ShapedGlyph &r_glyph) const override;
+
 public:
 	void set_font_data(const Ref<DynamicFontData> &p_data);
 	Ref<DynamicFontData> get_font_data() const;
@@ -60,27 +60,108 @@ void Font::draw_halign(RID p_canvas_item, const Point2 &p_pos, HAlign p_align, f
 }
 
 void Font::draw(RID p_canvas_item, const Point2 &p_pos, const String &p_text, const Color &p_modulate, int p_clip_w, const Color &p_outline_modulate) const {
+	const bool can_shape = _can_shape();
+	if (can_shape) {
+		shape_cache_mutex.lock();
+	}
+
+	const ShapedLine *line = can_shape ? _get_shaped_line(p_text) : nullptr;
 	Vector2 ofs;
 
 	int chars_drawn = 0;
 	bool with_outline = has_outline();
 	for (int i = 0; i < p_text.length(); i++) {
-		int width = get_char_size(p_text[i]).width;
+		int width = line ? line->glyphs[i].clip_width : get_char_size(p_text[i]).width;
 
 		if (p_clip_w >= 0 && (ofs.x + width) > p_clip_w) {
 			break; //clip
 		}
 
-		ofs.x += draw_char(p_canvas_item, p_pos + ofs, p_text[i], p_text[i + 1], with_outline ? p_outline_modulate : p_modulate, with_outline);
+		if (line && !with_outline) {
+			ofs.x += line->glyphs[i].advance;
+		} else {
+			ofs.x += draw_char(p_canvas_item, p_pos + ofs, p_text[i], p_text[i + 1], with_outline ? p_outline_modulate : p_modulate, with_outline);
+		}
 		++chars_drawn;
 	}
 
-	if (has_outline()) {
+	if (line) {
+		RenderingServer *rs = RenderingServer::get_singleton();
+		ofs = Vector2(0, 0);
+		for (int i = 0; i < chars_drawn; i++) {
+			const ShapedGlyph &glyph = line->glyphs[i];
+			if (glyph.texture.is_valid()) {
+				Color modulate = p_modulate;
+				if (glyph.keep_color) {
+					modulate.r = modulate.g = modulate.b = 1.0;
+				}
+				rs->canvas_item_add_texture_rect_region(p_canvas_item, Rect2(p_pos + ofs + glyph.rect.position, glyph.rect.size), glyph.texture, glyph.uv_rect, modulate, false, RID(), RID(), Color(1, 1, 1, 1), false);
+			}
+			ofs.x += glyph.advance;
+		}
+	} else if (with_outline) {
 		ofs = Vector2(0, 0);
 		for (int i = 0; i < chars_drawn; i++) {
 			ofs.x += draw_char(p_canvas_item, p_pos + ofs, p_text[i], p_text[i + 1], p_modulate, false);
 		}
 	}
+
+	if (can_shape) {
+		shape_cache_mutex.unlock();
+	}
+}
+
+bool Font::_shape_line(const String &p_text, ShapedLine &r_line) const {
+	int l = p_text.length();
+	const CharType *sptr = p_text.ptr();
+
+	r_line.glyphs.resize(l);
+	r_line.width = 0;
+	for (int i = 0; i < l; i++) {
+		ShapedGlyph &glyph = r_line.glyphs[i];
+		if (!_shape_char(sptr[i], sptr[i + 1], glyph)) {
+			return false;
+		}
+		glyph.clip_width = int(get_char_size(sptr[i]).width);
+		r_line.width += get_char_size(sptr[i], sptr[i + 1]).width;
+	}
+
+	return true;
+}
+
+const Font::ShapedLine *Font::_get_shaped_line(const String &p_text) const {
+	if (p_text.empty()) {
+		return nullptr;
+	}
+
+	ShapedLine *line = shape_cache[shape_cache_current].getptr(p_text);
+	if (line) {
+		return line;
+	}
+
+	ShapedLine shaped;
+	const ShapedLine *previous = shape_cache[shape_cache_current ^ 1].getptr(p_text);
+	if (previous) {
+		shaped = *previous;
+	} else if (!_shape_line(p_text, shaped)) {
+		return nullptr;
+	}
+
+	if (shape_cache[shape_cache_current].size() >= SHAPE_CACHE_LINES) {
+		shape_cache_current ^= 1;
+		shape_cache[shape_cache_current].clear();
+	}
+
+	line = &shape_cache[shape_cache_current][p_text];
+	*line = shaped;
+	return line;
+}
+
+void Font::_clear_shape_cache() {
+	MutexLock lock(shape_cache_mutex);
+
+	shape_cache[0].clear();
+	shape_cache[1].clear();
 }
 
 void Font::update_changes() {
@@ -482,6 +563,15 @@ Size2 Font::get_string_size(const String &p_string) const {
 	if (l == 0) {
 		return Size2(0, get_height());
 	}
+
+	if (_can_shape()) {
+		MutexLock lock(shape_cache_mutex);
+		const ShapedLine *line = _get_shaped_line(p_string);
+		if (line) {
+			return Size2(line->width, get_height());
+		}
+	}
+
 	const CharType *sptr = &p_string[0];
 
 	for (int i = 0; i < l; i++) {
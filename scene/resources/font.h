@@ -31,16 +31,56 @@
 #ifndef FONT_H
 #define FONT_H
 
+#include "core/hash_map.h"
+#include "core/local_vector.h"
 #include "core/map.h"
+#include "core/os/mutex.h"
 #include "core/resource.h"
 #include "scene/resources/texture.h"
 
 class Font : public Resource {
 	GDCLASS(Font, Resource);
 
+protected:
+	struct ShapedGlyph {
+		float advance = 0;
+		float clip_width = 0; // Width draw() uses to decide whether the glyph fits.
+		RID texture; // Null if the glyph has nothing to draw.
+		Rect2 rect; // Relative to the pen position on the baseline.
+		Rect2 uv_rect;
+		bool keep_color = false;
+	};
+
+	struct ShapedLine {
+		LocalVector<ShapedGlyph> glyphs;
+		float width = 0;
+	};
+
+private:
+	enum {
+		SHAPE_CACHE_LINES = 1024
+	};
+
+	// Lines are looked up in the current generation first. When it fills up the
+	// older one is dropped, so lines that stop being drawn are evicted.
+	mutable HashMap<String, ShapedLine> shape_cache[2];
+	mutable int shape_cache_current = 0;
+	Mutex shape_cache_mutex;
+
+	bool _shape_line(const String &p_text, ShapedLine &r_line) const;
+	const ShapedLine *_get_shaped_line(const String &p_text) const;
+
 protected:
 	static void _bind_methods();
 
+	// Fonts that can describe each character as a single textured quad override
+	// these, and draw() and get_string_size() then reuse whole shaped lines.
+	// Other fonts skip the line cache entirely. RichTextLabel and TextEdit color
+	// and place every character themselves, so they still draw one at a time.
+	virtual bool _can_shape() const { return false; }
+	virtual bool _shape_char(CharType p_char, CharType p_next, ShapedGlyph &r_glyph) const { return false; }
+	void _clear_shape_cache();
+
 public:
 	virtual float get_height() const = 0;
 
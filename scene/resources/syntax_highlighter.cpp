@@ -58,11 +58,19 @@ void SyntaxHighlighter::_line_edited_from(int p_line) {
 		return;
 	}
 
-	int cache_size = highlighting_cache.back()->key();
-	for (int i = p_line - 1; i <= cache_size; i++) {
-		if (highlighting_cache.has(i)) {
-			highlighting_cache.erase(i);
-		}
+	// Only walk the cached lines from the edit onwards, not every line number up to the last one.
+	int from_line = p_line - 1;
+	Map<int, Dictionary>::Element *E = highlighting_cache.find_closest(from_line);
+	if (!E) {
+		E = highlighting_cache.front();
+	} else if (E->key() < from_line) {
+		E = E->next();
+	}
+
+	while (E) {
+		Map<int, Dictionary>::Element *next = E->next();
+		highlighting_cache.erase(E);
+		E = next;
 	}
 }
 
@@ -35,20 +35,19 @@
 #include "core/string_name.h"
 
 class SceneStringNames {
-	friend void register_scene_types();
-	friend void unregister_scene_types();
-
 	static SceneStringNames *singleton;
 
+	SceneStringNames();
+
+public:
+	// Called by register_scene_types(), and by tests of scene types, which
+	// only set up the core.
 	static void create() { singleton = memnew(SceneStringNames); }
 	static void free() {
 		memdelete(singleton);
 		singleton = nullptr;
 	}
 
-	SceneStringNames();
-
-public:
 	_FORCE_INLINE_ static SceneStringNames *get_singleton() { return singleton; }
 
 	StringName _estimate_cost;
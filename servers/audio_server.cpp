@@ -227,6 +227,7 @@ AudioDriver *AudioDriverManager::get_driver(int p_driver) {
 //////////////////////////////////////////////
 
 void AudioServer::_driver_process(int p_frames, int32_t *p_buffer) {
+	MemoryTagScope memory_tag_scope(Memory::TAG_AUDIO, "AudioServer::_driver_process");
 	int todo = p_frames;
 
 #ifdef DEBUG_ENABLED
@@ -1227,6 +1227,8 @@ void PhysicsServer2DSW::step(real_t p_step) {
 		return;
 	}
 
+	MemoryTagScope memory_tag_scope(Memory::TAG_PHYSICS, "PhysicsServer2DSW::step");
+
 	_update_shapes();
 
 	doing_sync = false;
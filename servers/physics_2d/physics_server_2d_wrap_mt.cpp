@@ -55,8 +55,8 @@ void PhysicsServer2DWrapMT::thread_loop() {
 	exit = false;
 	step_thread_up = true;
 	while (!exit) {
-		// flush commands one by one, until exit is requested
-		command_queue.wait_and_flush_one();
+		// flush commands as they come, until exit is requested
+		command_queue.wait_and_flush();
 	}
 
 	command_queue.flush_all(); // flush all
@@ -132,7 +132,7 @@ void PhysicsServer2DWrapMT::finish() {
 }
 
 PhysicsServer2DWrapMT::PhysicsServer2DWrapMT(PhysicsServer2D *p_contained, bool p_create_thread) :
-		command_queue(p_create_thread) {
+		command_queue(p_create_thread, true) {
 	physics_2d_server = p_contained;
 	create_thread = p_create_thread;
 	thread = nullptr;
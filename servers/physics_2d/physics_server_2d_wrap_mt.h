@@ -45,7 +45,7 @@
 class PhysicsServer2DWrapMT : public PhysicsServer2D {
 	mutable PhysicsServer2D *physics_2d_server;
 
-	mutable CommandQueueMT command_queue;
+	mutable CommandQueueSPSC command_queue;
 
 	static void _thread_callback(void *_instance);
 	void thread_loop();
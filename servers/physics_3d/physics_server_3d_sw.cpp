@@ -1301,6 +1301,8 @@ void PhysicsServer3DSW::step(real_t p_step) {
 		return;
 	}
 
+	MemoryTagScope memory_tag_scope(Memory::TAG_PHYSICS, "PhysicsServer3DSW::step");
+
 	_update_shapes();
 
 	doing_sync = false;
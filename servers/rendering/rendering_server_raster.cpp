@@ -98,6 +98,7 @@ void RenderingServerRaster::draw(bool p_swap_buffers, double frame_step) {
 	//needs to be done before changes is reset to 0, to not force the editor to redraw
 	RS::get_singleton()->emit_signal("frame_pre_draw");
 
+	MemoryTagScope memory_tag_scope(Memory::TAG_RENDERING, "RenderingServerRaster::draw");
 	changes = 0;
 
 	RSG::rasterizer->begin_frame(frame_step);
@@ -30,6 +30,7 @@
 
 #include "rendering_server_scene.h"
 
+#include "core/os/frame_allocator.h"
 #include "core/os/os.h"
 #include "rendering_server_globals.h"
 #include "rendering_server_raster.h"
@@ -1908,6 +1909,9 @@ void RenderingServerScene::_prepare_scene(const Transform p_cam_transform, const
 	// - p_cam_transform will be a transform in the middle of our two eyes
 	// - p_cam_projection is a wider frustrum that encompasses both eyes
 
+	// This may run on the render thread, outside of the main loop frame scope.
+	FrameAllocator::Scope frame_scope;
+
 	Scenario *scenario = scenario_owner.getornull(p_scenario);
 
 	render_pass++;
@@ -2122,7 +2126,8 @@ void RenderingServerScene::_prepare_scene(const Transform p_cam_transform, const
 
 	// directional lights
 	{
-		Instance **lights_with_shadow = (Instance **)alloca(sizeof(Instance *) * scenario->directional_lights.size());
+		LocalVector<Instance *, uint32_t, false, FrameAllocator> lights_with_shadow;
+		lights_with_shadow.resize(scenario->directional_lights.size());
 		int directional_shadow_count = 0;
 
 		for (List<Instance *>::Element *E = scenario->directional_lights.front(); E; E = E->next()) {
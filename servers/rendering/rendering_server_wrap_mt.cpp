@@ -63,8 +63,8 @@ void RenderingServerWrapMT::thread_loop() {
 	exit = false;
 	draw_thread_up = true;
 	while (!exit) {
-		// flush commands one by one, until exit is requested
-		command_queue.wait_and_flush_one();
+		// flush commands as they come, until exit is requested
+		command_queue.wait_and_flush();
 	}
 
 	command_queue.flush_all(); // flush all
@@ -153,7 +153,7 @@ void RenderingServerWrapMT::set_use_vsync_callback(bool p_enable) {
 RenderingServerWrapMT *RenderingServerWrapMT::singleton_mt = nullptr;
 
 RenderingServerWrapMT::RenderingServerWrapMT(RenderingServer *p_contained, bool p_create_thread) :
-		command_queue(p_create_thread) {
+		command_queue(p_create_thread, true) {
 	singleton_mt = this;
 	DisplayServer::switch_vsync_function = set_use_vsync_callback; //as this goes to another thread, make sure it goes properly
 
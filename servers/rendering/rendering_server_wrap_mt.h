@@ -39,7 +39,7 @@ class RenderingServerWrapMT : public RenderingServer {
 	// the real visual server
 	mutable RenderingServer *rendering_server;
 
-	mutable CommandQueueMT command_queue;
+	mutable CommandQueueSPSC command_queue;
 
 	static void _thread_callback(void *_instance);
 	void thread_loop();
@@ -0,0 +1,240 @@
+/*************************************************************************/
+/*  test_animation.h                                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_ANIMATION_H
+#define TEST_ANIMATION_H
+
+#include "core/math/random_pcg.h"
+#include "core/os/os.h"
+#include "scene/resources/animation.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_scene_helpers.h"
+
+namespace TestAnimation {
+
+// A skeletal clip at 30 FPS where only the first bone moves, every bone
+// rotates and no bone scales.
+static Ref<Animation> create_skeleton_clip(int p_bones, float p_length) {
+	Ref<Animation> anim;
+	anim.instance();
+	anim->set_length(p_length);
+	anim->set_loop(true);
+	for (int i = 0; i < p_bones; i++) {
+		int track = anim->add_track(Animation::TYPE_TRANSFORM);
+		anim->track_set_path(track, NodePath("Skeleton:bone_" + itos(i)));
+		for (float t = 0; t <= p_length; t += 1.0 / 30.0) {
+			Vector3 loc = i == 0 ? Vector3(Math::sin(t), t * 0.5, 0) : Vector3(0, 0.2, 0);
+			Quat rot(Vector3(0, 1, 0), Math::sin(t * 2.0 + i) * 0.5);
+			anim->transform_track_insert_key(track, t, loc, rot, Vector3(1, 1, 1));
+		}
+	}
+	return anim;
+}
+
+TEST_CASE("[Animation] Compressed transform tracks sample like uncompressed ones") {
+	SceneStringNamesScope scene_string_names;
+	Ref<Animation> anim = create_skeleton_clip(4, 3.0);
+	Ref<Animation> compressed = create_skeleton_clip(4, 3.0);
+	compressed->compress();
+
+	CHECK(compressed->track_is_compressed(0));
+	CHECK(compressed->track_get_key_count(0) == anim->track_get_key_count(0));
+	CHECK(compressed->get_memory_usage() < anim->get_memory_usage() / 2);
+
+	Animation::TransformTrackCursor cursor;
+	for (float t = 0; t < 3.0; t += 0.013) {
+		for (int i = 0; i < 4; i++) {
+			Vector3 loc[2], scale[2];
+			Quat rot[2];
+			anim->transform_track_interpolate(i, t, &loc[0], &rot[0], &scale[0]);
+			compressed->transform_track_interpolate(i, t, &loc[1], &rot[1], &scale[1], i == 0 ? &cursor : nullptr);
+			CHECK(loc[0].distance_to(loc[1]) < 0.001);
+			CHECK(Math::abs(rot[0].dot(rot[1])) > 0.9999);
+			CHECK(scale[0].is_equal_approx(scale[1]));
+		}
+	}
+
+	for (int i = 0; i < anim->track_get_key_count(0); i++) {
+		CHECK(anim->track_get_key_time(0, i) == compressed->track_get_key_time(0, i));
+	}
+	CHECK(compressed->track_find_key(0, anim->track_get_key_time(0, 40), true) == 40);
+}
+
+TEST_CASE("[Animation] Compressed transform tracks survive serialization and editing") {
+	SceneStringNamesScope scene_string_names;
+	Ref<Animation> anim = create_skeleton_clip(1, 2.0);
+	anim->compress();
+
+	Ref<Animation> copy;
+	copy.instance();
+	copy->add_track(Animation::TYPE_TRANSFORM);
+	copy->set("tracks/0/compressed", anim->get("tracks/0/compressed"));
+	CHECK(copy->track_is_compressed(0));
+	CHECK(copy->track_get_key_count(0) == anim->track_get_key_count(0));
+	CHECK(Dictionary(copy->track_get_key_value(0, 10)).hash() == Dictionary(anim->track_get_key_value(0, 10)).hash());
+
+	const int count = anim->track_get_key_count(0);
+	anim->track_remove_key(0, 0);
+	CHECK_FALSE(anim->track_is_compressed(0));
+	CHECK(anim->track_get_key_count(0) == count - 1);
+}
+
+TEST_CASE("[Animation] Compressing keeps transitions, static channels and other tracks") {
+	SceneStringNamesScope scene_string_names;
+	Ref<Animation> anim = create_skeleton_clip(1, 2.0);
+	for (int i = 0; i < anim->track_get_key_count(0); i += 5) {
+		anim->track_set_key_transition(0, i, 0.5f + i * 0.1f);
+	}
+
+	// A bone that doesn't move at all.
+	const Vector3 loc(1, 2, 3);
+	const Quat rot(Vector3(1, 0, 0), 0.3);
+	const Vector3 scale(2, 2, 2);
+	int static_track = anim->add_track(Animation::TYPE_TRANSFORM);
+	for (int i = 0; i < 40; i++) {
+		anim->transform_track_insert_key(static_track, i * 0.05, loc, rot, scale);
+	}
+
+	int value_track = anim->add_track(Animation::TYPE_VALUE);
+	anim->track_insert_key(value_track, 0.0, 1.0);
+	anim->track_insert_key(value_track, 1.0, 2.0);
+
+	anim->compress();
+
+	CHECK(anim->track_is_compressed(0));
+	bool same_transitions = true;
+	for (int i = 0; i < anim->track_get_key_count(0); i++) {
+		same_transitions = same_transitions && anim->track_get_key_transition(0, i) == (i % 5 == 0 ? 0.5f + i * 0.1f : 1.0f);
+	}
+	CHECK(same_transitions);
+
+	CHECK(anim->track_is_compressed(static_track));
+	bool exact = true;
+	for (float t = 0; t < 2.0; t += 0.07) {
+		Vector3 l, s;
+		Quat r;
+		anim->transform_track_interpolate(static_track, t, &l, &r, &s);
+		exact = exact && l == loc && s == scale && r.is_equal_approx(rot);
+	}
+	CHECK_MESSAGE(exact, "Channels that don't change should sample their exact value.");
+
+	CHECK_FALSE(anim->track_is_compressed(value_track));
+	CHECK(anim->track_get_key_count(value_track) == 2);
+	CHECK(anim->value_track_interpolate(value_track, 0.5) == Variant(1.5));
+}
+
+TEST_CASE("[Animation] Compressed tracks sample the same with a cursor when seeking") {
+	SceneStringNamesScope scene_string_names;
+	Ref<Animation> anim = create_skeleton_clip(1, 4.0);
+	anim->compress();
+
+	// Jumps forwards and backwards across pages, as when seeking or looping.
+	RandomPCG rng(7);
+	Animation::TransformTrackCursor cursor;
+	bool same = true;
+	for (int i = 0; i < 500; i++) {
+		float t = rng.randf() * 4.0;
+		Vector3 loc[2], scale[2];
+		Quat rot[2];
+		anim->transform_track_interpolate(0, t, &loc[0], &rot[0], &scale[0]);
+		anim->transform_track_interpolate(0, t, &loc[1], &rot[1], &scale[1], &cursor);
+		same = same && loc[0] == loc[1] && rot[0] == rot[1] && scale[0] == scale[1];
+	}
+	CHECK(same);
+}
+
+TEST_CASE("[Animation] Cursors drop keys decoded before the track was compressed again") {
+	SceneStringNamesScope scene_string_names;
+	Ref<Animation> anim = create_skeleton_clip(2, 2.0);
+	anim->compress();
+
+	Animation::TransformTrackCursor cursor;
+	Vector3 loc, scale;
+	Quat rot;
+	anim->transform_track_interpolate(1, 1.0, &loc, &rot, &scale, &cursor);
+	CHECK(loc.is_equal_approx(Vector3(0, 0.2, 0)));
+
+	// Editing decompresses the track, compressing it again must not reuse the cursor's keys.
+	Dictionary key;
+	key["location"] = Vector3(0, 1.0, 0);
+	for (int i = 0; i < anim->track_get_key_count(1); i++) {
+		anim->track_set_key_value(1, i, key);
+	}
+	anim->compress();
+	anim->transform_track_interpolate(1, 1.0, &loc, &rot, &scale, &cursor);
+	CHECK(loc.is_equal_approx(Vector3(0, 1.0, 0)));
+}
+
+TEST_CASE("[Animation][Benchmark] Compressed transform tracks" * doctest::skip()) {
+	SceneStringNamesScope scene_string_names;
+	const int bones = 100;
+	const float length = 5.0;
+	Ref<Animation> anim = create_skeleton_clip(bones, length);
+	Ref<Animation> compressed = create_skeleton_clip(bones, length);
+	compressed->compress();
+
+	Vector<Animation::TransformTrackCursor> cursors;
+	cursors.resize(bones);
+
+	OS *os = OS::get_singleton();
+	Vector3 loc, scale;
+	Quat rot;
+	const int loops = 4;
+	uint64_t times[3];
+	// Uncompressed, then compressed with a cursor per track as AnimationPlayer does, then without.
+	for (int pass = 0; pass < 3; pass++) {
+		Ref<Animation> a = pass ? compressed : anim;
+		Animation::TransformTrackCursor *track_cursors = pass == 1 ? cursors.ptrw() : nullptr;
+		uint64_t t = 0;
+		// The first loop only warms the caches.
+		for (int loop = 0; loop <= loops; loop++) {
+			uint64_t from = os->get_ticks_usec();
+			for (float time = 0; time < length; time += 1.0 / 60.0) {
+				for (int i = 0; i < bones; i++) {
+					a->transform_track_interpolate(i, time, &loc, &rot, &scale, track_cursors ? &track_cursors[i] : nullptr);
+				}
+			}
+			if (loop > 0) {
+				t += os->get_ticks_usec() - from;
+			}
+		}
+		times[pass] = t;
+	}
+
+	const int samples = int(length * 60.0) * bones * loops;
+	print_line(vformat("Uncompressed:           %d bytes per clip, %.1f ns per sample", anim->get_memory_usage(), times[0] * 1000.0 / samples));
+	print_line(vformat("Compressed, cursor:     %d bytes per clip, %.1f ns per sample", compressed->get_memory_usage(), times[1] * 1000.0 / samples));
+	print_line(vformat("Compressed, no cursor:  %d bytes per clip, %.1f ns per sample", compressed->get_memory_usage(), times[2] * 1000.0 / samples));
+}
+
+} // namespace TestAnimation
+
+#endif // TEST_ANIMATION_H
@@ -690,7 +690,7 @@ TestResult add_exposed_classes(Context &r_context) {
 
 		// Add signals
 
-		const HashMap<StringName, MethodInfo> &signal_map = class_info->signal_map;
+		const DenseHashMap<StringName, MethodInfo> &signal_map = class_info->signal_map;
 		const StringName *k = nullptr;
 
 		while ((k = signal_map.next(k))) {
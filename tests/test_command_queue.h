@@ -0,0 +1,273 @@
+/*************************************************************************/
+/*  test_command_queue.h                                                 */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_COMMAND_QUEUE_H
+#define TEST_COMMAND_QUEUE_H
+
+#include "core/command_queue_mt.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestCommandQueue {
+
+class Receiver {
+public:
+	uint64_t sum = 0;
+	int calls = 0;
+	int last = -1;
+	bool ordered = true;
+	bool exit = false;
+
+	void add(int p_value) {
+		ordered = ordered && p_value == last + 1;
+		last = p_value;
+		sum += p_value;
+		calls++;
+	}
+	void add_big(int p_value, Transform p_a, Transform p_b, Transform p_c) {
+		add(p_value);
+	}
+	int get_calls_plus(int p_value) {
+		return calls + p_value;
+	}
+	void stop() {
+		exit = true;
+	}
+};
+
+TEST_CASE("[CommandQueueSPSC] Commands run in order and buffer grows") {
+	CommandQueueSPSC queue(false);
+	Receiver receiver;
+
+	// Much more than a single block, with nothing consumed in between.
+	const int count = 20000;
+	for (int i = 0; i < count; i++) {
+		if (i % 2) {
+			queue.push(&receiver, &Receiver::add, i);
+		} else {
+			queue.push(&receiver, &Receiver::add_big, i, Transform(), Transform(), Transform());
+		}
+	}
+	CHECK(receiver.calls == 0);
+
+	CHECK(queue.flush_all() == count);
+	CHECK(receiver.calls == count);
+	CHECK(receiver.ordered);
+	CHECK(queue.flush_all() == 0);
+
+	// The drained blocks get reused.
+	for (int i = count; i < count * 2; i++) {
+		queue.push(&receiver, &Receiver::add, i);
+	}
+	CHECK(queue.flush_all() == count);
+	CHECK(receiver.ordered);
+}
+
+template <class Q>
+struct Consumer {
+	Q *queue;
+	Receiver *receiver;
+};
+
+template <class Q>
+static void consumer_thread(void *p_userdata);
+
+template <>
+void consumer_thread<CommandQueueSPSC>(void *p_userdata) {
+	Consumer<CommandQueueSPSC> *consumer = (Consumer<CommandQueueSPSC> *)p_userdata;
+	while (!consumer->receiver->exit) {
+		consumer->queue->wait_and_flush();
+	}
+}
+
+template <>
+void consumer_thread<CommandQueueMT>(void *p_userdata) {
+	Consumer<CommandQueueMT> *consumer = (Consumer<CommandQueueMT> *)p_userdata;
+	while (!consumer->receiver->exit) {
+		consumer->queue->wait_and_flush_one();
+	}
+}
+
+TEST_CASE("[CommandQueueSPSC] Producer and consumer threads") {
+	const int count = 100000;
+	CommandQueueSPSC queue(true);
+	Receiver receiver;
+	Consumer<CommandQueueSPSC> consumer = { &queue, &receiver };
+	Thread *thread = Thread::create(consumer_thread<CommandQueueSPSC>, &consumer);
+
+	for (int i = 0; i < count; i++) {
+		queue.push(&receiver, &Receiver::add, i);
+	}
+
+	// Both return once the consumer ran their command, and everything pushed before it.
+	int ret = 0;
+	queue.push_and_ret(&receiver, &Receiver::get_calls_plus, 1, &ret);
+	CHECK(ret == count + 1);
+	queue.push_and_sync(&receiver, &Receiver::add, count);
+	CHECK(receiver.calls == count + 1);
+
+	queue.push(&receiver, &Receiver::stop);
+	Thread::wait_to_finish(thread);
+	memdelete(thread);
+
+	CHECK(receiver.ordered);
+	CHECK(receiver.sum == uint64_t(count + 1) * count / 2);
+}
+
+class ProducerReceiver {
+public:
+	enum {
+		PRODUCERS = 4,
+		COMMANDS_PER_PRODUCER = 20000
+	};
+
+	int last[PRODUCERS];
+	int calls = 0;
+	bool ordered = true;
+	bool exit = false;
+
+	void add(int p_producer, int p_value) {
+		ordered = ordered && p_value == last[p_producer] + 1;
+		last[p_producer] = p_value;
+		calls++;
+	}
+	int get_last(int p_producer) {
+		return last[p_producer];
+	}
+	void stop() {
+		exit = true;
+	}
+
+	ProducerReceiver() {
+		for (int i = 0; i < PRODUCERS; i++) {
+			last[i] = -1;
+		}
+	}
+};
+
+struct Producer {
+	CommandQueueSPSC *queue;
+	ProducerReceiver *receiver;
+	int index;
+	int mismatches;
+};
+
+static void producer_thread(void *p_userdata) {
+	Producer *producer = (Producer *)p_userdata;
+	for (int i = 0; i < ProducerReceiver::COMMANDS_PER_PRODUCER; i++) {
+		producer->queue->push(producer->receiver, &ProducerReceiver::add, producer->index, i);
+		if (i % 1000 == 999) {
+			// Everything this thread pushed before has run once this returns.
+			int last = -1;
+			producer->queue->push_and_ret(producer->receiver, &ProducerReceiver::get_last, producer->index, &last);
+			if (last != i) {
+				producer->mismatches++;
+			}
+		}
+	}
+}
+
+static void flushing_consumer_thread(void *p_userdata) {
+	Producer *producer = (Producer *)p_userdata;
+	while (!producer->receiver->exit) {
+		producer->queue->wait_and_flush();
+	}
+}
+
+TEST_CASE("[CommandQueueSPSC] Several producer threads") {
+	CommandQueueSPSC queue(true, true);
+	ProducerReceiver receiver;
+
+	Producer consumer = { &queue, &receiver, -1, 0 };
+	Thread *consumer_thread = Thread::create(flushing_consumer_thread, &consumer);
+
+	Producer producers[ProducerReceiver::PRODUCERS];
+	Thread *producer_threads[ProducerReceiver::PRODUCERS];
+	for (int i = 0; i < ProducerReceiver::PRODUCERS; i++) {
+		producers[i] = { &queue, &receiver, i, 0 };
+		producer_threads[i] = Thread::create(producer_thread, &producers[i]);
+	}
+	for (int i = 0; i < ProducerReceiver::PRODUCERS; i++) {
+		Thread::wait_to_finish(producer_threads[i]);
+		memdelete(producer_threads[i]);
+	}
+
+	queue.push(&receiver, &ProducerReceiver::stop);
+	Thread::wait_to_finish(consumer_thread);
+	memdelete(consumer_thread);
+
+	CHECK(receiver.calls == ProducerReceiver::PRODUCERS * ProducerReceiver::COMMANDS_PER_PRODUCER);
+	CHECK_MESSAGE(receiver.ordered, "Commands of each producer should run in the order they were pushed.");
+	for (int i = 0; i < ProducerReceiver::PRODUCERS; i++) {
+		CHECK(receiver.last[i] == ProducerReceiver::COMMANDS_PER_PRODUCER - 1);
+		CHECK_MESSAGE(producers[i].mismatches == 0, "push_and_ret() should return after the producer's earlier commands ran.");
+	}
+}
+
+template <class Q>
+static uint64_t run_threaded(int p_count, Receiver &r_receiver) {
+	Q queue(true);
+	Consumer<Q> consumer = { &queue, &r_receiver };
+	Thread *thread = Thread::create(consumer_thread<Q>, &consumer);
+
+	uint64_t t = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < p_count; i++) {
+		queue.push(&r_receiver, &Receiver::add, i);
+	}
+	int ret = 0;
+	queue.push_and_ret(&r_receiver, &Receiver::get_calls_plus, 0, &ret);
+	t = OS::get_singleton()->get_ticks_usec() - t;
+
+	queue.push(&r_receiver, &Receiver::stop);
+	Thread::wait_to_finish(thread);
+	memdelete(thread);
+	return t;
+}
+
+// Throughput against the locked queue, run with --no-skip to print it.
+TEST_CASE("[CommandQueueSPSC][Benchmark] Compare with CommandQueueMT" * doctest::skip()) {
+	const int count = 1000000;
+
+	Receiver mt_receiver;
+	uint64_t mt_time = run_threaded<CommandQueueMT>(count, mt_receiver);
+	Receiver spsc_receiver;
+	uint64_t spsc_time = run_threaded<CommandQueueSPSC>(count, spsc_receiver);
+
+	CHECK(mt_receiver.calls == count);
+	CHECK(spsc_receiver.calls == count);
+	print_line(vformat("CommandQueueMT:   %d commands/s", int(count * 1000000.0 / MAX(mt_time, 1))));
+	print_line(vformat("CommandQueueSPSC: %d commands/s", int(count * 1000000.0 / MAX(spsc_time, 1))));
+}
+
+} // namespace TestCommandQueue
+
+#endif // TEST_COMMAND_QUEUE_H
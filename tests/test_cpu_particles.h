@@ -0,0 +1,128 @@
+/*************************************************************************/
+/*  test_cpu_particles.h                                                 */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#ifndef TEST_CPU_PARTICLES_H
+#define TEST_CPU_PARTICLES_H
+
+#include "core/math/math_funcs.h"
+#include "core/thread_work_pool.h"
+#include "scene/2d/cpu_particles_2d.h"
+#include "scene/3d/cpu_particles_3d.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_scene_helpers.h"
+
+namespace TestCPUParticles {
+
+class Simulator {
+public:
+	// Runs the emitter for a fixed number of steps, then returns the buffer it sends to the multimesh.
+	template <class T>
+	static Vector<float> run(T *p_emitter, ThreadWorkPool *p_pool) {
+		Math::seed(1234);
+		for (int i = 0; i < 60; i++) {
+			p_emitter->_particles_process(1.0 / 60.0, p_pool);
+		}
+		p_emitter->_update_particle_data_buffer(p_pool);
+		return p_emitter->particle_data;
+	}
+};
+
+// Several blocks of particles, restarting at different times, with random parameters.
+template <class T>
+static T *create_emitter() {
+	T *emitter = memnew(T);
+	emitter->set_amount(20000);
+	emitter->set_lifetime(0.5);
+	emitter->set_randomness_ratio(0.5);
+	emitter->set_lifetime_randomness(0.3);
+	emitter->set_draw_order(T::DRAW_ORDER_LIFETIME);
+	emitter->set_emission_shape(T::EMISSION_SHAPE_SPHERE);
+	emitter->set_param(T::PARAM_LINEAR_ACCEL, 2.0);
+	emitter->set_param(T::PARAM_DAMPING, 0.5);
+	emitter->set_param_randomness(T::PARAM_DAMPING, 0.5);
+	emitter->set_param_randomness(T::PARAM_ANGLE, 1.0);
+	emitter->set_param_randomness(T::PARAM_SCALE, 1.0);
+	emitter->set_emitting(true);
+	return emitter;
+}
+
+static int count_mismatches(const Vector<float> &p_a, const Vector<float> &p_b) {
+	if (p_a.size() != p_b.size()) {
+		return MAX(p_a.size(), p_b.size());
+	}
+	int mismatches = 0;
+	for (int i = 0; i < p_a.size(); i++) {
+		// Compared bitwise, each particle must go through the exact same steps.
+		if (memcmp(&p_a[i], &p_b[i], sizeof(float)) != 0) {
+			mismatches++;
+		}
+	}
+	return mismatches;
+}
+
+template <class T>
+static void check_threaded_matches_serial() {
+	RenderingServerScope rendering_server;
+	SceneStringNamesScope scene_string_names;
+
+	ThreadWorkPool pool;
+	pool.init(4);
+
+	T *serial = create_emitter<T>();
+	T *threaded = create_emitter<T>();
+	Vector<float> expected = Simulator::run(serial, nullptr);
+	Vector<float> result = Simulator::run(threaded, &pool);
+
+	// The buffer holds zeros for particles that never started.
+	bool emitted = false;
+	for (int i = 0; i < expected.size() && !emitted; i++) {
+		emitted = expected[i] != 0.0;
+	}
+	CHECK(emitted);
+	CHECK(count_mismatches(expected, result) == 0);
+
+	memdelete(serial);
+	memdelete(threaded);
+	pool.finish();
+}
+
+TEST_CASE("[CPUParticles2D] Threaded and serial simulation produce the same particles") {
+	check_threaded_matches_serial<CPUParticles2D>();
+}
+
+TEST_CASE("[CPUParticles3D] Threaded and serial simulation produce the same particles") {
+	check_threaded_matches_serial<CPUParticles3D>();
+}
+
+} // namespace TestCPUParticles
+
+#endif // TEST_CPU_PARTICLES_H
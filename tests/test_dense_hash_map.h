@@ -0,0 +1,360 @@
+/*************************************************************************/
+/*  test_dense_hash_map.h                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_DENSE_HASH_MAP_H
+#define TEST_DENSE_HASH_MAP_H
+
+#include "core/dense_hash_map.h"
+#include "core/hash_map.h"
+#include "core/math/random_pcg.h"
+#include "core/ordered_hash_map.h"
+#include "core/os/os.h"
+#include "core/print_string.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestDenseHashMap {
+
+TEST_CASE("[DenseHashMap] Insert, lookup and overwrite") {
+	DenseHashMap<int, int> map;
+
+	CHECK(map.empty());
+	CHECK(map.getptr(42) == nullptr);
+
+	map.set(42, 84);
+	map[7] = 3;
+
+	CHECK(map.size() == 2);
+	CHECK(map.has(42));
+	CHECK(map.get(42) == 84);
+	CHECK(map[7] == 3);
+	CHECK(!map.has(8));
+
+	map.set(42, 1234);
+	CHECK_MESSAGE(map.size() == 2, "Setting an existing key should not add an entry.");
+	CHECK(*map.getptr(42) == 1234);
+}
+
+TEST_CASE("[DenseHashMap] Iteration follows insertion order") {
+	DenseHashMap<String, int> map;
+
+	for (int i = 0; i < 100; i++) {
+		map.set(itos(99 - i), i);
+	}
+
+	int expected = 0;
+	for (DenseHashMap<String, int>::Iterator it = map.iter(); it.valid; it = map.next_iter(it)) {
+		CHECK(*it.key == itos(99 - expected));
+		CHECK(*it.value == expected);
+		expected++;
+	}
+	CHECK(expected == 100);
+
+	// Overwriting keeps the original position.
+	map.set("99", -1);
+	CHECK(*map.next(nullptr) == "99");
+	CHECK(map["99"] == -1);
+}
+
+TEST_CASE("[DenseHashMap] Erase") {
+	DenseHashMap<int, int> map;
+
+	for (int i = 0; i < 1000; i++) {
+		map.set(i, i * 2);
+	}
+
+	CHECK(map.erase(500));
+	CHECK(!map.erase(500));
+	CHECK(!map.has(500));
+	CHECK(map.size() == 999);
+
+	// Leave holes between the remaining entries.
+	for (int i = 0; i < 1000; i += 2) {
+		map.erase(i);
+	}
+	CHECK(map.size() == 500);
+
+	bool valid = true;
+	int count = 0;
+	int last = -1;
+	const int *k = nullptr;
+	while ((k = map.next(k))) {
+		valid = valid && (*k % 2) == 1 && *k > last && map[*k] == *k * 2;
+		last = *k;
+		count++;
+	}
+	CHECK_MESSAGE(valid, "Remaining entries should keep their values and order.");
+	CHECK(count == 500);
+
+	// Keys that end up in the same probe sequence need to stay reachable after erasing.
+	for (int i = 0; i < 1000; i += 2) {
+		map.set(i * 1024, i);
+	}
+	for (int i = 0; i < 1000; i += 4) {
+		map.erase(i * 1024);
+	}
+	valid = true;
+	for (int i = 2; i < 1000; i += 4) {
+		valid = valid && map.has(i * 1024) && map[i * 1024] == i;
+	}
+	CHECK(valid);
+
+	// Erasing while walking from the start, as done when freeing objects.
+	while ((k = map.next(nullptr))) {
+		map.erase(*k);
+	}
+	CHECK(map.empty());
+	CHECK(map.next(nullptr) == nullptr);
+}
+
+TEST_CASE("[DenseHashMap] Copy and clear") {
+	DenseHashMap<int, String> map;
+	map.reserve(64);
+	for (int i = 0; i < 64; i++) {
+		map.set(i, itos(i));
+	}
+	map.erase(10);
+
+	DenseHashMap<int, String> copy = map;
+	map.clear();
+
+	CHECK(map.empty());
+	CHECK(!map.has(1));
+	CHECK(copy.size() == 63);
+	CHECK(!copy.has(10));
+	CHECK(copy[63] == "63");
+
+	map.set(1, "one");
+	CHECK(map.size() == 1);
+	CHECK(map[1] == "one");
+}
+
+TEST_CASE("[DenseHashMap] Cursors and index access") {
+	DenseHashMap<int, int> map;
+	for (int i = 0; i < 16; i++) {
+		map.set(i, i * 10);
+	}
+	map.erase(0);
+	map.erase(5);
+
+	int count = 0;
+	bool ordered = true;
+	int last = -1;
+	for (int c = map.next_cursor(-1); c >= 0; c = map.next_cursor(c)) {
+		ordered = ordered && map.get_key_at_cursor(c) > last && map.get_value_at_cursor(c) == map.get_key_at_cursor(c) * 10;
+		last = map.get_key_at_cursor(c);
+		count++;
+	}
+	CHECK(ordered);
+	CHECK(count == 14);
+
+	CHECK_MESSAGE(map.get_key_at_index(0) == 1, "Index access should skip erased entries.");
+	CHECK(map.get_key_at_index(4) == 6);
+	CHECK(map.get_value_at_index(13) == 150);
+}
+
+TEST_CASE("[DenseHashMap] Erasing while walking cursors") {
+	DenseHashMap<int, int> map;
+	for (int i = 0; i < 200; i++) {
+		map.set(i, i);
+	}
+
+	// Erase the current key and the one two ahead of it, well past the
+	// point where holes outnumber the remaining entries.
+	int visited = 0;
+	bool ordered = true;
+	int last = -1;
+	for (int c = map.next_cursor(-1); c >= 0; c = map.next_cursor(c)) {
+		int key = map.get_key_at_cursor(c);
+		ordered = ordered && key > last && key % 4 < 2;
+		last = key;
+		visited++;
+		map.erase(key);
+		map.erase(key + 2);
+	}
+	CHECK(ordered);
+	CHECK_MESSAGE(visited == 100, "Every key not erased ahead of the cursor should be visited once.");
+	CHECK(map.empty());
+	CHECK(map.next_cursor(-1) == -1);
+
+	for (int i = 0; i < 100; i++) {
+		map.set(i, i);
+	}
+	for (int i = 0; i < 50; i++) {
+		map.erase(i);
+	}
+	CHECK_MESSAGE(map.get_key_at_index(0) == 50, "Index access should skip leading holes.");
+	CHECK(map.get_key_at_index(49) == 99);
+	map.set(100, 100);
+	CHECK(map.get_key_at_index(50) == 100);
+}
+
+TEST_CASE("[DenseHashMap] Random inserts and erases behave like HashMap") {
+	DenseHashMap<int, int> map;
+	HashMap<int, int> expected;
+	// Keys in the order they were first inserted since they were last erased.
+	Vector<int> order;
+	RandomPCG rng(42);
+
+	bool same_results = true;
+	bool same_index_keys = true;
+	for (int i = 0; i < 20000; i++) {
+		int key = rng.rand() % 512;
+		if (rng.rand() % 3 == 0) {
+			same_results = same_results && map.erase(key) == expected.erase(key);
+			order.erase(key);
+		} else {
+			if (!expected.has(key)) {
+				order.push_back(key);
+			}
+			map.set(key, i);
+			expected.set(key, i);
+		}
+
+		if (order.size()) {
+			int index = rng.rand() % order.size();
+			same_index_keys = same_index_keys && map.get_key_at_index(index) == order[index];
+		}
+	}
+	CHECK_MESSAGE(same_results, "Erasing should report the same keys as HashMap.");
+	CHECK_MESSAGE(same_index_keys, "Index access should follow insertion order with erased entries around.");
+	CHECK(map.size() == (uint32_t)expected.size());
+
+	bool same_entries = true;
+	int index = 0;
+	for (DenseHashMap<int, int>::Iterator it = map.iter(); it.valid; it = map.next_iter(it)) {
+		same_entries = same_entries && index < order.size() && *it.key == order[index] && *it.value == expected[*it.key];
+		index++;
+	}
+	CHECK_MESSAGE(same_entries, "Entries should have HashMap's values, in insertion order.");
+	CHECK(index == order.size());
+
+	List<int> keys;
+	map.get_key_list(&keys);
+	CHECK(keys.size() == order.size());
+
+	// Growing past the current capacity keeps every entry.
+	map.reserve(4096);
+	same_entries = true;
+	for (int i = 0; i < order.size(); i++) {
+		same_entries = same_entries && map.get_key_at_index(i) == order[i] && map[order[i]] == expected[order[i]];
+	}
+	CHECK(same_entries);
+}
+
+// Timings against the chained maps, run with --no-skip to print them.
+TEST_CASE("[DenseHashMap][Benchmark] Compare with HashMap and OrderedHashMap" * doctest::skip()) {
+	const int count = 100000;
+
+	Vector<String> keys;
+	keys.resize(count);
+	for (int i = 0; i < count; i++) {
+		keys.write[i] = "key_" + itos(i);
+	}
+
+	OS *os = OS::get_singleton();
+	int sum = 0;
+
+	{
+		DenseHashMap<String, int> map;
+		uint64_t t = os->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			map.set(keys[i], i);
+		}
+		uint64_t insert = os->get_ticks_usec() - t;
+
+		t = os->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			sum += *map.getptr(keys[i]);
+		}
+		uint64_t lookup = os->get_ticks_usec() - t;
+
+		t = os->get_ticks_usec();
+		for (DenseHashMap<String, int>::Iterator it = map.iter(); it.valid; it = map.next_iter(it)) {
+			sum += *it.value;
+		}
+		uint64_t iterate = os->get_ticks_usec() - t;
+
+		print_line(vformat("DenseHashMap: insert %d usec, lookup %d usec, iterate %d usec.", insert, lookup, iterate));
+	}
+
+	{
+		HashMap<String, int> map;
+		uint64_t t = os->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			map.set(keys[i], i);
+		}
+		uint64_t insert = os->get_ticks_usec() - t;
+
+		t = os->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			sum += *map.getptr(keys[i]);
+		}
+		uint64_t lookup = os->get_ticks_usec() - t;
+
+		t = os->get_ticks_usec();
+		const String *k = nullptr;
+		while ((k = map.next(k))) {
+			sum += map[*k];
+		}
+		uint64_t iterate = os->get_ticks_usec() - t;
+
+		print_line(vformat("HashMap: insert %d usec, lookup %d usec, iterate %d usec.", insert, lookup, iterate));
+	}
+
+	{
+		OrderedHashMap<String, int> map;
+		uint64_t t = os->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			map.insert(keys[i], i);
+		}
+		uint64_t insert = os->get_ticks_usec() - t;
+
+		t = os->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			sum += map.find(keys[i]).get();
+		}
+		uint64_t lookup = os->get_ticks_usec() - t;
+
+		t = os->get_ticks_usec();
+		for (OrderedHashMap<String, int>::Element E = map.front(); E; E = E.next()) {
+			sum += E.get();
+		}
+		uint64_t iterate = os->get_ticks_usec() - t;
+
+		print_line(vformat("OrderedHashMap: insert %d usec, lookup %d usec, iterate %d usec.", insert, lookup, iterate));
+	}
+
+	CHECK(sum != 0);
+}
+
+} // namespace TestDenseHashMap
+
+#endif // TEST_DENSE_HASH_MAP_H
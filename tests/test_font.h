@@ -0,0 +1,147 @@
+/*************************************************************************/
+/*  test_font.h                                                          */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_FONT_H
+#define TEST_FONT_H
+
+#include "core/os/memory.h"
+#include "scene/resources/dynamic_font.h"
+#include "scene/resources/font.h"
+
+#ifdef TOOLS_ENABLED
+#include "editor/builtin_fonts.gen.h"
+#endif
+
+#include "tests/test_macros.h"
+#include "tests/test_scene_helpers.h"
+
+namespace TestFont {
+
+// The width of the text measured character by character, without the line cache.
+static float get_uncached_width(const Ref<Font> &p_font, const String &p_text) {
+	float width = 0;
+	for (int i = 0; i < p_text.length(); i++) {
+		width += p_font->get_char_size(p_text[i], p_text[i + 1]).width;
+	}
+	return width;
+}
+
+TEST_CASE("[BitmapFont] Measuring text doesn't go through the line cache") {
+	Ref<BitmapFont> font;
+	font.instance();
+	font->set_height(10);
+	for (CharType c = 'a'; c <= 'z'; c++) {
+		font->add_char(c, -1, Rect2(0, 0, 4 + c % 3, 10), Size2());
+	}
+	font->add_kerning_pair('a', 'v', 2);
+
+	Vector<String> texts;
+	for (int i = 0; i < 100; i++) {
+		texts.push_back("avenue " + itos(i) + " of the alphabet");
+	}
+
+	// Every text is new, so caching them would allocate.
+	const uint64_t alloc_count = Memory::get_total_alloc_count();
+	float width = 0;
+	for (int i = 0; i < texts.size(); i++) {
+		width += font->get_string_size(texts[i]).width;
+	}
+	CHECK(Memory::get_total_alloc_count() == alloc_count);
+
+	float expected_width = 0;
+	for (int i = 0; i < texts.size(); i++) {
+		expected_width += get_uncached_width(font, texts[i]);
+	}
+	CHECK(Math::is_equal_approx(width, expected_width));
+}
+
+#if defined(FREETYPE_ENABLED) && defined(TOOLS_ENABLED)
+TEST_CASE("[DynamicFont] Cached lines follow size, fallback and oversampling changes") {
+	RenderingServerScope rendering_server;
+	// The dummy server doesn't create the glyph textures, which is reported.
+	ERR_PRINT_OFF;
+	const bool dynamic_fonts_initialized = DynamicFont::dynamic_fonts != nullptr;
+	if (!dynamic_fonts_initialized) {
+		DynamicFont::initialize_dynamic_fonts();
+	}
+
+	Ref<DynamicFontData> data;
+	data.instance();
+	data->set_font_ptr(_font_NotoSansUI_Regular, _font_NotoSansUI_Regular_size);
+	Ref<DynamicFontData> japanese;
+	japanese.instance();
+	japanese->set_font_ptr(_font_DroidSansJapanese, _font_DroidSansJapanese_size);
+
+	Ref<DynamicFont> font;
+	font.instance();
+	font->set_font_data(data);
+	font->set_size(16);
+
+	// The half-width katakana are only found once the fallback is added, and
+	// they are narrower than the replacement character drawn until then.
+	const String text = String("Shaped line ") + String::utf8("\xEF\xBD\xB1\xEF\xBD\xB2");
+	float width = font->get_string_size(text).width;
+	CHECK(Math::is_equal_approx(width, get_uncached_width(font, text)));
+
+	font->set_size(32);
+	CHECK(font->get_string_size(text).width > width);
+	CHECK(Math::is_equal_approx(font->get_string_size(text).width, get_uncached_width(font, text)));
+
+	width = font->get_string_size(text).width;
+	font->add_fallback(japanese);
+	CHECK(font->get_string_size(text).width < width);
+	CHECK(Math::is_equal_approx(font->get_string_size(text).width, get_uncached_width(font, text)));
+
+	width = font->get_string_size(text).width;
+	font->remove_fallback(0);
+	CHECK(Math::is_equal_approx(font->get_string_size(text).width, get_uncached_width(font, text)));
+	font->add_fallback(japanese);
+
+	DynamicFontAtSize::font_oversampling = 1.7;
+	DynamicFont::update_oversampling();
+	CHECK(Math::is_equal_approx(font->get_string_size(text).width, get_uncached_width(font, text)));
+
+	DynamicFontAtSize::font_oversampling = 1.0;
+	DynamicFont::update_oversampling();
+	CHECK(Math::is_equal_approx(font->get_string_size(text).width, width));
+
+	font.unref();
+	japanese.unref();
+	data.unref();
+	if (!dynamic_fonts_initialized) {
+		DynamicFont::finish_dynamic_fonts();
+	}
+	ERR_PRINT_ON;
+}
+#endif
+
+} // namespace TestFont
+
+#endif // TEST_FONT_H
@@ -0,0 +1,107 @@
+/*************************************************************************/
+/*  test_frame_allocator.h                                               */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_FRAME_ALLOCATOR_H
+#define TEST_FRAME_ALLOCATOR_H
+
+#include "core/list.h"
+#include "core/local_vector.h"
+#include "core/os/frame_allocator.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestFrameAllocator {
+
+TEST_CASE("[FrameAllocator] Scopes release their allocations") {
+	FrameAllocator::Scope scope;
+
+	uint8_t *first = (uint8_t *)FrameAllocator::alloc(100);
+	{
+		FrameAllocator::Scope inner;
+		uint8_t *a = (uint8_t *)FrameAllocator::alloc(1000);
+		uint8_t *b = (uint8_t *)FrameAllocator::alloc(1000);
+		CHECK(a > first);
+		CHECK(b > a);
+	}
+
+	uint8_t *second = (uint8_t *)FrameAllocator::alloc(100);
+	CHECK_MESSAGE(second == first + 128, "Memory from the inner scope should be reused.");
+}
+
+TEST_CASE("[FrameAllocator] Last allocation grows in place") {
+	FrameAllocator::Scope scope;
+
+	uint8_t *mem = (uint8_t *)FrameAllocator::alloc(16);
+	mem[0] = 42;
+	uint8_t *grown = (uint8_t *)FrameAllocator::realloc(mem, 4096);
+	CHECK(grown == mem);
+
+	FrameAllocator::alloc(16);
+	uint8_t *moved = (uint8_t *)FrameAllocator::realloc(grown, 8192);
+	CHECK_MESSAGE(moved != grown, "Only the last allocation can grow in place.");
+	CHECK(moved[0] == 42);
+}
+
+TEST_CASE("[FrameAllocator] Containers") {
+	FrameAllocator::Scope scope;
+
+	LocalVector<int, uint32_t, false, FrameAllocator> vector;
+	List<String, FrameAllocator> list;
+	for (int i = 0; i < 10000; i++) {
+		vector.push_back(i);
+		if (i % 100 == 0) {
+			list.push_back(itos(i));
+		}
+	}
+
+	bool valid = true;
+	for (int i = 0; i < 10000; i++) {
+		valid = valid && vector[i] == i;
+	}
+	CHECK(valid);
+	CHECK(list.size() == 100);
+	CHECK(list.back()->get() == "9900");
+
+	list.clear();
+	vector.reset();
+	CHECK(vector.empty());
+}
+
+TEST_CASE("[FrameAllocator] Heap fallback outside of a scope") {
+	// Without a scope the memory has to outlive any frame, so it comes from the heap.
+	LocalVector<int, uint32_t, false, FrameAllocator> vector;
+	vector.resize(64);
+	vector[63] = 1;
+	CHECK(vector[63] == 1);
+}
+
+} // namespace TestFrameAllocator
+
+#endif // TEST_FRAME_ALLOCATOR_H
@@ -0,0 +1,152 @@
+/*************************************************************************/
+/*  test_image.h                                                         */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_IMAGE_H
+#define TEST_IMAGE_H
+
+#include "core/image.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestImage {
+
+// Sets how many threads Image splits large images across, while in scope.
+class ThreadCountScope {
+	uint32_t previous;
+
+public:
+	ThreadCountScope(uint32_t p_count) {
+		previous = Image::processing_thread_count;
+		Image::processing_thread_count = p_count;
+	}
+
+	~ThreadCountScope() {
+		Image::processing_thread_count = previous;
+	}
+};
+
+// The images used below are large enough for the work to be split between threads.
+static Ref<Image> _create_noise_image(int p_width, int p_height, Image::Format p_format) {
+	Vector<uint8_t> data;
+	data.resize(Image::get_image_data_size(p_width, p_height, p_format, false));
+	uint8_t *w = data.ptrw();
+	uint32_t seed = 12345;
+	for (int i = 0; i < data.size(); i++) {
+		seed = seed * 1103515245 + 12345;
+		w[i] = (seed >> 16) & 0xFF;
+	}
+
+	Ref<Image> image;
+	image.instance();
+	image->create(p_width, p_height, false, p_format, data);
+	return image;
+}
+
+TEST_CASE("[Image] Mipmaps average each 2x2 block") {
+	Ref<Image> image = _create_noise_image(512, 512, Image::FORMAT_RGBA8);
+	Vector<uint8_t> base = image->get_data();
+	image->generate_mipmaps();
+
+	CHECK_MESSAGE(image->get_mipmap_count() == 9, "A 512x512 image should have 9 mipmaps.");
+
+	Vector<uint8_t> data = image->get_data();
+	const uint8_t *mip = &data[image->get_mipmap_offset(1)];
+	bool matches = true;
+	for (int y = 0; y < 256; y++) {
+		for (int x = 0; x < 256; x++) {
+			for (int c = 0; c < 4; c++) {
+				int sum = base[((y * 2) * 512 + x * 2) * 4 + c] + base[((y * 2) * 512 + x * 2 + 1) * 4 + c] + base[((y * 2 + 1) * 512 + x * 2) * 4 + c] + base[((y * 2 + 1) * 512 + x * 2 + 1) * 4 + c];
+				if (mip[(y * 256 + x) * 4 + c] != (sum + 2) >> 2) {
+					matches = false;
+				}
+			}
+		}
+	}
+	CHECK_MESSAGE(matches, "Every pixel of the first mipmap should be the rounded average of the four pixels above it.");
+}
+
+TEST_CASE("[Image] Threaded resizing matches the single-threaded result") {
+	const Image::Interpolation interpolations[] = { Image::INTERPOLATE_NEAREST, Image::INTERPOLATE_BILINEAR, Image::INTERPOLATE_CUBIC, Image::INTERPOLATE_TRILINEAR, Image::INTERPOLATE_LANCZOS };
+	const Image::Format formats[] = { Image::FORMAT_RGB8, Image::FORMAT_RGBA8, Image::FORMAT_RGBAF };
+
+	for (int i = 0; i < 5; i++) {
+		for (int j = 0; j < 3; j++) {
+			Ref<Image> source = _create_noise_image(600, 400, formats[j]);
+			source->generate_mipmaps();
+
+			Ref<Image> expected = source->duplicate();
+			{
+				ThreadCountScope single_thread(1);
+				expected->resize(333, 777, interpolations[i]);
+			}
+
+			// A fixed count, so the rows are split even on a single CPU.
+			Ref<Image> threaded = source->duplicate();
+			{
+				ThreadCountScope threads(4);
+				threaded->resize(333, 777, interpolations[i]);
+			}
+
+			CHECK(threaded->get_width() == 333);
+			CHECK(threaded->get_height() == 777);
+			CHECK(threaded->has_mipmaps());
+			Vector<uint8_t> expected_data = expected->get_data();
+			Vector<uint8_t> threaded_data = threaded->get_data();
+			REQUIRE(threaded_data.size() == expected_data.size());
+			CHECK_MESSAGE(memcmp(threaded_data.ptr(), expected_data.ptr(), threaded_data.size()) == 0, "Resizing across threads should give the same image and mipmaps as resizing on a single thread.");
+		}
+	}
+}
+
+TEST_CASE("[Image] Format conversion") {
+	Ref<Image> image = _create_noise_image(700, 300, Image::FORMAT_RGBA8);
+	Vector<uint8_t> rgba = image->get_data();
+
+	image->convert(Image::FORMAT_RGB8);
+	Vector<uint8_t> rgb = image->get_data();
+	REQUIRE(rgb.size() == 700 * 300 * 3);
+
+	bool matches = true;
+	for (int i = 0; i < 700 * 300; i++) {
+		for (int c = 0; c < 3; c++) {
+			if (rgb[i * 3 + c] != rgba[i * 4 + c]) {
+				matches = false;
+			}
+		}
+	}
+	CHECK_MESSAGE(matches, "Converting RGBA8 to RGB8 should keep the color channels of every pixel.");
+
+	image->convert(Image::FORMAT_RGBAF);
+	CHECK(image->get_pixel(699, 299).is_equal_approx(Color(rgba[(700 * 300 - 1) * 4] / 255.0, rgba[(700 * 300 - 1) * 4 + 1] / 255.0, rgba[(700 * 300 - 1) * 4 + 2] / 255.0, 1.0)));
+}
+
+} // namespace TestImage
+
+#endif // TEST_IMAGE_H
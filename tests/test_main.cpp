@@ -32,20 +32,34 @@
 
 #include "core/list.h"
 
+#include "test_animation.h"
 #include "test_astar.h"
 #include "test_basis.h"
 #include "test_class_db.h"
 #include "test_color.h"
+#include "test_command_queue.h"
+#include "test_cpu_particles.h"
+#include "test_dense_hash_map.h"
+#include "test_font.h"
+#include "test_frame_allocator.h"
 #include "test_gdscript.h"
 #include "test_gui.h"
+#include "test_image.h"
 #include "test_math.h"
+#include "test_memory.h"
 #include "test_oa_hash_map.h"
+#include "test_object.h"
 #include "test_ordered_hash_map.h"
 #include "test_physics_2d.h"
 #include "test_physics_3d.h"
+#include "test_rich_text_label.h"
 #include "test_render.h"
 #include "test_shader_lang.h"
+#include "test_skeleton_3d.h"
 #include "test_string.h"
+#include "test_text_edit.h"
+#include "test_tile_map.h"
+#include "test_tween.h"
 #include "test_validate_testing.h"
 #include "test_variant.h"
 
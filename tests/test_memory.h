@@ -0,0 +1,120 @@
+/*************************************************************************/
+/*  test_memory.h                                                        */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_MEMORY_H
+#define TEST_MEMORY_H
+
+#include "core/debugger/debugger_marshalls.h"
+#include "core/os/memory.h"
+#include "core/ustring.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestMemory {
+
+#ifdef DEBUG_ENABLED
+TEST_CASE("[Memory] Tagged allocations") {
+	const uint64_t usage = Memory::get_tag_usage(Memory::TAG_AUDIO);
+	const uint64_t allocs = Memory::get_tag_alloc_count(Memory::TAG_AUDIO);
+
+	void *mem;
+	{
+		MemoryTagScope scope(Memory::TAG_AUDIO);
+		mem = memalloc(1000);
+	}
+	CHECK(Memory::get_tag_usage(Memory::TAG_AUDIO) == usage + 1000);
+	CHECK(Memory::get_tag_alloc_count(Memory::TAG_AUDIO) == allocs + 1);
+
+	// The tag is stored with the block, so resizing or freeing it outside
+	// the scope is still accounted to the subsystem that allocated it.
+	mem = memrealloc(mem, 3000);
+	CHECK(Memory::get_tag_usage(Memory::TAG_AUDIO) == usage + 3000);
+
+	memfree(mem);
+	CHECK(Memory::get_tag_usage(Memory::TAG_AUDIO) == usage);
+}
+
+TEST_CASE("[Memory] Sampled allocation sites") {
+	Memory::clear_alloc_samples();
+	Memory::set_alloc_sample_rate(1);
+	{
+		MemoryTagScope scope(Memory::TAG_PHYSICS, "test_site");
+		for (int i = 0; i < 10; i++) {
+			memfree(memalloc(64));
+		}
+	}
+	Memory::set_alloc_sample_rate(0);
+
+	Memory::AllocSample samples[Memory::MAX_ALLOC_SAMPLES];
+	int count = Memory::get_alloc_samples(samples, Memory::MAX_ALLOC_SAMPLES);
+	bool found = false;
+	for (int i = 0; i < count; i++) {
+		if (samples[i].site && String(samples[i].site) == "test_site") {
+			found = true;
+			CHECK(samples[i].tag == Memory::TAG_PHYSICS);
+			CHECK(samples[i].count == 10);
+			CHECK(samples[i].bytes == 640);
+		}
+	}
+	CHECK(found);
+	Memory::clear_alloc_samples();
+}
+#endif
+
+TEST_CASE("[Memory] Tag usage survives the debugger message") {
+	DebuggerMarshalls::MemoryTagUsage usage;
+	DebuggerMarshalls::MemoryTagInfo tag;
+	tag.name = "Audio";
+	tag.bytes = 4096;
+	tag.allocs = 12;
+	usage.tags.push_back(tag);
+	DebuggerMarshalls::MemorySampleInfo sample;
+	sample.site = "mix";
+	sample.tag = "Audio";
+	sample.count = 3;
+	sample.bytes = 192;
+	usage.samples.push_back(sample);
+
+	DebuggerMarshalls::MemoryTagUsage received;
+	REQUIRE(received.deserialize(usage.serialize()));
+	REQUIRE(received.tags.size() == 1);
+	CHECK(received.tags[0].name == "Audio");
+	CHECK(received.tags[0].bytes == 4096);
+	CHECK(received.tags[0].allocs == 12);
+	REQUIRE(received.samples.size() == 1);
+	CHECK(received.samples[0].site == "mix");
+	CHECK(received.samples[0].tag == "Audio");
+	CHECK(received.samples[0].count == 3);
+	CHECK(received.samples[0].bytes == 192);
+}
+
+} // namespace TestMemory
+
+#endif // TEST_MEMORY_H
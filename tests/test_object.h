@@ -0,0 +1,85 @@
+/*************************************************************************/
+/*  test_object.h                                                        */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_OBJECT_H
+#define TEST_OBJECT_H
+
+#include "core/resource.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestObject {
+
+TEST_CASE("[Object] Signal emission to native methods") {
+	Ref<Resource> source;
+	source.instance();
+	Ref<Resource> target;
+	target.instance();
+
+	Vector<Variant> binds;
+	binds.push_back("bound name");
+	source->connect("changed", Callable(target.ptr(), "set_name"), binds);
+
+	source->emit_signal("changed");
+	CHECK_MESSAGE(
+			target->get_name() == "bound name",
+			"The connected method should receive the bound arguments.");
+
+	target->set_name("");
+	source->emit_signal("changed");
+	CHECK_MESSAGE(
+			target->get_name() == "bound name",
+			"The connection should be kept after emitting.");
+}
+
+TEST_CASE("[Object] Signal emission disconnects one shot connections") {
+	Ref<Resource> source;
+	source.instance();
+	Ref<Resource> target;
+	target.instance();
+
+	Vector<Variant> binds;
+	binds.push_back("first");
+	source->connect("changed", Callable(target.ptr(), "set_name"), binds, Object::CONNECT_ONESHOT);
+
+	source->emit_signal("changed");
+	CHECK(target->get_name() == "first");
+	CHECK_MESSAGE(
+			!source->is_connected("changed", Callable(target.ptr(), "set_name")),
+			"One shot connections should be removed after the first emission.");
+
+	target->set_name("");
+	source->emit_signal("changed");
+	CHECK(target->get_name() == "");
+}
+
+} // namespace TestObject
+
+#endif // TEST_OBJECT_H
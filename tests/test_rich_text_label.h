@@ -0,0 +1,159 @@
+/*************************************************************************/
+/*  test_rich_text_label.h                                               */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_RICH_TEXT_LABEL_H
+#define TEST_RICH_TEXT_LABEL_H
+
+#include "scene/gui/rich_text_label.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_scene_helpers.h"
+
+namespace TestRichTextLabel {
+
+// Wide enough for short lines, the long one wraps once.
+static const int LABEL_WIDTH = 40 * TEST_FONT_CHAR_WIDTH;
+static const String LONG_LINE = String("word ").repeat(12);
+
+static RichTextLabel *create_label() {
+	RichTextLabel *label = memnew(RichTextLabel);
+	label->set_fit_content_height(true);
+	label->set_size(Size2(LABEL_WIDTH, 1000));
+	return label;
+}
+
+static void add_lines(RichTextLabel *p_label, int p_count, int p_long_line) {
+	for (int i = 0; i < p_count; i++) {
+		if (i > 0) {
+			p_label->add_newline();
+		}
+		p_label->add_text(i == p_long_line ? LONG_LINE : "line " + itos(i));
+	}
+}
+
+// Laying the label out again from scratch gives the height the caches should hold.
+static int get_relayout_height(RichTextLabel *p_label) {
+	p_label->set_tab_size(p_label->get_tab_size());
+	return p_label->get_minimum_size().height;
+}
+
+TEST_CASE("[RichTextLabel] Appended lines are measured") {
+	RenderingServerScope rendering_server;
+	DefaultThemeScope default_theme;
+	RichTextLabel *label = create_label();
+
+	add_lines(label, 10, 4);
+	CHECK(label->get_line_count() == 10);
+	CHECK(label->get_minimum_size().height == 11 * TEST_FONT_HEIGHT);
+	CHECK(label->get_content_height() == 11 * TEST_FONT_HEIGHT);
+
+	label->add_newline();
+	label->add_text("one more");
+	CHECK(label->get_line_count() == 11);
+	CHECK(label->get_minimum_size().height == 12 * TEST_FONT_HEIGHT);
+
+	memdelete(label);
+}
+
+TEST_CASE("[RichTextLabel] Removing lines keeps the content height") {
+	RenderingServerScope rendering_server;
+	DefaultThemeScope default_theme;
+	RichTextLabel *label = create_label();
+
+	add_lines(label, 10, 4);
+	CHECK(label->get_minimum_size().height == 11 * TEST_FONT_HEIGHT);
+
+	SUBCASE("From the middle, the end and the start") {
+		// The wrapped line.
+		CHECK(label->remove_line(4));
+		CHECK(label->get_line_count() == 9);
+		CHECK(label->get_text() == "line 0\nline 1\nline 2\nline 3\nline 5\nline 6\nline 7\nline 8\nline 9");
+		CHECK(label->get_minimum_size().height == 9 * TEST_FONT_HEIGHT);
+		CHECK(label->get_content_height() == get_relayout_height(label));
+
+		// The last line has no newline of its own.
+		CHECK(label->remove_line(8));
+		CHECK(label->get_line_count() == 8);
+		CHECK(label->get_text() == "line 0\nline 1\nline 2\nline 3\nline 5\nline 6\nline 7\nline 8\n");
+		CHECK(label->get_minimum_size().height == 8 * TEST_FONT_HEIGHT);
+		CHECK(label->get_content_height() == get_relayout_height(label));
+
+		CHECK(label->remove_line(0));
+		CHECK(label->get_line_count() == 7);
+		CHECK(label->get_text() == "line 1\nline 2\nline 3\nline 5\nline 6\nline 7\nline 8\n");
+		CHECK(label->get_minimum_size().height == 7 * TEST_FONT_HEIGHT);
+		CHECK(label->get_content_height() == get_relayout_height(label));
+	}
+
+	SUBCASE("Lines after a removed one move up") {
+		CHECK(label->remove_line(1));
+		CHECK(label->remove_line(1));
+		CHECK(label->get_line_count() == 8);
+		CHECK(label->get_text() == "line 0\nline 3\n" + LONG_LINE + "\nline 5\nline 6\nline 7\nline 8\nline 9");
+		// The wrapped line is now the third one.
+		CHECK(label->get_minimum_size().height == 9 * TEST_FONT_HEIGHT);
+		CHECK(label->get_content_height() == get_relayout_height(label));
+	}
+
+	SUBCASE("Every line, from the last one") {
+		for (int i = 9; i >= 0; i--) {
+			CHECK(label->remove_line(i));
+			CHECK(label->get_line_count() == MAX(i, 1));
+			CHECK(label->get_content_height() == label->get_minimum_size().height);
+			CHECK(label->get_content_height() == get_relayout_height(label));
+		}
+		// An empty label still has one empty line, as tall as the font.
+		CHECK(label->get_text() == "");
+		CHECK(label->get_minimum_size().height == TEST_FONT_HEIGHT);
+	}
+
+	SUBCASE("Every line, from the first one") {
+		for (int i = 9; i > 0; i--) {
+			CHECK(label->remove_line(0));
+			CHECK(label->get_line_count() == i);
+			CHECK(label->get_content_height() == label->get_minimum_size().height);
+			CHECK(label->get_content_height() == get_relayout_height(label));
+		}
+		CHECK(label->get_text() == "line 9");
+		CHECK(label->remove_line(0));
+		CHECK(label->get_line_count() == 1);
+		CHECK(label->get_text() == "");
+		CHECK(label->get_minimum_size().height == TEST_FONT_HEIGHT);
+	}
+
+	CHECK_FALSE(label->remove_line(label->get_line_count()));
+	CHECK_FALSE(label->remove_line(-1));
+
+	memdelete(label);
+}
+
+} // namespace TestRichTextLabel
+
+#endif // TEST_RICH_TEXT_LABEL_H
@@ -0,0 +1,154 @@
+/*************************************************************************/
+/*  test_scene_helpers.h                                                 */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_SCENE_HELPERS_H
+#define TEST_SCENE_HELPERS_H
+
+#include "drivers/dummy/rasterizer_dummy.h"
+#include "scene/main/node.h"
+#include "scene/resources/font.h"
+#include "scene/resources/style_box.h"
+#include "scene/resources/texture.h"
+#include "scene/resources/theme.h"
+#include "scene/scene_string_names.h"
+#include "servers/physics_2d/physics_server_2d_sw.h"
+#include "servers/rendering/rendering_server_raster.h"
+
+// Canvas items and resources that create textures need a rendering server,
+// which the test runner doesn't start. Declare one of these at the top of
+// such a test to run it against a dummy server.
+class RenderingServerScope {
+	RenderingServer *server = nullptr;
+
+public:
+	RenderingServerScope() {
+		if (!RenderingServer::get_singleton()) {
+			RasterizerDummy::make_current();
+			server = memnew(RenderingServerRaster);
+			server->init();
+		}
+	}
+
+	~RenderingServerScope() {
+		if (server) {
+			server->finish();
+			memdelete(server);
+		}
+	}
+};
+
+// Viewports, which popups and windows are, create a 2D physics space.
+class PhysicsServer2DScope {
+	PhysicsServer2D *server = nullptr;
+
+public:
+	PhysicsServer2DScope() {
+		if (!PhysicsServer2D::get_singleton()) {
+			// Normally defined when the server is picked at startup.
+			GLOBAL_DEF("physics/2d/thread_model", 1);
+			server = memnew(PhysicsServer2DSW);
+			server->init();
+		}
+	}
+
+	~PhysicsServer2DScope() {
+		if (server) {
+			server->finish();
+			memdelete(server);
+		}
+	}
+};
+
+// Nodes and resources of the scene module emit signals and call methods by
+// the names the test runner doesn't create, as it only registers core types.
+class SceneStringNamesScope {
+	bool created = false;
+
+public:
+	SceneStringNamesScope() {
+		if (!SceneStringNames::get_singleton()) {
+			SceneStringNames::create();
+			Node::init_node_hrcr();
+			created = true;
+		}
+	}
+
+	~SceneStringNamesScope() {
+		if (created) {
+			SceneStringNames::free();
+		}
+	}
+};
+
+// Controls look their theme items up in the default theme, which the test
+// runner doesn't create either. The theme is empty, with a font whose
+// characters are all TEST_FONT_CHAR_WIDTH wide and TEST_FONT_HEIGHT high.
+// Needs a rendering server for the default icon.
+#define TEST_FONT_CHAR_WIDTH 8
+#define TEST_FONT_HEIGHT 16
+
+class DefaultThemeScope {
+	SceneStringNamesScope scene_string_names;
+	bool created = false;
+
+public:
+	DefaultThemeScope() {
+		if (Theme::get_default().is_valid()) {
+			return;
+		}
+
+		Ref<BitmapFont> font;
+		font.instance();
+		font->set_height(TEST_FONT_HEIGHT);
+		font->set_ascent(TEST_FONT_HEIGHT - 4);
+		for (CharType c = 32; c < 127; c++) {
+			font->add_char(c, -1, Rect2(0, 0, TEST_FONT_CHAR_WIDTH, TEST_FONT_HEIGHT), Size2());
+		}
+
+		Ref<Theme> theme;
+		theme.instance();
+		Theme::set_default(theme);
+		Theme::set_default_font(font);
+		Theme::set_default_icon(memnew(ImageTexture));
+		Theme::set_default_style(memnew(StyleBoxEmpty));
+		created = true;
+	}
+
+	~DefaultThemeScope() {
+		if (created) {
+			Theme::set_default(Ref<Theme>());
+			Theme::set_default_font(Ref<Font>());
+			Theme::set_default_icon(Ref<Texture2D>());
+			Theme::set_default_style(Ref<StyleBox>());
+		}
+	}
+};
+
+#endif // TEST_SCENE_HELPERS_H
@@ -0,0 +1,257 @@
+/*************************************************************************/
+/*  test_skeleton_3d.h                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#ifndef TEST_SKELETON_3D_H
+#define TEST_SKELETON_3D_H
+
+#include "core/os/os.h"
+#include "scene/3d/skeleton_3d.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_scene_helpers.h"
+
+namespace TestSkeleton3D {
+
+static Transform bone_local_pose(int p_bone, float p_time) {
+	Quat rot(Vector3(0, 1, 0), Math::sin(p_time + p_bone) * 0.5);
+	return Transform(Basis(rot, Vector3(1, 1, 1)), Vector3(0, 0.2, 0));
+}
+
+// A binary tree of bones, each offset from its parent.
+static Skeleton3D *create_skeleton(int p_bones) {
+	Skeleton3D *skeleton = memnew(Skeleton3D);
+	for (int i = 0; i < p_bones; i++) {
+		skeleton->add_bone("bone_" + itos(i));
+		skeleton->set_bone_parent(i, i > 0 ? (i - 1) / 2 : -1);
+		skeleton->set_bone_rest(i, Transform(Basis(), Vector3(0.1 * (i % 3), 0.5, 0)));
+		skeleton->set_bone_pose(i, bone_local_pose(i, 0));
+	}
+	return skeleton;
+}
+
+static Transform expected_global_pose(Skeleton3D *p_skeleton, int p_bone) {
+	Transform global;
+	for (int bone = p_bone; bone >= 0; bone = p_skeleton->get_bone_parent(bone)) {
+		global = p_skeleton->get_bone_rest(bone) * p_skeleton->get_bone_pose(bone) * global;
+	}
+	return global;
+}
+
+static void update_skeleton(Skeleton3D *p_skeleton) {
+	p_skeleton->notification(Skeleton3D::NOTIFICATION_UPDATE_SKELETON);
+}
+
+TEST_CASE("[Skeleton3D] Bone poses are stored as translation, rotation and scale") {
+	Skeleton3D *skeleton = create_skeleton(1);
+
+	Transform pose(Basis(Quat(Vector3(1, 0, 0), 0.3), Vector3(1, 2, 3)), Vector3(4, 5, 6));
+	skeleton->set_bone_pose(0, pose);
+	CHECK(skeleton->get_bone_pose(0).is_equal_approx(pose));
+	CHECK(skeleton->get_bone_pose_position(0).is_equal_approx(Vector3(4, 5, 6)));
+	CHECK(skeleton->get_bone_pose_scale(0).is_equal_approx(Vector3(1, 2, 3)));
+
+	skeleton->set_bone_pose_rotation(0, Quat());
+	CHECK(skeleton->get_bone_pose(0).basis.is_equal_approx(Basis().scaled(Vector3(1, 2, 3))));
+
+	memdelete(skeleton);
+}
+
+TEST_CASE("[Skeleton3D] Sheared and mirrored poses are kept") {
+	SceneStringNamesScope scene_string_names;
+	Skeleton3D *skeleton = create_skeleton(2);
+
+	Basis sheared(Vector3(1, 0, 0), Vector3(0.5, 1, 0), Vector3(0, 0, 1));
+	Transform sheared_pose(sheared, Vector3(1, 2, 3));
+	skeleton->set_bone_pose(1, sheared_pose);
+	CHECK(skeleton->get_bone_pose(1).is_equal_approx(sheared_pose));
+
+	Transform mirrored_pose(Basis(Quat(Vector3(0, 1, 0), 0.5)).scaled(Vector3(-1, 1, 1)), Vector3(1, 0, 0));
+	skeleton->set_bone_pose(0, mirrored_pose);
+	CHECK(skeleton->get_bone_pose(0).is_equal_approx(mirrored_pose));
+
+	update_skeleton(skeleton);
+	CHECK(skeleton->get_bone_global_pose(0).is_equal_approx(expected_global_pose(skeleton, 0)));
+	CHECK(skeleton->get_bone_global_pose(1).is_equal_approx(expected_global_pose(skeleton, 1)));
+
+	// Setting a component rebuilds the basis from rotation and scale.
+	skeleton->set_bone_pose_scale(1, Vector3(2, 2, 2));
+	CHECK(skeleton->get_bone_pose(1).basis.is_equal_approx(Basis(skeleton->get_bone_pose_rotation(1), Vector3(2, 2, 2))));
+
+	memdelete(skeleton);
+}
+
+TEST_CASE("[Skeleton3D] Nodes bound to an unchanged bone are placed") {
+	SceneStringNamesScope scene_string_names;
+	Skeleton3D *skeleton = create_skeleton(3);
+	update_skeleton(skeleton);
+
+	Node3D *node = memnew(Node3D);
+	skeleton->bind_child_node_to_bone(2, node);
+	update_skeleton(skeleton);
+	CHECK(node->get_transform().is_equal_approx(skeleton->get_bone_global_pose(2)));
+
+	skeleton->unbind_child_node_from_bone(2, node);
+	memdelete(node);
+	memdelete(skeleton);
+}
+
+TEST_CASE("[Skeleton3D] Global poses follow the bone hierarchy") {
+	SceneStringNamesScope scene_string_names;
+	Skeleton3D *skeleton = create_skeleton(15);
+	update_skeleton(skeleton);
+	for (int i = 0; i < 15; i++) {
+		CHECK(skeleton->get_bone_global_pose(i).is_equal_approx(expected_global_pose(skeleton, i)));
+	}
+
+	// Moving one bone must move its descendants but nothing else.
+	const Transform unchanged = skeleton->get_bone_global_pose(2);
+	skeleton->set_bone_pose(1, bone_local_pose(1, 1.0));
+	update_skeleton(skeleton);
+	for (int i = 0; i < 15; i++) {
+		CHECK(skeleton->get_bone_global_pose(i).is_equal_approx(expected_global_pose(skeleton, i)));
+	}
+	CHECK(skeleton->get_bone_global_pose(2) == unchanged);
+
+	// Reparenting moves the whole subtree.
+	skeleton->set_bone_parent(1, 2);
+	update_skeleton(skeleton);
+	for (int i = 0; i < 15; i++) {
+		CHECK(skeleton->get_bone_global_pose(i).is_equal_approx(expected_global_pose(skeleton, i)));
+	}
+
+	memdelete(skeleton);
+}
+
+TEST_CASE("[Skeleton3D] Non-persistent global pose overrides last one update") {
+	SceneStringNamesScope scene_string_names;
+	Skeleton3D *skeleton = create_skeleton(3);
+	update_skeleton(skeleton);
+
+	const Transform override_pose(Basis(), Vector3(10, 0, 0));
+	skeleton->set_bone_global_pose_override(1, override_pose, 1.0);
+	update_skeleton(skeleton);
+	CHECK(skeleton->get_bone_global_pose(1) == override_pose);
+	CHECK(skeleton->get_bone_global_pose(0).is_equal_approx(expected_global_pose(skeleton, 0)));
+
+	update_skeleton(skeleton);
+	CHECK(skeleton->get_bone_global_pose(1).is_equal_approx(expected_global_pose(skeleton, 1)));
+
+	memdelete(skeleton);
+}
+
+TEST_CASE("[Skeleton3D] Global poses stay right when a few bones move each frame") {
+	SceneStringNamesScope scene_string_names;
+	const int bone_count = 80;
+	Skeleton3D *skeleton = create_skeleton(bone_count);
+	update_skeleton(skeleton);
+
+	// A different tenth of the bones is driven each frame, as when a few bones
+	// are moved procedurally on top of a static pose.
+	bool matches = true;
+	for (int frame = 0; frame < 20; frame++) {
+		for (int i = frame % 10; i < bone_count; i += 10) {
+			skeleton->set_bone_pose_rotation(i, Quat(Vector3(0, 1, 0), Math::sin(frame * 0.1 + i) * 0.5));
+		}
+		update_skeleton(skeleton);
+		for (int i = 0; i < bone_count; i++) {
+			matches = matches && skeleton->get_bone_global_pose(i).is_equal_approx(expected_global_pose(skeleton, i));
+		}
+	}
+	CHECK(matches);
+
+	memdelete(skeleton);
+}
+
+class PoseListener : public Object {
+public:
+	int updates = 0;
+	void pose_updated() { updates++; }
+};
+
+TEST_CASE("[Skeleton3D] pose_updated is emitted to listeners") {
+	SceneStringNamesScope scene_string_names;
+	// Registering the class defines its signals.
+	if (!ClassDB::class_exists("Skeleton3D")) {
+		ClassDB::register_class<Skeleton3D>();
+	}
+
+	Skeleton3D *skeleton = create_skeleton(3);
+	PoseListener listener;
+	skeleton->connect("pose_updated", callable_mp(&listener, &PoseListener::pose_updated));
+
+	update_skeleton(skeleton);
+	CHECK(listener.updates == 1);
+
+	skeleton->set_bone_pose(1, bone_local_pose(1, 1.0));
+	update_skeleton(skeleton);
+	CHECK(listener.updates == 2);
+
+	memdelete(skeleton);
+}
+
+TEST_CASE("[Skeleton3D][Benchmark] Global pose update" * doctest::skip()) {
+	SceneStringNamesScope scene_string_names;
+	const int skeleton_count = 1000;
+	const int bone_count = 80;
+	const int frames = 60;
+
+	Vector<Skeleton3D *> skeletons;
+	for (int i = 0; i < skeleton_count; i++) {
+		skeletons.push_back(create_skeleton(bone_count));
+		update_skeleton(skeletons[i]);
+	}
+
+	OS *os = OS::get_singleton();
+	// Animate every bone, then only every tenth bone, as when a few bones are
+	// driven procedurally on top of a static pose.
+	for (int step = 1; step <= 10; step += 9) {
+		uint64_t t = os->get_ticks_usec();
+		for (int frame = 0; frame < frames; frame++) {
+			for (int i = 0; i < skeleton_count; i++) {
+				Skeleton3D *skeleton = skeletons[i];
+				for (int j = step - 1; j < bone_count; j += step) {
+					skeleton->set_bone_pose_rotation(j, Quat(Vector3(0, 1, 0), Math::sin(frame * 0.1 + j) * 0.5));
+				}
+				update_skeleton(skeleton);
+			}
+		}
+		t = os->get_ticks_usec() - t;
+		print_line(vformat("%d skeletons of %d bones, %d bones animated: %.1f us per frame", skeleton_count, bone_count, (bone_count + step - 1) / step, double(t) / frames));
+	}
+
+	for (int i = 0; i < skeleton_count; i++) {
+		memdelete(skeletons[i]);
+	}
+}
+
+} // namespace TestSkeleton3D
+
+#endif // TEST_SKELETON_3D_H
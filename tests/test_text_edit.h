@@ -0,0 +1,193 @@
+/*************************************************************************/
+/*  test_text_edit.h                                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_TEXT_EDIT_H
+#define TEST_TEXT_EDIT_H
+
+#include "scene/gui/popup_menu.h"
+#include "scene/gui/text_edit.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_scene_helpers.h"
+
+namespace TestTextEdit {
+
+static const int WRAP_CHARS = 10;
+
+static void set_wrap_width(TextEdit *p_text_edit, int p_chars) {
+	// Rows leave room for the right margin of 10 pixels and the line number
+	// gutter, which is 1 pixel wide until the first draw.
+	p_text_edit->set_size(Size2(p_chars * TEST_FONT_CHAR_WIDTH + 11, 200));
+	p_text_edit->notification(Control::NOTIFICATION_RESIZED);
+}
+
+static void finish_rewrap(TextEdit *p_text_edit) {
+	for (int i = 0; i < 100 && p_text_edit->is_processing_internal(); i++) {
+		p_text_edit->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
+	}
+}
+
+static TextEdit *create_text_edit(const String &p_text) {
+	// Registering the classes defines the project settings and signals they use.
+	if (!ClassDB::class_exists("TextEdit")) {
+		ClassDB::register_class<TextEdit>();
+		ClassDB::register_class<PopupMenu>();
+	}
+
+	TextEdit *text_edit = memnew(TextEdit);
+	text_edit->set_wrap_enabled(true);
+	text_edit->set_text(p_text);
+	set_wrap_width(text_edit, WRAP_CHARS);
+	finish_rewrap(text_edit);
+	return text_edit;
+}
+
+// Reads how TextEdit splits its lines, which it only exposes through drawing.
+class WrapRows {
+public:
+	static int get_wraps(TextEdit *p_text_edit, int p_line) {
+		return p_text_edit->times_line_wraps(p_line);
+	}
+
+	static Vector<String> get_rows(TextEdit *p_text_edit, int p_line) {
+		return p_text_edit->get_wrap_rows_text(p_line);
+	}
+
+	static int get_row_at_column(TextEdit *p_text_edit, int p_line, int p_column) {
+		return p_text_edit->get_line_wrap_index_at_col(p_line, p_column);
+	}
+};
+
+static String get_rows(TextEdit *p_text_edit, int p_line) {
+	return String("|").join(WrapRows::get_rows(p_text_edit, p_line));
+}
+
+// Each column maps to the row that contains it, the end of the line to the last row.
+static void check_wrap_index_at_col(TextEdit *p_text_edit, int p_line) {
+	Vector<String> rows = WrapRows::get_rows(p_text_edit, p_line);
+	int column = 0;
+	for (int i = 0; i < rows.size(); i++) {
+		for (int j = 0; j < rows[i].length(); j++) {
+			CHECK(WrapRows::get_row_at_column(p_text_edit, p_line, column) == i);
+			column++;
+		}
+	}
+	CHECK(WrapRows::get_row_at_column(p_text_edit, p_line, column) == rows.size() - 1);
+}
+
+TEST_CASE("[TextEdit] Wrapped rows") {
+	RenderingServerScope rendering_server;
+	PhysicsServer2DScope physics_server_2d;
+	DefaultThemeScope default_theme;
+	TextEdit *text_edit = create_text_edit(
+			"short\n"
+			"aaaa bbbb cccc dddd\n"
+			"abcdefghijklmnopqrstuvwxyz\n"
+			"ab abcdefghijklmno\n"
+			"aaaa bbbb     \n"
+			"\tabcd efgh ijkl mnop");
+
+	SUBCASE("Lines that fit aren't split") {
+		CHECK(WrapRows::get_wraps(text_edit, 0) == 0);
+		CHECK(get_rows(text_edit, 0) == "short");
+		CHECK(WrapRows::get_row_at_column(text_edit, 0, 3) == 0);
+	}
+
+	SUBCASE("Rows break after the last space that fits") {
+		CHECK(WrapRows::get_wraps(text_edit, 1) == 1);
+		CHECK(get_rows(text_edit, 1) == "aaaa bbbb |cccc dddd");
+		check_wrap_index_at_col(text_edit, 1);
+	}
+
+	SUBCASE("Words longer than a row are split") {
+		CHECK(WrapRows::get_wraps(text_edit, 2) == 2);
+		CHECK(get_rows(text_edit, 2) == "abcdefghij|klmnopqrst|uvwxyz");
+		check_wrap_index_at_col(text_edit, 2);
+
+		// A long word after a short one starts its own row first.
+		CHECK(get_rows(text_edit, 3) == "ab |abcdefghij|klmno");
+		check_wrap_index_at_col(text_edit, 3);
+	}
+
+	SUBCASE("Trailing spaces stay in the line") {
+		CHECK(get_rows(text_edit, 4) == "aaaa bbbb  |   ");
+		check_wrap_index_at_col(text_edit, 4);
+	}
+
+	SUBCASE("Rows after the first are indented like the line") {
+		// The tab is 4 characters wide, which leaves 6 for the following rows.
+		CHECK(get_rows(text_edit, 5) == "\tabcd |efgh |ijkl |mnop");
+		check_wrap_index_at_col(text_edit, 5);
+	}
+
+	SUBCASE("Edited lines are wrapped again") {
+		text_edit->set_line(1, "aaaa bbbbbb cccc");
+		CHECK(get_rows(text_edit, 1) == "aaaa |bbbbbb |cccc");
+		check_wrap_index_at_col(text_edit, 1);
+	}
+
+	memdelete(text_edit);
+}
+
+TEST_CASE("[TextEdit] Rows are wrapped again only when the width changes") {
+	RenderingServerScope rendering_server;
+	PhysicsServer2DScope physics_server_2d;
+	DefaultThemeScope default_theme;
+	TextEdit *text_edit = create_text_edit("aaaa bbbb cccc dddd\nabcdefghijklmnopqrstuvwxyz");
+	CHECK_FALSE(text_edit->is_processing_internal());
+
+	// Only the height changes.
+	text_edit->set_size(Size2(text_edit->get_size().width, 400));
+	text_edit->notification(Control::NOTIFICATION_RESIZED);
+	CHECK_FALSE(text_edit->is_processing_internal());
+	CHECK(get_rows(text_edit, 0) == "aaaa bbbb |cccc dddd");
+
+	set_wrap_width(text_edit, 15);
+	// The rest of the document is wrapped again over the next frames, but
+	// asking for a line's rows wraps it right away.
+	CHECK(text_edit->is_processing_internal());
+	CHECK(get_rows(text_edit, 1) == "abcdefghijklmno|pqrstuvwxyz");
+	finish_rewrap(text_edit);
+	CHECK_FALSE(text_edit->is_processing_internal());
+	CHECK(get_rows(text_edit, 0) == "aaaa bbbb cccc |dddd");
+	CHECK(WrapRows::get_wraps(text_edit, 1) == 1);
+
+	// Theme changes can change character widths, so they always wrap again.
+	text_edit->notification(Control::NOTIFICATION_THEME_CHANGED);
+	CHECK(text_edit->is_processing_internal());
+	finish_rewrap(text_edit);
+	CHECK(get_rows(text_edit, 0) == "aaaa bbbb cccc |dddd");
+
+	memdelete(text_edit);
+}
+
+} // namespace TestTextEdit
+
+#endif // TEST_TEXT_EDIT_H
@@ -0,0 +1,242 @@
+/*************************************************************************/
+/*  test_tile_map.h                                                      */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_TILE_MAP_H
+#define TEST_TILE_MAP_H
+
+#include "core/os/memory.h"
+#include "scene/2d/tile_map.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_scene_helpers.h"
+
+namespace TestTileMap {
+
+// Cells are stored in 32x32 chunks, these cover both sides of their edges.
+static const Vector2i test_cells[] = {
+	Vector2i(0, 0),
+	Vector2i(-1, -1),
+	Vector2i(31, 31),
+	Vector2i(32, 31),
+	Vector2i(31, 32),
+	Vector2i(-32, -32),
+	Vector2i(-33, -32),
+	Vector2i(100, -70),
+	Vector2i(-70, 100),
+};
+static const int test_cell_count = sizeof(test_cells) / sizeof(test_cells[0]);
+
+// Quadrants without a physics body, so the map can be used without servers.
+static TileMap *create_tile_map() {
+	TileMap *tile_map = memnew(TileMap);
+	tile_map->set_collision_use_parent(true);
+	return tile_map;
+}
+
+TEST_CASE("[TileMap] Cells across chunk edges and at negative coordinates") {
+	RenderingServerScope rendering_server;
+	TileMap *tile_map = create_tile_map();
+
+	for (int i = 0; i < test_cell_count; i++) {
+		tile_map->set_cell(test_cells[i].x, test_cells[i].y, i, i % 2, i % 3 == 0, i % 4 == 0, Vector2(i, i + 1));
+	}
+
+	for (int i = 0; i < test_cell_count; i++) {
+		const Vector2i &p = test_cells[i];
+		CHECK(tile_map->get_cell(p.x, p.y) == i);
+		CHECK(tile_map->is_cell_x_flipped(p.x, p.y) == (i % 2 == 1));
+		CHECK(tile_map->is_cell_y_flipped(p.x, p.y) == (i % 3 == 0));
+		CHECK(tile_map->is_cell_transposed(p.x, p.y) == (i % 4 == 0));
+		CHECK(tile_map->get_cell_autotile_coord(p.x, p.y) == Vector2(i, i + 1));
+	}
+
+	// Neighbours in the same and in other chunks stay empty.
+	CHECK(tile_map->get_cell(1, 0) == TileMap::INVALID_CELL);
+	CHECK(tile_map->get_cell(-1, 0) == TileMap::INVALID_CELL);
+	CHECK(tile_map->get_cell(32, 32) == TileMap::INVALID_CELL);
+	CHECK(tile_map->get_cell(-31, -32) == TileMap::INVALID_CELL);
+	CHECK(tile_map->get_cell(-100, 70) == TileMap::INVALID_CELL);
+	CHECK(tile_map->get_used_cells().size() == test_cell_count);
+
+	// Overwriting a cell doesn't add a new one.
+	tile_map->set_cell(-33, -32, 42);
+	CHECK(tile_map->get_cell(-33, -32) == 42);
+	CHECK(tile_map->get_used_cells().size() == test_cell_count);
+
+	memdelete(tile_map);
+}
+
+#ifdef DEBUG_ENABLED
+TEST_CASE("[TileMap] Erasing the last cell of a chunk frees the chunk") {
+	RenderingServerScope rendering_server;
+	TileMap *tile_map = create_tile_map();
+	// One quadrant spanning two chunks, so only the chunk goes away.
+	tile_map->set_quadrant_size(64);
+	tile_map->set_cell(31, 0, 1);
+	tile_map->set_cell(32, 0, 2);
+	tile_map->set_cell(33, 0, 3);
+
+	// A chunk holds 32x32 cells of 8 bytes each.
+	const int64_t chunk_size = 32 * 32 * 8;
+	int64_t usage = Memory::get_mem_usage();
+	tile_map->set_cell(32, 0, TileMap::INVALID_CELL);
+	CHECK_MESSAGE(usage - Memory::get_mem_usage() < chunk_size, "The chunk should be kept while it has cells.");
+
+	usage = Memory::get_mem_usage();
+	tile_map->set_cell(33, 0, TileMap::INVALID_CELL);
+	CHECK_MESSAGE(usage - Memory::get_mem_usage() >= chunk_size, "The chunk should be freed with its last cell.");
+
+	CHECK(tile_map->get_cell(31, 0) == 1);
+	CHECK(tile_map->get_cell(32, 0) == TileMap::INVALID_CELL);
+	CHECK(tile_map->get_cell(33, 0) == TileMap::INVALID_CELL);
+	CHECK(tile_map->get_used_cells().size() == 1);
+
+	// The chunk is created again when needed.
+	tile_map->set_cell(40, 10, 4);
+	CHECK(tile_map->get_cell(40, 10) == 4);
+	CHECK(tile_map->get_used_cells().size() == 2);
+
+	memdelete(tile_map);
+}
+#endif
+
+TEST_CASE("[TileMap] Used cells and tile data are in row-major order") {
+	RenderingServerScope rendering_server;
+	TileMap *tile_map = create_tile_map();
+
+	// Insert in reverse so the order can't come from insertion.
+	for (int i = test_cell_count - 1; i >= 0; i--) {
+		tile_map->set_cell(test_cells[i].x, test_cells[i].y, i, i % 2, i % 3 == 0, i % 4 == 0, Vector2(i, 0));
+	}
+
+	TypedArray<Vector2i> used = tile_map->get_used_cells();
+	REQUIRE(used.size() == test_cell_count);
+	for (int i = 1; i < used.size(); i++) {
+		Vector2i a = used[i - 1];
+		Vector2i b = used[i];
+		CHECK_MESSAGE((a.y < b.y || (a.y == b.y && a.x < b.x)), "Cells should be sorted by row, then column.");
+	}
+
+	// Tile data loads back into the same cells, in the same order.
+	TileMap *copy = create_tile_map();
+	copy->set("format", tile_map->get("format"));
+	copy->set("tile_data", tile_map->get("tile_data"));
+
+	TypedArray<Vector2i> copy_used = copy->get_used_cells();
+	REQUIRE(copy_used.size() == used.size());
+	for (int i = 0; i < used.size(); i++) {
+		Vector2i p = used[i];
+		CHECK(Vector2i(copy_used[i]) == p);
+		CHECK(copy->get_cell(p.x, p.y) == tile_map->get_cell(p.x, p.y));
+		CHECK(copy->is_cell_x_flipped(p.x, p.y) == tile_map->is_cell_x_flipped(p.x, p.y));
+		CHECK(copy->is_cell_y_flipped(p.x, p.y) == tile_map->is_cell_y_flipped(p.x, p.y));
+		CHECK(copy->is_cell_transposed(p.x, p.y) == tile_map->is_cell_transposed(p.x, p.y));
+		CHECK(copy->get_cell_autotile_coord(p.x, p.y) == tile_map->get_cell_autotile_coord(p.x, p.y));
+	}
+	CHECK(copy->get("tile_data") == tile_map->get("tile_data"));
+
+	memdelete(copy);
+	memdelete(tile_map);
+}
+
+TEST_CASE("[TileMap] Used rect grows and shrinks with the cells") {
+	RenderingServerScope rendering_server;
+	TileMap *tile_map = create_tile_map();
+	CHECK(tile_map->get_used_rect() == Rect2());
+
+	tile_map->set_cell(5, 5, 0);
+	CHECK(tile_map->get_used_rect() == Rect2(5, 5, 1, 1));
+
+	tile_map->set_cell(-40, 2, 0);
+	tile_map->set_cell(33, 70, 0);
+	CHECK(tile_map->get_used_rect() == Rect2(-40, 2, 74, 69));
+
+	// Erasing a corner cell shrinks it to the remaining cells.
+	tile_map->set_cell(33, 70, TileMap::INVALID_CELL);
+	CHECK(tile_map->get_used_rect() == Rect2(-40, 2, 46, 4));
+
+	tile_map->set_cell(-40, 2, TileMap::INVALID_CELL);
+	tile_map->set_cell(5, 5, TileMap::INVALID_CELL);
+	CHECK(tile_map->get_used_rect() == Rect2());
+
+	tile_map->set_cell(-1, -1, 0);
+	CHECK(tile_map->get_used_rect() == Rect2(-1, -1, 1, 1));
+
+	tile_map->clear();
+	CHECK(tile_map->get_used_rect() == Rect2());
+	CHECK(tile_map->get_used_cells().size() == 0);
+
+	memdelete(tile_map);
+}
+
+TEST_CASE("[TileMap] Setting cells in bulk") {
+	RenderingServerScope rendering_server;
+	TileMap *tile_map = create_tile_map();
+
+	Vector<Vector2> positions;
+	Vector<int> tiles;
+	for (int i = 0; i < test_cell_count; i++) {
+		positions.push_back(test_cells[i]);
+		tiles.push_back(i);
+	}
+
+	tile_map->set_cells(positions, tiles);
+	for (int i = 0; i < test_cell_count; i++) {
+		CHECK(tile_map->get_cell(test_cells[i].x, test_cells[i].y) == i);
+	}
+
+	// A single tile is used for all positions.
+	Vector<int> single;
+	single.push_back(7);
+	tile_map->set_cells(positions, single);
+	for (int i = 0; i < test_cell_count; i++) {
+		CHECK(tile_map->get_cell(test_cells[i].x, test_cells[i].y) == 7);
+	}
+
+	// Mismatched sizes are rejected without touching any cell.
+	tiles.resize(test_cell_count - 1);
+	ERR_PRINT_OFF;
+	tile_map->set_cells(positions, tiles);
+	ERR_PRINT_ON;
+	for (int i = 0; i < test_cell_count; i++) {
+		CHECK(tile_map->get_cell(test_cells[i].x, test_cells[i].y) == 7);
+	}
+
+	// Erasing in bulk.
+	single.write[0] = TileMap::INVALID_CELL;
+	tile_map->set_cells(positions, single);
+	CHECK(tile_map->get_used_cells().size() == 0);
+
+	memdelete(tile_map);
+}
+
+} // namespace TestTileMap
+
+#endif // TEST_TILE_MAP_H
@@ -0,0 +1,203 @@
+/*************************************************************************/
+/*  test_tween.h                                                         */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2020 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2020 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_TWEEN_H
+#define TEST_TWEEN_H
+
+#include "core/os/memory.h"
+#include "core/os/os.h"
+#include "scene/animation/tween.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestTween {
+
+class TweenTarget : public Object {
+	GDCLASS(TweenTarget, Object);
+
+protected:
+	static void _bind_methods() {
+		ClassDB::bind_method(D_METHOD("set_value", "value"), &TweenTarget::set_value);
+		ClassDB::bind_method(D_METHOD("get_value"), &TweenTarget::get_value);
+		ClassDB::bind_method(D_METHOD("set_position", "position"), &TweenTarget::set_position);
+		ClassDB::bind_method(D_METHOD("get_position"), &TweenTarget::get_position);
+		ClassDB::bind_method(D_METHOD("set_translation", "translation"), &TweenTarget::set_translation);
+		ClassDB::bind_method(D_METHOD("get_translation"), &TweenTarget::get_translation);
+		ClassDB::bind_method(D_METHOD("set_color", "color"), &TweenTarget::set_color);
+		ClassDB::bind_method(D_METHOD("get_color"), &TweenTarget::get_color);
+
+		ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "value"), "set_value", "get_value");
+		ADD_PROPERTY(PropertyInfo(Variant::VECTOR2, "position"), "set_position", "get_position");
+		ADD_PROPERTY(PropertyInfo(Variant::VECTOR3, "translation"), "set_translation", "get_translation");
+		ADD_PROPERTY(PropertyInfo(Variant::COLOR, "color"), "set_color", "get_color");
+	}
+
+public:
+	float value = 0.0;
+	Vector2 position;
+	Vector3 translation;
+	Color color;
+
+	void set_value(float p_value) { value = p_value; }
+	float get_value() const { return value; }
+	void set_position(const Vector2 &p_position) { position = p_position; }
+	Vector2 get_position() const { return position; }
+	void set_translation(const Vector3 &p_translation) { translation = p_translation; }
+	Vector3 get_translation() const { return translation; }
+	void set_color(const Color &p_color) { color = p_color; }
+	Color get_color() const { return color; }
+};
+
+TEST_CASE("[Tween] Float, vector and color values follow the easing equation") {
+	Tween *tween = memnew(Tween);
+	TweenTarget *target = memnew(TweenTarget);
+
+	tween->interpolate_property(target, NodePath("value"), 0.0, 10.0, 1.0, Tween::TRANS_LINEAR);
+	tween->interpolate_property(target, NodePath("position"), Vector2(), Vector2(2, 4), 1.0, Tween::TRANS_QUAD, Tween::EASE_IN);
+	tween->interpolate_property(target, NodePath("translation"), Vector3(1, 1, 1), Vector3(3, 5, 7), 1.0, Tween::TRANS_LINEAR);
+	tween->interpolate_property(target, NodePath("color"), Color(0, 0, 0, 0), Color(1, 0.5, 0, 1), 1.0, Tween::TRANS_LINEAR);
+
+	tween->seek(0.5);
+	CHECK(Math::is_equal_approx(target->value, 5.0f));
+	CHECK(target->position.is_equal_approx(Vector2(0.5, 1)));
+	CHECK(target->translation.is_equal_approx(Vector3(2, 3, 4)));
+	CHECK(target->color.is_equal_approx(Color(0.5, 0.25, 0, 0.5)));
+
+	tween->seek(1.0);
+	CHECK(Math::is_equal_approx(target->value, 10.0f));
+	CHECK(target->position.is_equal_approx(Vector2(2, 4)));
+	CHECK(target->translation.is_equal_approx(Vector3(3, 5, 7)));
+	CHECK(target->color.is_equal_approx(Color(1, 0.5, 0, 1)));
+
+	memdelete(target);
+	memdelete(tween);
+}
+
+TEST_CASE("[Tween] Removing a tween keeps the others") {
+	Tween *tween = memnew(Tween);
+	TweenTarget *target = memnew(TweenTarget);
+
+	tween->interpolate_property(target, NodePath("value"), 0.0, 10.0, 1.0);
+	tween->interpolate_property(target, NodePath("position"), Vector2(), Vector2(2, 4), 2.0);
+	tween->interpolate_property(target, NodePath("translation"), Vector3(), Vector3(3, 3, 3), 3.0);
+	CHECK(Math::is_equal_approx(tween->get_runtime(), 3.0f));
+
+	tween->remove(target, "translation");
+	CHECK(Math::is_equal_approx(tween->get_runtime(), 2.0f));
+
+	tween->seek(2.0);
+	CHECK(Math::is_equal_approx(target->value, 10.0f));
+	CHECK(target->position.is_equal_approx(Vector2(2, 4)));
+	CHECK(target->translation == Vector3());
+
+	tween->remove_all();
+	CHECK(Math::is_equal_approx(tween->get_runtime(), 0.0f));
+
+	memdelete(target);
+	memdelete(tween);
+}
+
+TEST_CASE("[Tween] Restarting tweens on known keys doesn't allocate") {
+	Tween *tween = memnew(Tween);
+	TweenTarget *targets[8];
+	for (int i = 0; i < 8; i++) {
+		targets[i] = memnew(TweenTarget);
+	}
+	const NodePath value_path("value");
+	const NodePath color_path("color");
+	const StringName set_position("set_position");
+
+	// Start short transitions on every target, step them and drop them all,
+	// as UI code does. Once the first round has grown the storage and resolved
+	// the keys, the following rounds must not touch the allocator.
+	uint64_t alloc_count = 0;
+	for (int round = 0; round < 4; round++) {
+		if (round == 1) {
+			alloc_count = Memory::get_total_alloc_count();
+		}
+		for (int i = 0; i < 8; i++) {
+			tween->interpolate_property(targets[i], value_path, 0.0, 1.0, 0.25, Tween::TRANS_SINE, Tween::EASE_OUT);
+			tween->interpolate_property(targets[i], color_path, Color(1, 1, 1, 0), Color(1, 1, 1, 1), 0.25, Tween::TRANS_CUBIC, Tween::EASE_IN_OUT);
+			tween->interpolate_method(targets[i], set_position, Vector2(), Vector2(4, 2), 0.25);
+		}
+		tween->seek(0.125);
+		tween->seek(0.25);
+		tween->remove_all();
+	}
+	CHECK(Memory::get_total_alloc_count() == alloc_count);
+
+	for (int i = 0; i < 8; i++) {
+		CHECK(Math::is_equal_approx(targets[i]->value, 1.0f));
+		CHECK(targets[i]->color.is_equal_approx(Color(1, 1, 1, 1)));
+		CHECK(targets[i]->position.is_equal_approx(Vector2(4, 2)));
+		memdelete(targets[i]);
+	}
+	memdelete(tween);
+}
+
+TEST_CASE("[Tween][Benchmark] Short-lived tweens" * doctest::skip()) {
+	const int target_count = 1000;
+	const int rounds = 100;
+	const int steps = 10;
+
+	Tween *tween = memnew(Tween);
+	Vector<TweenTarget *> targets;
+	for (int i = 0; i < target_count; i++) {
+		targets.push_back(memnew(TweenTarget));
+	}
+	const NodePath value_path("value");
+	const NodePath color_path("color");
+
+	// Start a float and a color tween per target, step them, then drop them all,
+	// as UI code does when it keeps starting short transitions.
+	OS *os = OS::get_singleton();
+	uint64_t t = os->get_ticks_usec();
+	for (int round = 0; round < rounds; round++) {
+		for (int i = 0; i < target_count; i++) {
+			tween->interpolate_property(targets[i], value_path, 0.0, 1.0, 0.25, Tween::TRANS_SINE, Tween::EASE_OUT);
+			tween->interpolate_property(targets[i], color_path, Color(1, 1, 1, 0), Color(1, 1, 1, 1), 0.25, Tween::TRANS_CUBIC, Tween::EASE_IN_OUT);
+		}
+		for (int step = 1; step <= steps; step++) {
+			tween->seek(0.25 * step / steps);
+		}
+		tween->remove_all();
+	}
+	t = os->get_ticks_usec() - t;
+	print_line(vformat("%d tweens of %d steps each: %.1f tweens per ms", target_count * 2 * rounds, steps, target_count * 2.0 * rounds * 1000.0 / t));
+
+	for (int i = 0; i < target_count; i++) {
+		memdelete(targets[i]);
+	}
+	memdelete(tween);
+}
+
+} // namespace TestTween
+
+#endif // TEST_TWEEN_H
@@ -106,6 +106,103 @@ TEST_CASE("[Variant] Writer and parser float") {
 	CHECK_MESSAGE(b64_float_parsed == 340282001837565597733306976381245063168.0, "Should not overflow.");
 }
 
+TEST_CASE("[Variant] Dictionary iteration") {
+	Dictionary dict;
+	for (int i = 0; i < 10; i++) {
+		dict[itos(i)] = i;
+	}
+	dict.erase("3");
+
+	Variant container = dict;
+	Variant iter;
+	bool valid = false;
+	Array visited;
+
+	bool more = container.iter_init(iter, valid);
+	while (more && valid) {
+		Variant key = container.iter_get(iter, valid);
+		CHECK(valid);
+		visited.push_back(key);
+		if (key == Variant("5")) {
+			// Erasing the current key should not stop the iteration.
+			dict.erase(key);
+		}
+		more = container.iter_next(iter, valid);
+	}
+
+	CHECK(valid);
+	CHECK_MESSAGE(visited.size() == 9, "Every remaining key should be visited once.");
+	CHECK(visited[0] == Variant("0"));
+	CHECK(visited[3] == Variant("4"));
+	CHECK(visited[8] == Variant("9"));
+	CHECK(dict.size() == 8);
+
+	CHECK_MESSAGE(dict.get_key_at_index(4) == Variant("6"), "Index access should skip erased entries.");
+	CHECK(dict.get_value_at_index(4) == Variant(6));
+	CHECK(dict.get_key_at_index(8) == Variant());
+}
+
+TEST_CASE("[Variant] Erasing every key while iterating a Dictionary") {
+	Dictionary dict;
+	for (int i = 0; i < 100; i++) {
+		dict[i] = i;
+	}
+
+	Variant container = dict;
+	Variant iter;
+	bool valid = false;
+	int visited = 0;
+	int last = -1;
+	bool ordered = true;
+
+	bool more = container.iter_init(iter, valid);
+	while (more && valid) {
+		Variant key = container.iter_get(iter, valid);
+		ordered = ordered && int(key) == last + 1;
+		last = key;
+		visited++;
+		dict.erase(key);
+		more = container.iter_next(iter, valid);
+	}
+
+	CHECK(valid);
+	CHECK(ordered);
+	CHECK_MESSAGE(visited == 100, "Erasing the current key should not skip any of the following ones.");
+	CHECK(dict.empty());
+}
+
+TEST_CASE("[Variant] Pooled math types") {
+	// Transform, Basis, AABB and Transform2D are stored out of line, make sure
+	// recycled storage never leaks values between variants.
+	Vector<Variant> variants;
+	for (int i = 0; i < 1000; i++) {
+		variants.push_back(Transform(Basis(), Vector3(i, 0, 0)));
+		variants.push_back(::AABB(Vector3(i, 0, 0), Vector3(1, 1, 1)));
+	}
+	for (int i = 0; i < variants.size(); i += 4) {
+		variants.write[i] = Variant();
+	}
+	for (int i = 0; i < variants.size(); i += 4) {
+		variants.write[i] = Transform2D(0, Vector2(i, 0));
+	}
+
+	bool valid = true;
+	for (int i = 0; i < variants.size(); i++) {
+		if (i % 4 == 0) {
+			valid = valid && Transform2D(variants[i]).get_origin() == Vector2(i, 0);
+		} else if (i % 2 == 0) {
+			valid = valid && Transform(variants[i]).origin == Vector3(i / 2, 0, 0);
+		} else {
+			valid = valid && ::AABB(variants[i]).position == Vector3(i / 2, 0, 0);
+		}
+	}
+	CHECK(valid);
+
+	Variant copy = variants[2];
+	variants.write[2] = Basis();
+	CHECK_MESSAGE(Transform(copy).origin == Vector3(1, 0, 0), "Copies should own their storage.");
+}
+
 } // namespace TestVariant
 
 #endif // TEST_VARIANT_H